@@ -0,0 +1,326 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: supersingular isogeny parameters and generation of functions for P434
+*********************************************************************************************/  
+
+#include "api.h" 
+#include "P434_internal.h"
+#include "../internal.h"
+
+
+// Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
+// --------------------------------------------------------------------------------------------------
+// Elements over GF(p) and Z_order are encoded with the least significant octet (and digit) located at the leftmost position (i.e., little endian format). 
+// Elements (a+b*i) over GF(p^2), where a and b are defined over GF(p), are encoded as {a, b}, with a in the least significant position.
+// Elliptic curve points P = (x,y) are encoded as {x, y}, with x in the least significant position. 
+// Internally, the number of digits used to represent all these elements is obtained by approximating the number of bits to the immediately greater multiple of 32.
+// For example, a 434-bit field element is represented with Ceil(434 / 64) = 7 64-bit digits or Ceil(434 / 32) = 14 32-bit digits.
+
+//
+// Curve isogeny system "SIDHp434". Base curve: Montgomery curve By^2 = Cx^3 + Ax^2 + Cx defined over GF(p434^2), where A=6, B=1, C=1 and p434 = 2^216*3^137-1
+//
+         
+const uint64_t p434[NWORDS64_FIELD]              = { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFDC1767AE2FFFFFF, 0x7BC65C783158AEA3, 0x6CFC5FD681C52056, 0x0002341F27177344 };
+const uint64_t p434x2[NWORDS64_FIELD]            = { 0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFB82ECF5C5FFFFFF, 0xF78CB8F062B15D47, 0xD9F8BFAD038A40AC, 0x0004683E4E2EE688 };
+const uint64_t p434x4[NWORDS64_FIELD]            = { 0xFFFFFFFFFFFFFFFC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xF705D9EB8BFFFFFF, 0xEF1971E0C562BA8F, 0xB3F17F5A07148159, 0x0008D07C9C5DCD11 };
+const uint64_t p434p1[NWORDS64_FIELD]            = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xFDC1767AE3000000, 0x7BC65C783158AEA3, 0x6CFC5FD681C52056, 0x0002341F27177344 };
+const uint64_t p434x16p[2*NWORDS64_FIELD]        = { 0x0000000000000010, 0x0000000000000000, 0x0000000000000000, 0x47D130A3A0000000, 0x873470F9D4EA2B80, 0x6074052FC75BF530, 0x54497C1B1D119772,
+                                                     0xC55F373D2CDCA412, 0x732CA2221C664B96, 0x6445AB96AF6359A5, 0x221708AB42ABE1B4, 0xAE3D3D0063244F01, 0x18B920F2ECF68816, 0x0000004DB194809D };
+// Order of Alice's subgroup, 2^216
+const uint64_t Alice_order[NWORDS64_ORDER]       = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000001000000 };
+// Order of Bob's subgroup, 3^137
+const uint64_t Bob_order[NWORDS64_ORDER]         = { 0x58AEA3FDC1767AE3, 0xC520567BC65C7831, 0x1773446CFC5FD681, 0x0000000002341F27 };
+#ifdef COMPRESS
+// Montgomery constants for the arithmetic modulo Bob's order: rprime = -order^(-1) mod 2^256 and Rprime = (2^256)^2 mod order
+const uint64_t Montgomery_rprime_B[NWORDS64_ORDER] = { 0x7A9991106B9F6535, 0x7E06A4ACAEA6DA73, 0x3D4C8710FC0ECD0E, 0xAE3D0E8DC11F55F1 };
+const uint64_t Montgomery_Rprime_B[NWORDS64_ORDER] = { 0xE63F0179FFC3EF1B, 0x47AF4CC2440BEB81, 0xEC3CD079857407E7, 0x00000000008BF47C };
+// Elligator 2 candidates v = 1/(1 + u*r^2) for r = 1, ..., TABLE_R_LEN and the non-square u = 2 + i, in Montgomery representation
+const uint64_t basis_table[TABLE_R_LEN][2*NWORDS64_FIELD] = {
+                                                   { 0x999999999999BC73, 0x9999999999999999, 0x9999999999999999, 0x9C9276B1A0999999, 0x24AAB5C6B74B8308,
+                                                     0xBA8CEC66D0E6DA1E, 0x0001998D7CFA066A, 0xCCCCCCCCCCCCC12E, 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCC,
+                                                     0x1EE5F99502CCCCCC, 0x1A381FE09EEA2DA1, 0xD978110991782CF7, 0x0001AB9AA8197120 },   // r = 1
+                                                   { 0x41FAB8BE05474CC2, 0x054741FAB8BE0547, 0xB8BE054741FAB8BE, 0xC9AE7F39FF4741FA, 0xB1F4EE9D1CDDE556,
+                                                     0x1650D500E95EBA31, 0x00005023E95DDE16, 0x54741FAB8BE04FA9, 0x8BE054741FAB8BE0, 0x1FAB8BE054741FAB,
+                                                     0x16655C7EB0E05474, 0xD849DDDEC437B020, 0x2E677A183619E2D7, 0x00019324B6AFA19D },   // r = 2
+                                                   { 0x8536718536718A34, 0x3671853671853671, 0x7185367185367185, 0x88EBEF311A718536, 0xA7D32684ABC9D6E9,
+                                                     0x86FFA027C5EA41ED, 0x0001EF2D26807E04, 0x8B01288B012888A3, 0x01288B01288B0128, 0x288B01288B01288B,
+                                                     0xF2CAF7B478288B01, 0xB30406DB0864DD0C, 0x7DE19AB6317E9551, 0x0001499080A4B0D6 },   // r = 3
+                                                   { 0x497819E2B03FF6AB, 0x43C254E3A3E0C8FE, 0xA1F98753F0030B9C, 0x9D08AFDF66CDC06D, 0xDC9B4D2060AC66D4,
+                                                     0xAA1B0432076D8C12, 0x00008C728C65FAC7, 0x7787B5638B83E57E, 0x4BC0CF1581FF9E8C, 0x1E12A71D1F0647F2,
+                                                     0xF874D414C6185CE2, 0xB1C3CEFB8EF40E5E, 0xD974CD64813E2AD0, 0x0000EF9B64A50B19 },   // r = 4
+                                                   { 0x4FAC336C14F326D0, 0xF324FAC336C14F32, 0xC14F324FAC336C14, 0x7A441A68B4FAC336, 0xF55ABB9E02E51BCD,
+                                                     0x7DF241E5CC125D82, 0x00020CD99B418553, 0x79927D619B60A6B2, 0x60A79927D619B60A, 0x19B60A79927D619B,
+                                                     0xC1836ABCD19927D6, 0x056ED5F9FA770E50, 0x938A248852AF05FF, 0x000180454EC85AD4 },   // r = 5
+                                                   { 0x8FC8F97836B765C9, 0x79F3DDD74597E657, 0xF40F4D525855A12C, 0xB504F4CAE1D399D4, 0x5B3EBD1F2ED83FF2,
+                                                     0xE84645130B2D0DBA, 0x0000DA2062334ED3, 0xC71EA489199E8B2C, 0x4CA048F486023DBF, 0x7D1F0775331F6A61,
+                                                     0x238045677D90A29A, 0xA9A61EA8DBC1A3F4, 0x7D71C1C648CD9742, 0x0001075C2F69D7C4 },   // r = 6
+                                                   { 0xC3A939DD014D003A, 0xA92F1F17B5248C25, 0x7399C8DD37028F40, 0x78F15EE9E1AEC3C9, 0x9C6EC31DE809B64F,
+                                                     0xADC32BB57B097A2B, 0x000182925F9D25CA, 0x37B92BC3BEB5AFB9, 0xC389002039BCC790, 0x769F328FEC87C89C,
+                                                     0x45F48B81136118A1, 0x771813745D6BBD3E, 0x1DB0C12AB3EBFB1D, 0x00014733DD55FF54 },   // r = 7
+                                                   { 0x8D3D7757053F25DE, 0x1BB0A5534AD2D44F, 0x6A5D806D0822AA3D, 0x81D30F00C5FE0658, 0xDD7EDBA5455F0CBF,
+                                                     0x321F8C3287B5561C, 0x00010C3B9266397A, 0x58AFE48B66934683, 0x2BD00D3BE2D0F3F0, 0x366476DBC465DF23,
+                                                     0xCF46D882997C04CA, 0x100047EAE7B1B0CA, 0xE98B984D9BA8857B, 0x00019D8D87E9F5E7 },   // r = 8
+                                                   { 0x16255E514230CE8B, 0x4CEE6DB1C53E2C2B, 0xE69FC4293B640916, 0xBEDB813769959101, 0x75374AFDF84FA267,
+                                                     0xA08A7C370DEA787F, 0x0001C42814BBDFF3, 0xCA970CCFC4688815, 0xB0EF9A5F6A27C77F, 0x57FF227293F58D8B,
+                                                     0x2782596E2D3675FA, 0xF3B4D13FBB928B8E, 0x5F9B384AE0301D97, 0x00015DD020A61A84 },   // r = 9
+                                                   { 0xB9758CA6605A88DC, 0x9B0E00E773B0BE3F, 0x8D1CB3F2BBA35FE1, 0x5BD852F804F988BA, 0x5AB812185EC1F54A,
+                                                     0x81EE7303B3B11EF8, 0x000167A5C4B8EC00, 0x537E31BF0E7887B0, 0xF28A3A23236AEF0A, 0x49B722040DA1FB99,
+                                                     0x89C14F4BF6ADE22F, 0x8303646A89C2A6D6, 0x4446EB8898043332, 0x0001C1BE6A2BAA3F },   // r = 10
+                                                   { 0x60904BED92E6F0A1, 0xB75830F83D32BDCE, 0x5303D79E3A35E71C, 0x057F1D1FBF1F6424, 0x09D29AFFCD4B9F82,
+                                                     0x0DE6CF6ECF1EDB33, 0x0001B330E4A5A838, 0x09DBF7B0AE6C58C5, 0x45E3E366E4AFF3A9, 0x29E3BFD3FA3102E9,
+                                                     0x4F66726AC8918DDF, 0xAC46D1291B0F682A, 0x197E0510E123E22F, 0x000141E2A18F39E4 },   // r = 11
+                                                   { 0x0611E67F5AFE0C95, 0x73F50769BEADF858, 0x5FF1EF605FF0AD88, 0xC80A90794F63FDDE, 0xA435619598EC3001,
+                                                     0x34AF362A0C54F5EA, 0x00017A9719011B55, 0xE183ECD15F816A3A, 0xF6F117C4395997BE, 0x67AAE2316B369528,
+                                                     0x0618723D3BFE02D5, 0x947CE54AACCA22AF, 0x4963179F500215D8, 0x0000A69EB2B134C5 },   // r = 12
+                                                   { 0x4512C7CB549E0613, 0x58B3138052AC291F, 0xBDB21A1D0DC8E1F3, 0x08F33DE426C49F38, 0x78ED469B002924BC,
+                                                     0x94FBCA884C534ECE, 0x00016411608F666E, 0x76DCF643092ACD65, 0x87827A6E7863F18A, 0x5FBB99DF645C6BDD,
+                                                     0x26E3468335753344, 0xC6BB91D8121B199B, 0x3BC17926E87E395D, 0x00007D5A5FF0E692 },   // r = 13
+                                                   { 0x2CD377F7AF7A3996, 0xFE915A6848EB6335, 0xE2796F2ACB922496, 0xD5FEAE7013EC2D63, 0x1B264179788453F2,
+                                                     0x3A50528DF123CA80, 0x00003C2B61484D9B, 0x0CD1CFE4E128028C, 0x7E6F33F849117206, 0x422F91D71D67A4CB,
+                                                     0xA9C6E809C409E2D9, 0xD3D9B2D66BAC46C7, 0x68CEEB5277B8DDD3, 0x0000381E05A78010 },   // r = 14
+                                                   { 0x4F4EBAA4A85CBB5A, 0x00F6A3476ECCE55C, 0x6DF6C3C9230F72FA, 0x0DCB283C6564F0BA, 0xA82B8AC12EDC42E9,
+                                                     0x5FBD7E3CB399C776, 0x0000FFF6BD7C7E3E, 0xDC68551ECFC41D23, 0xC237308737FA469E, 0xE6A81586A6FCD565,
+                                                     0x3DED4572B5A03B45, 0x6946056BDF996305, 0xE2F1389B1D6CF35C, 0x00010CD02839AEB3 },   // r = 15
+                                                   { 0xA5959A668F12A176, 0xB310CEBDA555CD7D, 0x078B28C38E9A01DF, 0x6197E0DCCE65322A, 0xA8D2A1E798A9702A,
+                                                     0x753603AD399F0CAA, 0x000105A74C730C51, 0xC8D0CA6784B4551A, 0x45D4AE4A0850F0C8, 0x391DDCAFE0C29DC1,
+                                                     0x8270BF6B173AC986, 0x73770F0EAA80DDEF, 0xBB7C9EE74BD61C23, 0x00007A592BC0228D },   // r = 16
+                                                   { 0xA302403B141A0385, 0x9188DF46965BF724, 0x666234B05EB3A268, 0x37AB02DCD5D0FB01, 0xED9FA4ABF47BF81A,
+                                                     0x31B87D353910E9E3, 0x0001E931A394CEF8, 0x9E46F21160F6FEAF, 0x6359F8041E2E0FEA, 0x4AE82F18B6A502F1,
+                                                     0xCC2D17C159C53B16, 0xDC5076C57AEF74C5, 0xA4D66592DBF0E267, 0x000012E32E3B2202 }   // r = 17
+                                                   };
+// Tables of the Pohlig-Hellman discrete logarithms, generated by dloggen.py
+#include "P434_dlog_tables.h"
+// Torsion subgroups E[2^216], carried by Bob's public keys, and E[3^137], carried by Alice's public keys
+// 2^216 has OALICE_BITS+1 bits, and the arithmetic modulo 2^216 needs no Montgomery constants (see mul_mod_order())
+const torsion_t torsion_A = { 2, EXPON_2, OALICE_BITS + 1, ORDER_A_ENCODED_BYTES, (const digit_t*)Alice_order, NULL, NULL,
+                              W_2, DLEN_2, ELL2_W, ELL2_EMODW, (const uint64_t*)ph2_table, (const uint64_t*)ph2_table0, ph2_path };
+const torsion_t torsion_B = { 3, EXPON_3, OBOB_BITS, ORDER_B_ENCODED_BYTES, (const digit_t*)Bob_order, (const digit_t*)Montgomery_rprime_B, (const digit_t*)Montgomery_Rprime_B,
+                              W_3, DLEN_3, ELL3_W, ELL3_EMODW, (const uint64_t*)ph3_table, (const uint64_t*)ph3_table0, ph3_path };
+#endif
+// Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p434^2), expressed in Montgomery representation
+const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x05ADF455C5C345BF, 0x91935C5CC767AC2B, 0xAFE4E879951F0257, 0x70E792DC89FA27B1, 0xF797F526BB48C8CD, 0x2181DB6131AF621F, 0x00000A1C08B1ECC4,   // XPA0
+                                                     0x74840EB87CDA7788, 0x2971AA0ECF9F9D0B, 0xCB5732BDF41715D5, 0x8CD8E51F7AACFFAA, 0xA7F424730D7E419F, 0xD671EB919A179E8C, 0x0000FFA26C5A924A,   // XPA1
+                                                     0xFEC6E64588B7273B, 0xD2A626D74CBBF1C6, 0xF8F58F07A78098C7, 0xE23941F470841B03, 0x1B63EDA2045538DD, 0x735CFEB0FFD49215, 0x0001C4CB77542876,   // XQA0
+                                                     0xADB0F733C17FFDD6, 0x6AFFBD037DA0A050, 0x680EC43DB144E02F, 0x1E2E5D5FF524E374, 0xE2DDA115260E2995, 0xA6E4B552E2EDE508, 0x00018ECCDDF4B53E,   // XQA1
+                                                     0xA2075B4E8C7885FC, 0xA909294709F178B8, 0xBE7D4DA7F4CCA9F6, 0x7729F9A5E99410B5, 0x0E71CE2C1A75E6DF, 0xAFC6090DCC8DD91A, 0x00010AD1937CAE4B,   // XRA0
+                                                     0x262E034D27834901, 0xC16303F506EA719A, 0xA27C95B76AAF9AD7, 0xD8DC6F9AB991B77A, 0x2898D8D50D08ED3F, 0xD8B55ECC73B90B3D, 0x000035E03E6FED0D }; // XRA1
+// Bob's generator values {XPB0, XQB0, XRB0 + XRB1*i} in GF(p434^2), expressed in Montgomery representation
+const uint64_t B_gen[6 * NWORDS64_FIELD]         = { 0x6E5497556EDD48A3, 0x2A61B501546F1C05, 0xEB919446D049887D, 0x5864A4A69D450C4F, 0xB883F276A6490D2B, 0x22CC287022D5F5B9, 0x0001BED4772E551F,   // XPB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XPB1
+                                                     0xFAE2A3F93D8B6B8E, 0x494871F51700FE1C, 0xEF1A94228413C27C, 0x498FF4A4AF60BD62, 0xB00AD2A708267E8A, 0xF4328294E017837F, 0x000034080181D8AE,   // XQB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XQB1
+                                                     0x283B34FAFEFDC8E4, 0x9208F44977C3E647, 0x7DEAE962816F4E9A, 0x68A2BA8AA262EC9D, 0x8176F112EA43F45B, 0x02106D022634F504, 0x00007E8A50F02E37,   // XRB0
+                                                     0xB378B7C1DA22CCB1, 0x6D089C99AD1D9230, 0xEBE15711813E2369, 0x2B35A68239D48A53, 0x445F6FD138407C93, 0xBEF93B29A3F6B54B, 0x000173FA910377D3 }; // XRB1
+
+
+// Huff initial curve c
+const uint64_t Huff_c[NWORDS64_FIELD]            = { 0x76717089790E679E, 0x1DEC88520EAF6BFA, 0xD3D873FA36F2C707, 0x8D2C9F1224D6D34A, 0x9CE8B6C139A6FCAA, 0x56B8E5CAABCCC3AA, 0x0000E66E3280B3C4 };
+
+// Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p434^2), expressed in Montgomery representation
+const uint64_t A_gen_Huff[6 * NWORDS64_FIELD]    = { 0xDC42679DC1EFB9FE, 0x9E3EBE2FE7199049, 0x29F91AE37DBB2FC1, 0x63B1E941E46B753D, 0xCB0FE3ABD21E4BAF, 0x7F7A8B4B2AA89105, 0x00021F5E8B2C0ED5,   // XPA0
+                                                     0xF71A0F88E4698763, 0xAE1166A973DD9F27, 0x04C093C3D1F45A81, 0xB38F69DA2778E69E, 0x2B263691517BC311, 0x0D1E5BA138AAF186, 0x0000A147486C0B32,   // XPA1
+                                                     0x2BCCD1EB19751B92, 0xDA201D7BFF2EB1E4, 0x1BFD2AB9DC22B5EB, 0x44D991A0F88A431A, 0x99D88200D62B5F4A, 0x0423E778B6E2B9FF, 0x000172C55E51BA2C,   // XQA0
+                                                     0xE796B6CDD64F9189, 0xA30B3614B3202B7B, 0xB5CC37DBBE970C58, 0xA12A9B319209339F, 0x2A5CBE5D08DC4C5A, 0x3A2A0E0B7EF5C876, 0x00002726AD2C8617,   // XQA1
+                                                     0x69EE9E1660690FC4, 0x67E7A453BB0D5E24, 0xB434E0A2BDF277D9, 0x26B22134556DA57E, 0xE028AA0842EDF85C, 0x8A99B71BFD20C470, 0x0000E815D2DEC951,   // XRA0
+                                                     0x621AD7551EFBBA61, 0xA46ED5C36DDB3518, 0x4337FD74552E278C, 0xAA302A0510AAC16D, 0xC75EB14EBF35D9E1, 0xEF798D8DFBB309D5, 0x0001A95AEFBDAD11 }; // XRA1
+
+
+
+
+
+
+
+// Bob's generator values {XPB0, XQB0, XRB0 + XRB1*i} in GF(p434^2), expressed in Montgomery representation
+const uint64_t B_gen_Huff[6 * NWORDS64_FIELD]    = { 0x3AC6F3C6BDF6B2AA, 0xD1F9788B2D53C617, 0xD18F64077F97DBAF, 0xAB4E06277E9ACC29, 0x427844EDFE2103E4, 0x87FEA4654154D52A, 0x0001CBC0081983CF,   // XPB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XPB1
+                                                     0xD7EECBD3EE03FDE4, 0x3A930D94307C1B5F, 0xB642059D36858C9B, 0xA7FD59D3BAEA7A1D, 0x515E4641F1BB4208, 0xD3522EC7808EE293, 0x000208C399926576,   // XQB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XQB1
+                                                     0xB1199749B24B0EAD, 0x48EEF2A09305CB98, 0x47DDCBAA45D9C090, 0x6FD796C799521934, 0x4D3C0E9DB2558BA0, 0x65392C8880494DC2, 0x0000D414DE98865B,   // XRB0
+                                                     0x4479E454710F7AEE, 0xDA532EF304F54282, 0x49F4E8C28E0B2667, 0xF37BF7EF6D0C4E1F, 0x6DA9745A3EDC6826, 0xC38C80A74D90CE26, 0x0000BC2193EC1FCC }; // XRB1
+#ifdef FIXED_BASE
+// Fixed-base tables of the Huff key generation, generated by fixedgen.py from A_gen_Huff and B_gen_Huff
+#include "P434_fixed_base_tables.h"
+#endif
+
+
+
+// Montgomery constant Montgomery_R2 = (2^448)^2 mod p434
+const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x28E55B65DCD69B30, 0xACEC7367768798C2, 0xAB27973F8311688D, 0x175CC6AF8D6C7C0B, 0xABCD92BF2DDE347E, 0x69E16A61C7686D9A, 0x000025A89BCDD12A };
+// Value one in Montgomery representation 
+const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0xB90FF404FC000000, 0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
+
+
+// Fixed parameters for isogeny tree computation
+const unsigned int strat_Alice[MAX_Alice-1] = { 
+48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1,
+2, 1, 1 };
+
+const unsigned int strat_Bob[MAX_Bob-1] = { 
+65, 33, 17, 9, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4,
+2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2,
+1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 16, 8, 4, 2, 1,
+1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1,
+1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4,
+2, 1, 1, 2, 1, 1 };
+
+// Strategies for the Huff isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Huff[MAX_Alice-1] = { 
+44, 28, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1,
+1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+1, 16, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+1, 1 };
+
+const unsigned int strat_Alice_par_Huff[MAX_Alice-1] = { 
+39, 26, 17, 11, 7, 4, 3, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 3, 2,
+1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+1, 1, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+1, 1 };
+
+const unsigned int strat_Bob_Huff[MAX_Bob-1] = { 
+55, 33, 20, 12, 7, 4, 3, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5,
+3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+1, 3, 2, 1, 1, 1, 1, 1, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 22, 13,
+8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Bob_par_Huff[MAX_Bob-1] = { 
+40, 33, 23, 16, 11, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 3, 2,
+1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+1, 1, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1,
+1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3,
+2, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+// Strategies for the twisted Edwards isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Edwards[MAX_Alice-1] = { 
+48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2,
+1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 12, 8, 4, 2, 1, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7,
+4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2,
+1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1 };
+
+const unsigned int strat_Bob_Edwards[MAX_Bob-1] = { 
+51, 33, 21, 13, 8, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1,
+1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1,
+1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1, 1, 1, 1,
+1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+1, 1, 18, 12, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 1 };
+
+// Working-set-bounded strategies for the Huff trees, storing at most strat_bounds[i] points and listed in traversal order
+const unsigned int strat_bounds[STRAT_NBOUNDS] = { 4, 6, 8 };
+
+const unsigned int strat_Alice_ws4_Huff[MAX_Alice-1] = { 
+56, 31, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1,
+1, 16, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 8, 4, 3, 2, 1,
+2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 30, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1,
+1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 2,
+1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+1, 1 };
+
+const unsigned int strat_Alice_ws6_Huff[MAX_Alice-1] = { 
+48, 27, 15, 8, 6, 3, 2, 1, 3, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7,
+4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1,
+1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7,
+4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2,
+1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1 };
+
+const unsigned int strat_Alice_ws8_Huff[MAX_Alice-1] = { 
+43, 28, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2,
+1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1,
+1, 1, 16, 11, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+1, 1 };
+
+const unsigned int strat_Bob_ws4_Huff[MAX_Bob-1] = { 
+77, 38, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2,
+1, 1, 22, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 11, 7, 3,
+2, 1, 4, 2, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 41, 21, 10,
+4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1,
+1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 20, 11, 6, 3, 2, 1, 3, 2, 1,
+1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1,
+1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Bob_ws6_Huff[MAX_Bob-1] = { 
+60, 36, 20, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1,
+1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1,
+16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7,
+4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 24, 16, 9, 5, 3, 2, 1,
+1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2,
+1, 1, 3, 2, 1, 1, 1, 1, 9, 6, 4, 2, 1, 1, 1, 2, 1, 1, 2, 2, 1,
+1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Bob_ws8_Huff[MAX_Bob-1] = { 
+55, 33, 20, 12, 7, 4, 3, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5,
+3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+1, 3, 2, 1, 1, 1, 1, 1, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 22, 13,
+8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+// Measured costs of the kernels of the Huff trees in the Huff and Montgomery models (columns MODEL_HUFF, MODEL_MONT),
+// the hybrid traversals (HYBRID_MODELS) run each kernel in the cheaper model
+const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { 
+{ 41849, 42836 }, { 27494, 28096 }, { 34653, 42300 }, { 20585, 20719 } };
+
+
+// Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
+#define fpcopy                        fpcopy434
+#define fpzero                        fpzero434
+#define fpadd                         fpadd434
+#define fpsub                         fpsub434
+#define fpneg                         fpneg434
+#define fpdiv2                        fpdiv2_434
+#define fpcorrection                  fpcorrection434
+#define fpmul_mont                    fpmul434_mont
+#define fpsqr_mont                    fpsqr434_mont
+#define fpinv_mont                    fpinv434_mont
+#define fpinv_chain_mont              fpinv434_chain_mont
+#define fpinv_mont_bingcd             fpinv434_mont_bingcd
+#define fp2copy                       fp2copy434
+#define fp2zero                       fp2zero434
+#define fp2add                        fp2add434
+#define fp2sub                        fp2sub434
+#define mp_sub_p2                     mp_sub434_p2
+#define mp_sub_p4                     mp_sub434_p4
+#define sub_p4                        mp_sub_p4
+#define fp2neg                        fp2neg434
+#define fp2div2                       fp2div2_434
+#define fp2correction                 fp2correction434
+#define fp2mul_mont                   fp2mul434_mont
+#define fp2sqr_mont                   fp2sqr434_mont
+#define fp2inv_mont                   fp2inv434_mont
+#define fp2inv_mont_bingcd            fp2inv434_mont_bingcd
+#define fpequal_non_constant_time     fpequal434_non_constant_time
+#define mp_add_asm                    mp_add434_asm
+#define mp_subaddx2_asm               mp_subadd434x2_asm
+#define mp_dblsubx2_asm               mp_dblsub434x2_asm
+
+
+#include "../fpx.c"
+#include "../ec_isogeny.c"
+#ifdef COMPRESS
+#include "../pairing.c"
+#include "../dlog.c"
+#include "../torsion_basis.c"
+#endif
+#include "../parallel.c"
+#include "../traverse.c"
+#include "../sidh.c"
+#include "../sike.c"
\ No newline at end of file
@@ -0,0 +1,458 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: reduced Tate pairings on Montgomery curves for the compression of public keys
+*********************************************************************************************/
+
+// The Miller loop of a point P of order n = ell^e is ell-adic: f_{ell^(i+1),P} = f_{ell^i,P}^ell*h_i, where h_i is the function of
+// divisor ell(T) - ([ell]T) - (ell-1)(O) at T = [ell^i]P, normalized at O. It keeps T in Jacobian coordinates (X:Y:Z), x = X/Z^2 and
+// y = Y/Z^3, and each step computes [ell]T and the coefficients of h_i at once:
+//   ell = 2: h = l/v, the tangent l at T over the vertical v at [2]T,
+//   ell = 3: h = g/v, the parabola g with a triple zero at T over the vertical v at [3]T,
+//   ell = 5: h = g*l/m, the parabola g times the tangent l at T over the line m through -[2]T and -[3]T, which meets E at [5]T.
+// The value f = num/den of the Miller function at every second argument Q is kept as f*den*conj(den) = num*conj(den), up to a factor
+// of GF(p) that the final exponentiation cancels, so that a step costs one evaluation of each factor and no inversion. The factors
+// are evaluated with denominators cleared, which scales h_i by Z_i^ell/Z_(i+1) for the coordinate Z_i of [ell^i]P; the scalings
+// telescope to 1/Z of the last point, which the last step compensates. The pairings of one first argument thus share the point
+// arithmetic of their Miller loop, and the final exponentiations share one inversion.
+
+typedef struct {
+    f2elm_t g[4];                       // g = g[0] + g[1]*x + g[2]*y + g[3]*x^2, with ng terms past g[0]
+    f2elm_t l[3];                       // l = l[0] + l[1]*x + l[2]*y, with nl terms past l[0], l = 1 if nl = 0
+    f2elm_t v[3];                       // conj(v) = v[0] + v[1]*conj(x) + v[2]*conj(y), with nv terms past v[0], v = 1 if nv = 0
+    unsigned int ng, nl, nv;
+} miller_fn_t;
+
+
+static void miller_dbl(point_full_proj_t T, const f2elm_t A, miller_fn_t* h)
+{ // Doubling step: T = [2]T, and h = l/v for the tangent l at T and the vertical v at [2]T
+    f2elm_t t0, t1, ZZ, YY, Nn, D, X2;
+
+    fp2sqr_mont(T->Z, ZZ);                // ZZ = Z^2
+    fp2mul_mont(T->X, ZZ, t0);
+    fp2mul_mont(A, t0, t0);
+    fp2add(t0, t0, Nn);                   // Nn = 2*A*X*Z^2
+    fp2sqr_mont(ZZ, t0);
+    fp2add(Nn, t0, Nn);
+    fp2sqr_mont(T->X, t0);
+    fp2add(Nn, t0, Nn);
+    fp2add(t0, t0, t0);
+    fp2add(Nn, t0, Nn);                   // Nn = 3*X^2 + 2*A*X*Z^2 + Z^4
+    fp2mul_mont(T->Y, T->Z, D);
+    fp2add(D, D, D);                      // D = 2*Y*Z, slope = Nn/D
+    fp2sqr_mont(T->Y, YY);                // YY = Y^2
+
+    // l = D*Z^2*(y - Y/Z^3 - slope*(x - X/Z^2)) = (Nn*X - 2*Y^2) - Nn*Z^2*x + D*Z^2*y
+    fp2mul_mont(Nn, T->X, t0);
+    fp2sub(t0, YY, t0);
+    fp2sub(t0, YY, h->g[0]);
+    fp2mul_mont(Nn, ZZ, h->g[1]);
+    fp2neg(h->g[1]);
+    fp2mul_mont(D, ZZ, h->g[2]);
+    h->ng = 2;
+    h->nl = 0;
+
+    fp2mul_mont(T->X, YY, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);                   // t1 = 4*X*Y^2
+    fp2sqr_mont(D, t0);
+    fp2_conj(t0, h->v[1]);
+    fp2mul_mont(A, t0, t0);
+    fp2sqr_mont(Nn, X2);
+    fp2sub(X2, t0, X2);
+    fp2sub(X2, t1, X2);
+    fp2sub(X2, t1, X2);                   // X2 = Nn^2 - A*D^2 - 8*X*Y^2
+    fp2sub(t1, X2, t1);
+    fp2mul_mont(Nn, t1, t1);
+    fp2sqr_mont(YY, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);
+    fp2sub(t1, t0, T->Y);                 // Y2 = Nn*(4*X*Y^2 - X2) - 8*Y^4
+    fp2copy(X2, T->X);
+    fp2copy(D, T->Z);                     // Z2 = D
+
+    // v = D^2*x - X2, conj(v) = -conj(X2) + conj(D^2)*conj(x)
+    fp2_conj(X2, h->v[0]);
+    fp2neg(h->v[0]);
+    h->nv = 1;
+}
+
+
+static void miller_tpl(point_full_proj_t T, const f2elm_t A, miller_fn_t* h)
+{ // Tripling step: T = [3]T, and h = g/v for the parabola g with a triple zero at T and the vertical v at [3]T. With slope = Nn/D
+  // and the second derivative 2*Kn*Z^4/D^3 of y at T, g = y - Y/Z^3 - slope*(x - X/Z^2) - Kn*Z^4/D^3*(x - X/Z^2)^2 vanishes at -[3]T
+    f2elm_t t0, t1, ZZ, Z4, YY, Y4, Nn, Kn, NK, V, D, X3, Z3;
+
+    fp2sqr_mont(T->Z, ZZ);                // ZZ = Z^2
+    fp2sqr_mont(ZZ, Z4);                  // Z4 = Z^4
+    fp2sqr_mont(T->Y, YY);                // YY = Y^2
+    fp2sqr_mont(YY, Y4);
+    fp2add(Y4, Y4, Y4);
+    fp2add(Y4, Y4, Y4);
+    fp2add(Y4, Y4, Y4);                   // Y4 = 8*Y^4
+    fp2mul_mont(T->X, ZZ, t0);
+    fp2mul_mont(A, t0, t0);
+    fp2add(t0, t0, Nn);
+    fp2add(Nn, Z4, Nn);
+    fp2sqr_mont(T->X, t0);
+    fp2add(Nn, t0, Nn);
+    fp2add(t0, t0, t0);
+    fp2add(Nn, t0, Nn);                   // Nn = 3*X^2 + 2*A*X*Z^2 + Z^4
+    fp2mul_mont(A, ZZ, t0);
+    fp2add(t0, T->X, t0);
+    fp2add(t0, T->X, t0);
+    fp2add(t0, T->X, t0);
+    fp2mul_mont(t0, YY, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);
+    fp2sqr_mont(Nn, t1);
+    fp2sub(t0, t1, Kn);                   // Kn = 4*Y^2*(3*X + A*Z^2) - Nn^2
+    fp2mul_mont(Nn, Kn, NK);              // NK = Nn*Kn
+    fp2sub(Y4, NK, V);                    // V = 8*Y^4 - Nn*Kn
+
+    // g*D^3 = (4*Y^2*Nn*X - Kn*X^2 - 8*Y^4) + Z^2*(2*Kn*X - 4*Y^2*Nn)*x + D^3*y - Kn*Z^4*x^2, with D = 2*Y*Z
+    fp2mul_mont(YY, Nn, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);                   // t0 = 4*Y^2*Nn
+    fp2mul_mont(Kn, T->X, t1);            // t1 = Kn*X
+    fp2sub(t0, t1, h->g[0]);
+    fp2mul_mont(h->g[0], T->X, h->g[0]);
+    fp2sub(h->g[0], Y4, h->g[0]);
+    fp2add(t1, t1, t1);
+    fp2sub(t1, t0, t1);
+    fp2mul_mont(t1, ZZ, h->g[1]);
+    fp2mul_mont(T->Y, T->Z, D);
+    fp2add(D, D, D);
+    fp2sqr_mont(D, t0);
+    fp2mul_mont(D, t0, h->g[2]);
+    fp2mul_mont(Kn, Z4, h->g[3]);
+    fp2neg(h->g[3]);
+    h->ng = 3;
+    h->nl = 0;
+
+    fp2sqr_mont(Kn, t0);                  // t0 = Kn^2
+    fp2mul_mont(T->X, t0, X3);
+    fp2mul_mont(YY, V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(X3, t1, X3);                   // X3 = X*Kn^2 + 8*Y^2*V
+    fp2mul_mont(t0, Kn, t0);
+    fp2mul_mont(NK, V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t0, t1, t0);
+    fp2sqr_mont(V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t0, t1, t0);
+    fp2mul_mont(T->Y, t0, T->Y);
+    fp2neg(T->Y);                         // Y3 = -Y*(Kn^3 + 4*Nn*Kn*V + 8*V^2)
+    fp2mul_mont(Kn, T->Z, Z3);            // Z3 = Kn*Z
+    fp2copy(X3, T->X);
+    fp2copy(Z3, T->Z);
+
+    // v = Z3^2*x - X3, conj(v) = -conj(X3) + conj(Z3^2)*conj(x)
+    fp2_conj(X3, h->v[0]);
+    fp2neg(h->v[0]);
+    fp2sqr_mont(Z3, t0);
+    fp2_conj(t0, h->v[1]);
+    h->nv = 1;
+}
+
+
+static void miller_qpl(point_full_proj_t T, const f2elm_t A, miller_fn_t* h)
+{ // Quintupling step: T = [5]T = [2]T + [3]T, and h = g*l/m for the parabola g of the tripling step, the tangent l at T of the doubling
+  // step and the line m through -[2]T and -[3]T
+    f2elm_t t0, t1, ZZ, Z4, YY, Y4, Nn, Kn, NK, V, D, DD, D3, X2, Y2, X3, Y3, Z3, U1, U2, S1, H, R, Z5;
+
+    fp2sqr_mont(T->Z, ZZ);                // ZZ = Z^2
+    fp2sqr_mont(ZZ, Z4);                  // Z4 = Z^4
+    fp2sqr_mont(T->Y, YY);                // YY = Y^2
+    fp2sqr_mont(YY, Y4);
+    fp2add(Y4, Y4, Y4);
+    fp2add(Y4, Y4, Y4);
+    fp2add(Y4, Y4, Y4);                   // Y4 = 8*Y^4
+    fp2mul_mont(T->X, ZZ, t0);
+    fp2mul_mont(A, t0, t0);
+    fp2add(t0, t0, Nn);
+    fp2add(Nn, Z4, Nn);
+    fp2sqr_mont(T->X, t0);
+    fp2add(Nn, t0, Nn);
+    fp2add(t0, t0, t0);
+    fp2add(Nn, t0, Nn);                   // Nn = 3*X^2 + 2*A*X*Z^2 + Z^4
+    fp2mul_mont(T->Y, T->Z, D);
+    fp2add(D, D, D);                      // D = 2*Y*Z
+    fp2sqr_mont(D, DD);
+    fp2mul_mont(D, DD, D3);               // DD = D^2, D3 = D^3
+    fp2mul_mont(A, ZZ, t0);
+    fp2add(t0, T->X, t0);
+    fp2add(t0, T->X, t0);
+    fp2add(t0, T->X, t0);
+    fp2mul_mont(t0, YY, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);
+    fp2sqr_mont(Nn, t1);                  // t1 = Nn^2
+    fp2sub(t0, t1, Kn);                   // Kn = 4*Y^2*(3*X + A*Z^2) - Nn^2
+    fp2mul_mont(Nn, Kn, NK);              // NK = Nn*Kn
+    fp2sub(Y4, NK, V);                    // V = 8*Y^4 - Nn*Kn
+
+    // [2]T = (X2:Y2:D), as in miller_dbl
+    fp2mul_mont(A, DD, t0);
+    fp2sub(t1, t0, X2);
+    fp2mul_mont(T->X, YY, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);                   // t0 = 4*X*Y^2
+    fp2sub(X2, t0, X2);
+    fp2sub(X2, t0, X2);                   // X2 = Nn^2 - A*D^2 - 8*X*Y^2
+    fp2sub(t0, X2, t0);
+    fp2mul_mont(Nn, t0, t0);
+    fp2sub(t0, Y4, Y2);                   // Y2 = Nn*(4*X*Y^2 - X2) - 8*Y^4
+
+    // [3]T = (X3:Y3:Z3), as in miller_tpl
+    fp2sqr_mont(Kn, t0);
+    fp2mul_mont(T->X, t0, X3);
+    fp2mul_mont(YY, V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(X3, t1, X3);                   // X3 = X*Kn^2 + 8*Y^2*V
+    fp2mul_mont(t0, Kn, t0);
+    fp2mul_mont(NK, V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t0, t1, t0);
+    fp2sqr_mont(V, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t1, t1, t1);
+    fp2add(t0, t1, t0);
+    fp2mul_mont(T->Y, t0, Y3);
+    fp2neg(Y3);                           // Y3 = -Y*(Kn^3 + 4*Nn*Kn*V + 8*V^2)
+    fp2mul_mont(Kn, T->Z, Z3);            // Z3 = Kn*Z
+
+    // g*D^3, as in miller_tpl
+    fp2mul_mont(YY, Nn, t0);
+    fp2add(t0, t0, t0);
+    fp2add(t0, t0, t0);                   // t0 = 4*Y^2*Nn
+    fp2mul_mont(Kn, T->X, t1);            // t1 = Kn*X
+    fp2sub(t0, t1, h->g[0]);
+    fp2mul_mont(h->g[0], T->X, h->g[0]);
+    fp2sub(h->g[0], Y4, h->g[0]);
+    fp2add(t1, t1, t1);
+    fp2sub(t1, t0, t1);
+    fp2mul_mont(t1, ZZ, h->g[1]);
+    fp2copy(D3, h->g[2]);
+    fp2mul_mont(Kn, Z4, h->g[3]);
+    fp2neg(h->g[3]);
+    h->ng = 3;
+
+    // l*D*Z^2, as in miller_dbl, scaled by D^2*conj(Z3) so that h is scaled by Z^5/Z5
+    fp2_conj(Z3, t0);
+    fp2mul_mont(DD, t0, t0);
+    fp2mul_mont(Nn, T->X, t1);
+    fp2sub(t1, YY, t1);
+    fp2sub(t1, YY, t1);
+    fp2mul_mont(t1, t0, h->l[0]);
+    fp2mul_mont(Nn, ZZ, t1);
+    fp2neg(t1);
+    fp2mul_mont(t1, t0, h->l[1]);
+    fp2mul_mont(D, ZZ, t1);
+    fp2mul_mont(t1, t0, h->l[2]);
+    h->nl = 2;
+
+    // [5]T = [2]T + [3]T, with the slope R/Z5 of the line through [2]T and [3]T
+    fp2sqr_mont(Z3, t0);
+    fp2mul_mont(X2, t0, U1);              // U1 = X2*Z3^2
+    fp2mul_mont(t0, Z3, t0);
+    fp2mul_mont(Y2, t0, S1);              // S1 = Y2*Z3^3
+    fp2mul_mont(X3, DD, U2);              // U2 = X3*D^2
+    fp2mul_mont(Y3, D3, R);
+    fp2sub(R, S1, R);                     // R = Y3*D^3 - S1
+    fp2sub(U2, U1, H);                    // H = U2 - U1
+    fp2mul_mont(H, D, Z5);
+    fp2mul_mont(Z5, Z3, Z5);              // Z5 = H*D*Z3
+
+    // m = Z5*D^3*(y + Y2/D^3 + R/Z5*(x - X2/D^2)) = (Y2*Z5 - R*D*X2) + R*D^3*x + Z5*D^3*y
+    fp2mul_mont(Y2, Z5, t0);
+    fp2mul_mont(R, D, t1);
+    fp2mul_mont(t1, X2, t1);
+    fp2sub(t0, t1, t0);
+    fp2_conj(t0, h->v[0]);
+    fp2mul_mont(R, D3, t0);
+    fp2_conj(t0, h->v[1]);
+    fp2mul_mont(Z5, D3, t0);
+    fp2_conj(t0, h->v[2]);
+    h->nv = 2;
+
+    fp2sqr_mont(H, t1);                   // t1 = H^2
+    fp2add(U1, U2, t0);
+    fp2mul_mont(t0, t1, t0);
+    fp2sqr_mont(Z5, T->X);
+    fp2mul_mont(A, T->X, T->X);
+    fp2add(T->X, t0, T->X);
+    fp2sqr_mont(R, t0);
+    fp2sub(t0, T->X, T->X);               // X5 = R^2 - A*Z5^2 - H^2*(U1 + U2)
+    fp2mul_mont(U1, t1, t0);
+    fp2sub(t0, T->X, t0);
+    fp2mul_mont(R, t0, t0);
+    fp2mul_mont(t1, H, t1);
+    fp2mul_mont(S1, t1, t1);
+    fp2sub(t0, t1, T->Y);                 // Y5 = R*(U1*H^2 - X5) - S1*H^3
+    fp2copy(Z5, T->Z);
+}
+
+
+static void miller_last(const point_full_proj_t T, const f2elm_t A, const unsigned int ell, miller_fn_t* h)
+{ // Last step, at T of order ell: h = x - X/Z^2 for ell = 2, h is the tangent at T for ell = 3, and h = g*l/v for the parabola g and
+  // the tangent l at T and the vertical v at [2]T = -[3]T for ell = 5. The scaling of h compensates the factor 1/Z that the previous
+  // steps leave on f, up to a factor of GF(p)
+    point_full_proj_t R;
+    miller_fn_t h2;
+    f2elm_t t0;
+    unsigned int i;
+
+    if (ell == 2) {
+        fp2copy(T->X, h->g[0]);
+        fp2neg(h->g[0]);
+        fp2sqr_mont(T->Z, h->g[1]);       // h = Z^2*x - X
+        h->ng = 1;
+        h->nl = 0;
+        h->nv = 0;
+        return;
+    }
+    fp2copy(T->X, R->X);
+    fp2copy(T->Y, R->Y);
+    fp2copy(T->Z, R->Z);
+    if (ell == 3) {
+        miller_dbl(R, A, h);              // h = D*Z^2*tangent, scaled by Z*conj(D)
+        fp2_conj(R->Z, t0);
+        fp2mul_mont(t0, T->Z, t0);
+        h->nv = 0;
+    } else {
+        miller_dbl(R, A, &h2);            // h2 = D*Z^2*tangent/(D^2*vertical), R = [2]T
+        fp2copy(R->Z, t0);                // t0 = D
+        fp2copy(T->X, R->X);
+        fp2copy(T->Y, R->Y);
+        fp2copy(T->Z, R->Z);
+        miller_tpl(R, A, h);              // h = D^3*parabola, scaled by D*conj(Kn*Z), R = [3]T
+        for (i = 0; i < 3; i++) {
+            fp2copy(h2.g[i], h->l[i]);
+        }
+        fp2copy(h2.v[0], h->v[0]);
+        fp2copy(h2.v[1], h->v[1]);
+        h->nl = 2;
+        h->nv = 1;
+        fp2_conj(R->Z, R->Z);
+        fp2mul_mont(t0, R->Z, t0);
+    }
+    for (i = 0; i <= h->ng; i++) {
+        fp2mul_mont(h->g[i], t0, h->g[i]);
+    }
+}
+
+
+static void miller_term(const f2elm_t* c, const unsigned int n, const f2elm_t* m, f2elm_t r)
+{ // r = c[0] + c[1]*m[0] + ... + c[n]*m[n-1]
+    f2elm_t t0;
+    unsigned int i;
+
+    fp2copy(c[0], r);
+    for (i = 0; i < n; i++) {
+        fp2mul_mont(c[i+1], m[i], t0);
+        fp2add(r, t0, r);
+    }
+}
+
+
+static void miller_eval(const miller_fn_t* h, const f2elm_t* m, const unsigned int ell, f2elm_t f)
+{ // f = f^ell*g(Q)*l(Q)*conj(v(Q)), for the monomials m = {x, y, x^2, conj(x), conj(y)} of Q
+    f2elm_t t0, t1;
+
+    miller_term(h->g, h->ng, m, t0);
+    if (h->nl != 0) {
+        miller_term(h->l, h->nl, m, t1);
+        fp2mul_mont(t0, t1, t0);
+    }
+    if (h->nv != 0) {
+        miller_term(h->v, h->nv, m + 3, t1);
+        fp2mul_mont(t0, t1, t0);
+    }
+    fp2sqr_mont(f, t1);
+    if (ell == 5) {
+        fp2sqr_mont(t1, t1);
+    }
+    if (ell != 2) {
+        fp2mul_mont(t1, f, t1);
+    }
+    fp2mul_mont(t1, t0, f);
+}
+
+
+int tate_pairings(const point_t* P, const unsigned int nP, const point_t* Q, const unsigned int nQ, const f2elm_t A, const torsion_t* T, f2elm_t* t)
+{ // Reduced Tate pairings t[i*nQ + j] = t(P[i], Q[j]) = f_{n,P[i]}(Q[j])^((p^2-1)/n) of order n = ell^e, for i < nP and j < nQ, with
+  // nP*nQ <= MAX_PAIRINGS, for points P[i] and Q[j] of E_A[n] in affine coordinates, where f_{n,P} is the Miller function with divisor
+  // n(P) - n(O). The pairing is bilinear and alternating on E_A[n]. The pairings of each P[i] share one Miller loop.
+  // Returns 1 if a Miller function vanishes at a point Q[j], which only happens if Q[j] is a multiple of P[i].
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public values.
+    point_full_proj_t R;
+    miller_fn_t h;
+    f2elm_t f[MAX_PAIRINGS], m[MAX_PAIRINGS][5], inv[MAX_PAIRINGS];
+    felm_t one = {0};
+    unsigned int i, j, k, s;
+
+    fpcopy((digit_t*)&Montgomery_one, one);
+    for (j = 0; j < nQ; j++) {
+        fp2copy(Q[j]->x, m[j][0]);
+        fp2copy(Q[j]->y, m[j][1]);
+        fp2sqr_mont(Q[j]->x, m[j][2]);
+        fp2_conj(Q[j]->x, m[j][3]);
+        fp2_conj(Q[j]->y, m[j][4]);
+    }
+    for (i = 0; i < nP; i++) {
+        k = i*nQ;                         // f[k+j] = f_{ell^s,P[i]}(Q[j])
+        for (j = 0; j < nQ; j++) {
+            fp2zero(f[k+j]);
+            fpcopy(one, f[k+j][0]);
+        }
+        fp2copy(P[i]->x, R->X);
+        fp2copy(P[i]->y, R->Y);
+        fp2zero(R->Z);
+        fpcopy(one, R->Z[0]);
+
+        for (s = 1; s < T->e; s++) {
+            if (T->ell == 2) {
+                miller_dbl(R, A, &h);
+            } else if (T->ell == 3) {
+                miller_tpl(R, A, &h);
+            } else {
+                miller_qpl(R, A, &h);
+            }
+            for (j = 0; j < nQ; j++) {
+                miller_eval(&h, m[j], T->ell, f[k+j]);
+            }
+        }
+        miller_last(R, A, T->ell, &h);
+        for (j = 0; j < nQ; j++) {
+            miller_eval(&h, m[j], T->ell, f[k+j]);
+        }
+    }
+
+    // Final exponentiations: f^(p-1) = conj(f)/f has norm 1, and is then raised to (p+1)/n
+    for (k = 0; k < nP*nQ; k++) {
+        if (is_fp2_zero(f[k])) {
+            return 1;
+        }
+    }
+    mont_n_way_inv(f, nP*nQ, inv);
+    for (k = 0; k < nP*nQ; k++) {
+        fp2_conj(f[k], t[k]);
+        fp2mul_mont(t[k], inv[k], t[k]);
+        exp_ell_Fp2_cycl(t[k], 2, (T->ell == 2) ? 0 : EXPON_2, one);
+        exp_ell_Fp2_cycl(t[k], 3, (T->ell == 3) ? 0 : EXPON_3, one);
+        exp_ell_Fp2_cycl(t[k], 5, (T->ell == 5) ? 0 : EXPON_5, one);
+    }
+    return 0;
+}
@@ -0,0 +1,1281 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: ephemeral supersingular isogeny Diffie-Hellman key exchange (SIDH)
+*********************************************************************************************/ 
+
+#include "random/random.h"
+
+// Strategies used by the Huff tree traversals
+#ifdef PARALLEL_TRAVERSAL
+    #define STRAT_ALICE_HUFF           strat_Alice_par_Huff
+    #define STRAT_BOB_HUFF             strat_Bob_par_Huff
+#else
+    #define STRAT_ALICE_HUFF           strat_Alice_Huff
+    #define STRAT_BOB_HUFF             strat_Bob_Huff
+#endif
+
+// Working-set bound of the Huff traversals, set with "make MAXPTS=k" (see EphemeralKeyGeneration_A_Huff_bounded() and friends)
+#if !defined(STRATEGY_MAX_POINTS)
+    #define STRATEGY_MAX_POINTS        TRAVERSE_MAX_POINTS          // No bound
+#endif
+
+static const unsigned int* const strat_Alice_ws_Huff[STRAT_NBOUNDS] = { strat_Alice_ws4_Huff, strat_Alice_ws6_Huff, strat_Alice_ws8_Huff };
+static const unsigned int* const strat_Bob_ws_Huff[STRAT_NBOUNDS] = { strat_Bob_ws4_Huff, strat_Bob_ws6_Huff, strat_Bob_ws8_Huff };
+
+static void init_basis(digit_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
+{ // Initialization of basis points
+    
+    fpcopy(gen,                  XP[0]);
+    fpcopy(gen +   NWORDS_FIELD, XP[1]);
+    fpcopy(gen + 2*NWORDS_FIELD, XQ[0]);
+    fpcopy(gen + 3*NWORDS_FIELD, XQ[1]);
+    fpcopy(gen + 4*NWORDS_FIELD, XR[0]);
+    fpcopy(gen + 5*NWORDS_FIELD, XR[1]);
+}
+
+
+static int validate_pk(const unsigned char* PublicKey)
+{ // Validation of an encoded public key, before any ladder or isogeny computation and in time independent of its value.
+  // Returns 0 if its six elements of GF(p) are encoded below p and its three x- or w-coordinates are nonzero and pairwise
+  // distinct, as for every honest public key, 1 otherwise.
+    felm_t a, t;
+    digit_t nonzero;
+    unsigned char diff[3] = {0};
+    unsigned int i, j, k, valid = 1;
+
+    for (i = 0; i < 3; i++) {
+        nonzero = 0;
+        for (j = 0; j < 2; j++) {
+            decode_to_digits(PublicKey + i*FP2_ENCODED_BYTES + j*(FP2_ENCODED_BYTES/2), a, FP2_ENCODED_BYTES/2, NWORDS_FIELD);
+            valid &= mp_sub(a, (digit_t*)PRIME, t, NWORDS_FIELD);    // Borrow iff a < p
+            for (k = 0; k < NWORDS_FIELD; k++) {
+                nonzero |= a[k];
+            }
+        }
+        valid &= (nonzero != 0);
+    }
+
+    // The encodings are canonical, so equal coordinates have equal encodings
+    for (k = 0; k < FP2_ENCODED_BYTES; k++) {
+        diff[0] |= PublicKey[k] ^ PublicKey[k + FP2_ENCODED_BYTES];
+        diff[1] |= PublicKey[k] ^ PublicKey[k + 2*FP2_ENCODED_BYTES];
+        diff[2] |= PublicKey[k + FP2_ENCODED_BYTES] ^ PublicKey[k + 2*FP2_ENCODED_BYTES];
+    }
+    valid &= (diff[0] != 0) & (diff[1] != 0) & (diff[2] != 0);
+
+    return (int)(valid ^ 1);
+}
+
+
+void random_mod_order_A(unsigned char* random_digits)
+{  // Generation of Alice's secret key  
+   // Outputs random value in [0, 2^eA - 1]
+
+    randombytes(random_digits, SECRETKEY_A_BYTES);
+    random_digits[SECRETKEY_A_BYTES-1] &= MASK_ALICE;    // Masking last byte 
+}
+
+
+void random_mod_order_B(unsigned char* random_digits)
+{  // Generation of Bob's secret key  
+   // Outputs random value in [0, 2^Floor(Log(2, oB)) - 1]
+
+    randombytes(random_digits, SECRETKEY_B_BYTES);
+    random_digits[SECRETKEY_B_BYTES-1] &= MASK_BOB;     // Masking last byte 
+}
+
+
+// Kernel sets of the isogeny tree traversals (see traverse.c)
+
+static void mul_4_isog(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (A24plus, C24)
+    xDBLe(P, Q, curve[0], curve[1], 2*e);
+}
+
+static void get_4_isog_step(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_4_isog(R, curve[0], curve[1], coeff);
+}
+
+static void mul_3_isog(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (A24minus, A24plus)
+    xTPLe(P, Q, curve[0], curve[1], e);
+}
+
+static void get_3_isog_step(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_3_isog(R, curve[0], curve[1], coeff);
+}
+
+static void mul_4_isog_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (CmDsq, CD4) = ((C-D)^2, 4CD)
+    xDBLe_Huff(P, Q, curve[0], curve[1], 2*e);
+}
+
+static void get_4_isog_step_Huff(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_4_isog_Huff(R, curve[0], curve[1], coeff);
+}
+
+static void mul_3_isog_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (A24minus, A24plus) = ((C-D)^2, (C+D)^2)
+    xTPLe_Huff(P, Q, curve[0], curve[1], e);
+}
+
+static void get_3_isog_step_Huff(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_3_isog_Huff(R, curve[0], curve[1], coeff);
+}
+
+static const isog_kernels_t isog4 = { mul_4_isog, get_4_isog_step, eval_4_isog, 3 };
+static const isog_kernels_t isog3 = { mul_3_isog, get_3_isog_step, eval_3_isog, 2 };
+static const isog_kernels_t isog4_Huff = { mul_4_isog_Huff, get_4_isog_step_Huff, eval_4_isog_Huff, 3 };
+static const isog_kernels_t isog3_Huff = { mul_3_isog_Huff, get_3_isog_step_Huff, eval_3_isog_Huff, 2 };
+
+// Twisted Edwards kernels: the same curve constants as the Montgomery kernels, points in y-coordinates
+
+static void mul_4_isog_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (a, a-d) = (A24plus, C24)
+    xDBLe_Edwards(P, Q, curve[0], curve[1], 2*e);
+}
+
+static void get_4_isog_step_Edwards(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_4_isog_Edwards(R, curve[0], curve[1], coeff);
+}
+
+static void mul_3_isog_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (d, a) = (A24minus, A24plus)
+    xTPLe_Edwards(P, Q, curve[0], curve[1], e);
+}
+
+static void get_3_isog_step_Edwards(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{
+    get_3_isog_Edwards(R, curve[0], curve[1], coeff);
+}
+
+static const isog_kernels_t isog4_Edwards = { mul_4_isog_Edwards, get_4_isog_step_Edwards, eval_4_isog_Edwards, 3 };
+static const isog_kernels_t isog3_Edwards = { mul_3_isog_Edwards, get_3_isog_step_Edwards, eval_3_isog_Edwards, 2 };
+
+#ifdef HYBRID_MODELS
+// Hybrid kernels: the points stay in Huff w-coordinates and are mapped to Montgomery x-coordinates (w = 1/x) around each Montgomery kernel
+
+static void mul_4_isog_Mont_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (CmDsq, CD4), mapped to the Montgomery constants (A24plus, C24)
+    f2elm_t A24plus, C24;
+
+    huff_to_mont_curve(curve[0], curve[1], A24plus, C24);
+    map_mont_huff(P, Q);
+    xDBLe(Q, Q, A24plus, C24, 2*e);
+    map_mont_huff(Q, Q);
+}
+
+static void get_4_isog_step_Mont_Huff(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{ // Coefficients for eval_4_isog_Mont_Huff(). The codomain constants (A24plus, C24) are mapped back to (CmDsq, CD4) = (A24plus-C24, C24)
+    point_proj_t T;
+
+    map_mont_huff(R, T);
+    get_4_isog(T, curve[0], curve[1], coeff);
+    fp2sub(curve[0], curve[1], curve[0]);
+}
+
+static void eval_4_isog_Mont_Huff(point_proj_t Q, const f2elm_t* coeff)
+{
+    map_mont_huff(Q, Q);
+    eval_4_isog(Q, coeff);
+    map_mont_huff(Q, Q);
+}
+
+static void mul_3_isog_Mont_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e)
+{ // curve = (A24minus, A24plus), shared by the Huff curve and its Montgomery curve
+    map_mont_huff(P, Q);
+    xTPLe(Q, Q, curve[0], curve[1], e);
+    map_mont_huff(Q, Q);
+}
+
+static void get_3_isog_step_Mont_Huff(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff)
+{ // Coefficients for eval_3_isog_Mont_Huff()
+    point_proj_t T;
+
+    map_mont_huff(R, T);
+    get_3_isog(T, curve[0], curve[1], coeff);
+}
+
+static void eval_3_isog_Mont_Huff(point_proj_t Q, const f2elm_t* coeff)
+{
+    map_mont_huff(Q, Q);
+    eval_3_isog(Q, coeff);
+    map_mont_huff(Q, Q);
+}
+
+// Kernel sets indexed by [model of the multiplications][model of the isogeny computations and evaluations]
+static const isog_kernels_t isog4_hybrid[2][2] = {{{ mul_4_isog_Huff, get_4_isog_step_Huff, eval_4_isog_Huff, 3 },
+                                                   { mul_4_isog_Huff, get_4_isog_step_Mont_Huff, eval_4_isog_Mont_Huff, 3 }},
+                                                  {{ mul_4_isog_Mont_Huff, get_4_isog_step_Huff, eval_4_isog_Huff, 3 },
+                                                   { mul_4_isog_Mont_Huff, get_4_isog_step_Mont_Huff, eval_4_isog_Mont_Huff, 3 }}};
+static const isog_kernels_t isog3_hybrid[2][2] = {{{ mul_3_isog_Huff, get_3_isog_step_Huff, eval_3_isog_Huff, 2 },
+                                                   { mul_3_isog_Huff, get_3_isog_step_Mont_Huff, eval_3_isog_Mont_Huff, 2 }},
+                                                  {{ mul_3_isog_Mont_Huff, get_3_isog_step_Huff, eval_3_isog_Huff, 2 },
+                                                   { mul_3_isog_Mont_Huff, get_3_isog_step_Mont_Huff, eval_3_isog_Mont_Huff, 2 }}};
+
+static unsigned int cheaper_model(const unsigned int kernel)
+{ // Model in which the kernel is cheaper according to hybrid_costs
+    return (hybrid_costs[kernel][MODEL_MONT] < hybrid_costs[kernel][MODEL_HUFF]) ? MODEL_MONT : MODEL_HUFF;
+}
+
+    #define KERNELS_ALICE_HUFF         (&isog4_hybrid[cheaper_model(HYBRID_ALICE_MUL)][cheaper_model(HYBRID_ALICE_EVAL)])
+    #define KERNELS_BOB_HUFF           (&isog3_hybrid[cheaper_model(HYBRID_BOB_MUL)][cheaper_model(HYBRID_BOB_EVAL)])
+#else
+    #define KERNELS_ALICE_HUFF         (&isog4_Huff)
+    #define KERNELS_BOB_HUFF           (&isog3_Huff)
+#endif
+
+
+int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPA, XQA, XRA, curve[2] = {0}, A = {0};     // curve = (A24plus, C24)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+
+    // Initialize basis points
+    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
+    init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    fpcopy((digit_t*)&Montgomery_one, curve[0][0]);
+    mp2_add(curve[0], curve[0], curve[0]);
+    mp2_add(curve[0], curve[0], curve[1]);
+    mp2_add(curve[0], curve[1], A);
+    mp2_add(curve[1], curve[1], curve[0]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);       
+
+    // Traverse tree
+    traverse_tree(&isog4, DEFAULT_SCHEDULER, strat_Alice, STRAT_LAYOUT, MAX_Alice, R, curve, phi, 3);
+
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+                
+    // Format public key                   
+    fp2_encode(phiP->X, PublicKeyA);
+    fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPB, XQB, XRB, curve[2] = {0}, A = {0};     // curve = (A24minus, A24plus)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+
+    // Initialize basis points
+    init_basis((digit_t*)B_gen, XPB, XQB, XRB);
+    init_basis((digit_t*)A_gen, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+
+    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
+    fpcopy((digit_t*)&Montgomery_one, curve[1][0]);
+    mp2_add(curve[1], curve[1], curve[1]);
+    mp2_add(curve[1], curve[1], curve[0]);
+    mp2_add(curve[1], curve[0], A);
+    mp2_add(curve[0], curve[0], curve[1]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+    
+    // Traverse tree
+    traverse_tree(&isog3, DEFAULT_SCHEDULER, strat_Bob, STRAT_LAYOUT, MAX_Bob, R, curve, phi, 3);
+
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+
+    // Format public key
+    fp2_encode(phiP->X, PublicKeyB);
+    fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // Returns 1 if PublicKeyB is rejected by validate_pk(), before any ladder or isogeny computation.
+    point_proj_t R;
+    f2elm_t PKB[3], jinv;
+    f2elm_t curve[2] = {0}, A = {0};                     // curve = (A24plus, C24)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+      
+    if (validate_pk(PublicKeyB) != 0) {
+        return 1;
+    }
+
+    // Initialize images of Bob's basis
+    fp2_decode(PublicKeyB, PKB[0]);
+    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
+    get_A(PKB[0], PKB[1], PKB[2], A);
+
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, curve[1][0], NWORDS_FIELD);
+    mp2_add(A, curve[1], curve[0]);
+    mp_add(curve[1][0], curve[1][0], curve[1][0], NWORDS_FIELD);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);    
+
+    // Traverse tree
+    traverse_tree(&isog4, DEFAULT_SCHEDULER, strat_Alice, STRAT_LAYOUT, MAX_Alice, R, curve, NULL, 0);
+
+    mp2_add(curve[0], curve[0], curve[0]);                                                
+    fp2sub(curve[0], curve[1], curve[0]); 
+    fp2add(curve[0], curve[0], curve[0]);                    
+    j_inv(curve[0], curve[1], jinv);
+    fp2_encode(jinv, SharedSecretA);    // Format shared secret
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // Returns 1 if PublicKeyA is rejected by validate_pk(), before any ladder or isogeny computation.
+    point_proj_t R;
+    f2elm_t PKB[3], jinv;
+    f2elm_t curve[2] = {0}, A = {0};                     // curve = (A24minus, A24plus)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+      
+    if (validate_pk(PublicKeyA) != 0) {
+        return 1;
+    }
+
+    // Initialize images of Alice's basis
+    fp2_decode(PublicKeyA, PKB[0]);
+    fp2_decode(PublicKeyA + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyA + 2*FP2_ENCODED_BYTES, PKB[2]);
+
+    // Initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
+    get_A(PKB[0], PKB[1], PKB[2], A);
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, curve[0][0], NWORDS_FIELD);
+    mp2_add(A, curve[0], curve[1]);
+    mp2_sub_p2(A, curve[0], curve[0]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A);
+
+    // Traverse tree
+    traverse_tree(&isog3, DEFAULT_SCHEDULER, strat_Bob, STRAT_LAYOUT, MAX_Bob, R, curve, NULL, 0);
+
+    fp2add(curve[1], curve[0], A);                 
+    fp2add(A, A, A);
+    fp2sub(curve[1], curve[0], curve[1]);                   
+    j_inv(A, curve[1], jinv);
+    fp2_encode(jinv, SharedSecretB);    // Format shared secret
+
+    return 0;
+}
+
+// TWISTED EDWARDS SIDH
+// The trees are traversed in Edwards y-coordinates with the strat_*_Edwards strategies, measured on the Edwards kernels by "make strategies".
+// The public keys are the Montgomery x-coordinates of the images of the basis points, so that both models interoperate through the same
+// public keys and j-invariants.
+
+int EphemeralKeyGeneration_A_Edwards(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation using twisted Edwards 4-isogenies
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPA, XQA, XRA, curve[2] = {0}, A = {0};     // curve = (a, a-d)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+
+    // Initialize basis points
+    init_basis((digit_t*)A_gen, XPA, XQA, XRA);
+    init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+    map_mont_edwards(phiP, phiP);
+    map_mont_edwards(phiQ, phiQ);
+    map_mont_edwards(phiR, phiR);
+
+    // Initialize constants: a = A+2C, a-d = 4C, where A=6, C=1
+    fpcopy((digit_t*)&Montgomery_one, curve[0][0]);
+    mp2_add(curve[0], curve[0], curve[0]);
+    mp2_add(curve[0], curve[0], curve[1]);
+    mp2_add(curve[0], curve[1], A);
+    mp2_add(curve[1], curve[1], curve[0]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);       
+    map_mont_edwards(R, R);
+
+    // Traverse tree
+    traverse_tree(&isog4_Edwards, DEFAULT_SCHEDULER, strat_Alice_Edwards, STRAT_LAYOUT, MAX_Alice, R, curve, phi, 3);
+
+    map_edwards_mont(phiP, phiP);
+    map_edwards_mont(phiQ, phiQ);
+    map_edwards_mont(phiR, phiR);
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+                
+    // Format public key                   
+    fp2_encode(phiP->X, PublicKeyA);
+    fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int EphemeralKeyGeneration_B_Edwards(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation using twisted Edwards 3-isogenies
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPB, XQB, XRB, curve[2] = {0}, A = {0};     // curve = (d, a)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+
+    // Initialize basis points
+    init_basis((digit_t*)B_gen, XPB, XQB, XRB);
+    init_basis((digit_t*)A_gen, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+    map_mont_edwards(phiP, phiP);
+    map_mont_edwards(phiQ, phiQ);
+    map_mont_edwards(phiR, phiR);
+
+    // Initialize constants: d = A-2C, a = A+2C, where A=6, C=1
+    fpcopy((digit_t*)&Montgomery_one, curve[1][0]);
+    mp2_add(curve[1], curve[1], curve[1]);
+    mp2_add(curve[1], curve[1], curve[0]);
+    mp2_add(curve[1], curve[0], A);
+    mp2_add(curve[0], curve[0], curve[1]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+    map_mont_edwards(R, R);
+    
+    // Traverse tree
+    traverse_tree(&isog3_Edwards, DEFAULT_SCHEDULER, strat_Bob_Edwards, STRAT_LAYOUT, MAX_Bob, R, curve, phi, 3);
+
+    map_edwards_mont(phiP, phiP);
+    map_edwards_mont(phiQ, phiQ);
+    map_edwards_mont(phiR, phiR);
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+
+    // Format public key
+    fp2_encode(phiP->X, PublicKeyB);
+    fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_A_Edwards(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation using twisted Edwards 4-isogenies
+  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // Returns 1 if PublicKeyB is rejected by validate_pk(), before any ladder or isogeny computation.
+    point_proj_t R;
+    f2elm_t PKB[3], jinv;
+    f2elm_t curve[2] = {0}, A = {0};                     // curve = (a, a-d)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+      
+    if (validate_pk(PublicKeyB) != 0) {
+        return 1;
+    }
+
+    // Initialize images of Bob's basis
+    fp2_decode(PublicKeyB, PKB[0]);
+    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
+
+    // Initialize constants: a = A+2C, a-d = 4C, where C=1
+    get_A(PKB[0], PKB[1], PKB[2], A);
+
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, curve[1][0], NWORDS_FIELD);
+    mp2_add(A, curve[1], curve[0]);
+    mp_add(curve[1][0], curve[1][0], curve[1][0], NWORDS_FIELD);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);    
+    map_mont_edwards(R, R);
+
+    // Traverse tree
+    traverse_tree(&isog4_Edwards, DEFAULT_SCHEDULER, strat_Alice_Edwards, STRAT_LAYOUT, MAX_Alice, R, curve, NULL, 0);
+
+    // j-invariant of the Montgomery curve with A = 2(a+d)/(a-d) = 2(2a-(a-d))/(a-d)
+    mp2_add(curve[0], curve[0], curve[0]);                                                
+    fp2sub(curve[0], curve[1], curve[0]); 
+    fp2add(curve[0], curve[0], curve[0]);                    
+    j_inv(curve[0], curve[1], jinv);
+    fp2_encode(jinv, SharedSecretA);    // Format shared secret
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_B_Edwards(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation using twisted Edwards 3-isogenies
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // Returns 1 if PublicKeyA is rejected by validate_pk(), before any ladder or isogeny computation.
+    point_proj_t R;
+    f2elm_t PKB[3], jinv;
+    f2elm_t curve[2] = {0}, A = {0};                     // curve = (d, a)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+      
+    if (validate_pk(PublicKeyA) != 0) {
+        return 1;
+    }
+
+    // Initialize images of Alice's basis
+    fp2_decode(PublicKeyA, PKB[0]);
+    fp2_decode(PublicKeyA + FP2_ENCODED_BYTES, PKB[1]);
+    fp2_decode(PublicKeyA + 2*FP2_ENCODED_BYTES, PKB[2]);
+
+    // Initialize constants: a = A+2C, d = A-2C, where C=1
+    get_A(PKB[0], PKB[1], PKB[2], A);
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, curve[0][0], NWORDS_FIELD);
+    mp2_add(A, curve[0], curve[1]);
+    mp2_sub_p2(A, curve[0], curve[0]);
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A);
+    map_mont_edwards(R, R);
+
+    // Traverse tree
+    traverse_tree(&isog3_Edwards, DEFAULT_SCHEDULER, strat_Bob_Edwards, STRAT_LAYOUT, MAX_Bob, R, curve, NULL, 0);
+
+    // j-invariant of the Montgomery curve with A = 2(a+d)/(a-d)
+    fp2add(curve[1], curve[0], A);                 
+    fp2add(A, A, A);
+    fp2sub(curve[1], curve[0], curve[1]);                   
+    j_inv(A, curve[1], jinv);
+    fp2_encode(jinv, SharedSecretB);    // Format shared secret
+
+    return 0;
+}
+
+// HUFF SIDH
+static int select_strategy_Huff(const unsigned int party, const unsigned int max_points, const unsigned int* strat, const unsigned int** selected, int* layout)
+{ // Selects the strategy of a Huff tree that stores at most max_points points: strat if it fits, otherwise the working-set-bounded
+  // strategy with the largest bound not exceeding max_points. Returns 1 if max_points is below the smallest bound in strat_bounds.
+    const unsigned int* const* ws = (party == ALICE) ? strat_Alice_ws_Huff : strat_Bob_ws_Huff;
+    const unsigned int maxpts = (party == ALICE) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB;
+    int i;
+
+    if (max_points >= maxpts) {
+        *selected = strat;
+        *layout = STRAT_LAYOUT;
+        return 0;
+    }
+    for (i = STRAT_NBOUNDS-1; i >= 0; i--) {
+        if (strat_bounds[i] <= max_points) {
+            *selected = ws[i];
+            *layout = STRAT_PREORDER;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+int EphemeralKeyGeneration_A_Huff(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation, storing at most STRATEGY_MAX_POINTS points during the traversal
+    return EphemeralKeyGeneration_A_Huff_bounded(PrivateKeyA, PublicKeyA, STRATEGY_MAX_POINTS);
+}
+
+
+int EphemeralKeyGeneration_B_Huff(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation, storing at most STRATEGY_MAX_POINTS points during the traversal
+    return EphemeralKeyGeneration_B_Huff_bounded(PrivateKeyB, PublicKeyB, STRATEGY_MAX_POINTS);
+}
+
+
+int EphemeralSecretAgreement_A_Huff(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation, storing at most STRATEGY_MAX_POINTS points during the traversal
+    return EphemeralSecretAgreement_A_Huff_bounded(PrivateKeyA, PublicKeyB, SharedSecretA, STRATEGY_MAX_POINTS);
+}
+
+
+int EphemeralSecretAgreement_B_Huff(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation, storing at most STRATEGY_MAX_POINTS points during the traversal
+    return EphemeralSecretAgreement_B_Huff_bounded(PrivateKeyB, PublicKeyA, SharedSecretB, STRATEGY_MAX_POINTS);
+}
+
+
+int EphemeralKeyGeneration_A_Huff_bounded(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned int max_points)
+{ // Alice's ephemeral public key generation
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+  // The traversal stores at most max_points points (working-set bound). Returns 1 if no strategy satisfies the bound.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPA, XQA, XRA, curve[2] = {0}, A = {0};     // curve = (CmDsq, CD4)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+    const unsigned int* strat;
+    int layout;
+
+    if (select_strategy_Huff(ALICE, max_points, STRAT_ALICE_HUFF, &strat, &layout) != 0) {
+        return 1;
+    }
+
+    // Initialize basis points
+    init_basis((digit_t*)A_gen_Huff, XPA, XQA, XRA);
+    init_basis((digit_t*)B_gen_Huff, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+
+
+
+    // Initialize constants:  CmDsq= (c-1)^2, C24 = 4c, where A=6, C=1
+    // c+1/c-2 = 4
+
+    fpcopy((digit_t*)&Montgomery_one, A[0]); // A =1
+    fp2add(A, A, A); // A =2
+    fp2add(A, A, A); // A =4
+    fpcopy((digit_t*)&Montgomery_one, curve[0][0]); // A =1
+    fpcopy((digit_t*)&Montgomery_one, curve[1][0]); // A =1
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+#ifdef FIXED_BASE
+    LADDER3PT_fixed_Huff(XPA, XRA, SecretKeyA, ALICE, R);
+#else
+    LADDER3PT_Huff(XPA, XQA, XRA, SecretKeyA, ALICE, R, A, NULL);
+#endif
+
+    // Traverse tree
+    traverse_tree(KERNELS_ALICE_HUFF, DEFAULT_SCHEDULER, strat, layout, MAX_Alice, R, curve, phi, 3);
+
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+                
+    // Format public key                   
+    fp2_encode(phiP->X, PublicKeyA);
+    fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int EphemeralKeyGeneration_B_Huff_bounded(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, const unsigned int max_points)
+{ // Bob's ephemeral public key generation
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+  // The traversal stores at most max_points points (working-set bound). Returns 1 if no strategy satisfies the bound.
+    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0};
+    point_proj* phi[3] = {phiP, phiQ, phiR};
+    f2elm_t XPB, XQB, XRB, curve[2] = {0}, A = {0};     // curve = (A24minus, A24plus) = ((C-D)^2, (C+D)^2)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+    const unsigned int* strat;
+    int layout;
+
+    if (select_strategy_Huff(BOB, max_points, STRAT_BOB_HUFF, &strat, &layout) != 0) {
+        return 1;
+    }
+
+    // Initialize basis points
+    init_basis((digit_t*)B_gen_Huff, XPB, XQB, XRB);
+    init_basis((digit_t*)A_gen_Huff, phiP->X, phiQ->X, phiR->X);
+    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+
+
+    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
+
+    fpcopy((digit_t*)&Montgomery_one, A[0]); // A =1
+    fp2add(A, A, A); // A =2
+    fp2add(A, A, A); // A =4
+
+    fp2copy(A, curve[0]); //4
+    fp2copy(A, curve[1]); //4
+    fp2add(curve[1], curve[1], curve[1]); // 8
+
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+#ifdef FIXED_BASE
+    LADDER3PT_fixed_Huff(XPB, XRB, SecretKeyB, BOB, R);
+#else
+    LADDER3PT_Huff(XPB, XQB, XRB, SecretKeyB, BOB, R, A, NULL);
+#endif
+
+    // Traverse tree
+    traverse_tree(KERNELS_BOB_HUFF, DEFAULT_SCHEDULER, strat, layout, MAX_Bob, R, curve, phi, 3);
+
+    inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+
+    // Format public key
+    fp2_encode(phiP->X, PublicKeyB);
+    fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+typedef struct {
+    f2elm_t PK[3];                         // Images of the other party's basis
+    f2elm_t A;                             // A = c+1/c-2 of the other party's curve
+} pk_decoded_t;                            // Decoded public key and the precomputations that do not depend on the private key
+
+// pk_decoded_t is stored in the precomp field of a pk_handle_t
+typedef char pk_handle_fits[(sizeof(pk_decoded_t) <= sizeof(((pk_handle_t*)0)->precomp)) ? 1 : -1];
+
+
+static int decode_pk_Huff(const unsigned char* PublicKey, pk_decoded_t* pk, f2elm_t C)
+{ // Decodes a Huff public key and computes the coefficient A of its curve. If C is not NULL, A/C is the coefficient
+  // in projective form and pk->A only holds the numerator: the isogeny constants then need no inversion at all.
+  // Returns 1 if the public key is rejected by validate_pk() or if its curve is singular (c = 1 or c = -1), 0 otherwise.
+    f2elm_t t = {0};
+
+    if (validate_pk(PublicKey) != 0) {
+        return 1;
+    }
+
+    fp2_decode(PublicKey, pk->PK[0]);
+    fp2_decode(PublicKey + FP2_ENCODED_BYTES, pk->PK[1]);
+    fp2_decode(PublicKey + 2*FP2_ENCODED_BYTES, pk->PK[2]);
+    if (C == NULL) {
+        get_A_Huff(pk->PK[0], pk->PK[1], pk->PK[2], pk->A);
+        fpcopy((digit_t*)&Montgomery_one, t[0]);
+    } else {
+        get_A_Huff_proj(pk->PK[0], pk->PK[1], pk->PK[2], pk->A, C);
+        fp2copy(C, t);
+    }
+
+    // Singular curves: A/C = c+1/c-2 is 0 or -4
+    fp2add(t, t, t);
+    fp2add(t, t, t);
+    fp2add(pk->A, t, t);
+    return (int)(is_fp2_zero(pk->A) | is_fp2_zero(t));
+}
+
+
+static int secret_agreement_A_Huff(const unsigned char* PrivateKeyA, const pk_decoded_t* pk, const f2elm_t C, unsigned char* SharedSecretA, const unsigned int max_points)
+{ // Alice's ephemeral shared secret computation with Bob's decoded public key pk (see EphemeralSecretAgreement_A_Huff_bounded())
+  // The curve coefficient is pk->A/C, or the affine pk->A if C is NULL (see decode_pk_Huff())
+    point_proj_t R;
+    f2elm_t jinv;
+    f2elm_t curve[2] = {0}, CpDsq={0};         // curve = (CmDsq, CD4)
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+    const unsigned int* strat;
+    int layout;
+
+    if (select_strategy_Huff(ALICE, max_points, STRAT_ALICE_HUFF, &strat, &layout) != 0) {
+        return 1;
+    }
+      
+    // Initialize constants: CmDsq = A, CD4 = 4C, where A/C = c+1/c-2 and C=1 if C is NULL
+    fp2copy(pk->A, curve[0]);
+    if (C == NULL) {
+        fpcopy((digit_t*)&Montgomery_one, curve[1][0]);
+    } else {
+        fp2copy(C, curve[1]);
+    }
+    fp2add(curve[1], curve[1], curve[1]); //2C
+    fp2add(curve[1], curve[1], curve[1]); //4C
+
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    LADDER3PT_Huff(pk->PK[0], pk->PK[1], pk->PK[2], SecretKeyA, ALICE, R, pk->A, C);    
+
+    // Traverse tree
+    traverse_tree(KERNELS_ALICE_HUFF, DEFAULT_SCHEDULER, strat, layout, MAX_Alice, R, curve, NULL, 0);
+
+    fp2add(curve[0], curve[1], CpDsq);                                                
+             
+    j_inv_Huff(CpDsq, curve[0], curve[1], jinv);
+    fp2_encode(jinv, SharedSecretA);    // Format shared secret
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_A_Huff_bounded(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA, const unsigned int max_points)
+{ // Alice's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // The traversal stores at most max_points points (working-set bound). Returns 1 if no strategy satisfies the bound,
+  // or if the public key is rejected by decode_pk_Huff() before any ladder or isogeny computation.
+    pk_decoded_t pk;
+    f2elm_t C;
+
+    if (decode_pk_Huff(PublicKeyB, &pk, C) != 0) {
+        return 1;
+    }
+    return secret_agreement_A_Huff(PrivateKeyA, &pk, C, SharedSecretA, max_points);
+}
+
+
+static int secret_agreement_B_Huff(const unsigned char* PrivateKeyB, const pk_decoded_t* pk, const f2elm_t C, unsigned char* SharedSecretB, const unsigned int max_points)
+{ // Bob's ephemeral shared secret computation with Alice's decoded public key pk (see EphemeralSecretAgreement_B_Huff_bounded())
+  // The curve coefficient is pk->A/C, or the affine pk->A if C is NULL (see decode_pk_Huff())
+    point_proj_t R;
+    f2elm_t jinv;
+    f2elm_t curve[2] = {0}, CD4={0};           // curve = (A24minus, A24plus) = ((C-D)^2, (C+D)^2)
+    digit_t SecretKeyB[NWORDS_ORDER] = {0};
+    const unsigned int* strat;
+    int layout;
+
+    if (select_strategy_Huff(BOB, max_points, STRAT_BOB_HUFF, &strat, &layout) != 0) {
+        return 1;
+    }
+      
+    // Initialize constants: A24minus = A, A24plus = A+4C, where C=1 if C is NULL
+    fp2copy(pk->A, curve[0]);
+    if (C == NULL) {
+        fpcopy((digit_t*)&Montgomery_one, curve[1][0]);
+    } else {
+        fp2copy(C, curve[1]);
+    }
+    fp2add(curve[1], curve[1], curve[1]); // 2C
+    fp2add(curve[1], curve[1], curve[1]); // 4C
+    fp2add(curve[0], curve[1], curve[1]);
+
+
+    // Retrieve kernel point
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    LADDER3PT_Huff(pk->PK[0], pk->PK[1], pk->PK[2], SecretKeyB, BOB, R, pk->A, C);
+
+    // Traverse tree
+    traverse_tree(KERNELS_BOB_HUFF, DEFAULT_SCHEDULER, strat, layout, MAX_Bob, R, curve, NULL, 0);
+
+    fp2sub(curve[1], curve[0], CD4); //                 
+                
+    j_inv_Huff(curve[1], curve[0], CD4, jinv);
+    fp2_encode(jinv, SharedSecretB);    // Format shared secret
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_B_Huff_bounded(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, const unsigned int max_points)
+{ // Bob's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // The traversal stores at most max_points points (working-set bound). Returns 1 if no strategy satisfies the bound,
+  // or if the public key is rejected by decode_pk_Huff() before any ladder or isogeny computation.
+    pk_decoded_t pk;
+    f2elm_t C;
+
+    if (decode_pk_Huff(PublicKeyA, &pk, C) != 0) {
+        return 1;
+    }
+    return secret_agreement_B_Huff(PrivateKeyB, &pk, C, SharedSecretB, max_points);
+}
+
+
+// Public key handles
+// The handle of a public key stores the public key and its decoded form pk_decoded_t, so repeated shared secret
+// computations with the same public key skip the decoding and the computation of the curve coefficients.
+
+int pk_handle_init_A_Huff(pk_handle_t* handle, const unsigned char* PublicKeyA)
+{ // Handle of Alice's public key PublicKeyA, for Bob's shared secret computations. Returns 1 if PublicKeyA is rejected (see decode_pk_Huff()).
+    memcpy(handle->pk, PublicKeyA, CRYPTO_PUBLICKEYBYTES);
+    if (decode_pk_Huff(PublicKeyA, (pk_decoded_t*)handle->precomp, NULL) != 0) {
+        handle->owner = (unsigned int)-1;    // Neither ALICE nor BOB: the handle is rejected by the functions below
+        return 1;
+    }
+    handle->owner = ALICE;
+
+    return 0;
+}
+
+
+int pk_handle_init_B_Huff(pk_handle_t* handle, const unsigned char* PublicKeyB)
+{ // Handle of Bob's public key PublicKeyB, for Alice's shared secret computations and encapsulations. Returns 1 if PublicKeyB is rejected.
+    memcpy(handle->pk, PublicKeyB, CRYPTO_PUBLICKEYBYTES);
+    if (decode_pk_Huff(PublicKeyB, (pk_decoded_t*)handle->precomp, NULL) != 0) {
+        handle->owner = (unsigned int)-1;    // Neither ALICE nor BOB: the handle is rejected by the functions below
+        return 1;
+    }
+    handle->owner = BOB;
+
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_A_Huff_pk(const unsigned char* PrivateKeyA, const pk_handle_t* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation with the handle of Bob's public key. Returns 1 if it is not a handle of Bob's public key.
+    if (PublicKeyB->owner != BOB) {
+        return 1;
+    }
+    return secret_agreement_A_Huff(PrivateKeyA, (const pk_decoded_t*)PublicKeyB->precomp, NULL, SharedSecretA, STRATEGY_MAX_POINTS);
+}
+
+
+int EphemeralSecretAgreement_B_Huff_pk(const unsigned char* PrivateKeyB, const pk_handle_t* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation with the handle of Alice's public key. Returns 1 if it is not a handle of Alice's public key.
+    if (PublicKeyA->owner != ALICE) {
+        return 1;
+    }
+    return secret_agreement_B_Huff(PrivateKeyB, (const pk_decoded_t*)PublicKeyA->precomp, NULL, SharedSecretB, STRATEGY_MAX_POINTS);
+}
+
+
+// Conversion of public keys between Montgomery and Huff curves
+// The Huff generators A_gen_Huff and B_gen_Huff are the w-coordinates w = 1/x of the Montgomery generators A_gen and B_gen,
+// and the isogenies on both models map them to the points of isomorphic curves with the same relation w = 1/x, where x is
+// the coordinate on the Montgomery model of the Huff curve. Both conversions thus invert the three coordinates of a public key.
+
+static int invert_pk(const unsigned char* PublicKeyIn, unsigned char* PublicKeyOut)
+{ // Public key with the inverses of the three coordinates of PublicKeyIn, computed with one inversion.
+  // Returns 1 if PublicKeyIn is rejected by validate_pk(), which guarantees nonzero coordinates.
+    f2elm_t x[3];
+
+    if (validate_pk(PublicKeyIn) != 0) {
+        return 1;
+    }
+    fp2_decode(PublicKeyIn, x[0]);
+    fp2_decode(PublicKeyIn + FP2_ENCODED_BYTES, x[1]);
+    fp2_decode(PublicKeyIn + 2*FP2_ENCODED_BYTES, x[2]);
+    inv_3_way(x[0], x[1], x[2]);
+    fp2_encode(x[0], PublicKeyOut);
+    fp2_encode(x[1], PublicKeyOut + FP2_ENCODED_BYTES);
+    fp2_encode(x[2], PublicKeyOut + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int PublicKeyMontgomeryToHuff(const unsigned char* PublicKey, unsigned char* PublicKeyHuff)
+{ // Huff public key with the w-coordinates of the points of a Montgomery public key. Returns 1 if PublicKey is rejected.
+    return invert_pk(PublicKey, PublicKeyHuff);
+}
+
+
+int PublicKeyHuffToMontgomery(const unsigned char* PublicKeyHuff, unsigned char* PublicKey)
+{ // Montgomery public key with the x-coordinates of the points of a Huff public key. Returns 1 if PublicKeyHuff is rejected.
+    return invert_pk(PublicKeyHuff, PublicKey);
+}
+
+
+#ifdef COMPRESS
+// Compressed Huff public keys ("make COMPRESS=TRUE")
+// A Huff public key holds the w-coordinates (w = 1/x) of phiP, phiQ and phiP-phiQ, the images of the other party's basis,
+// which generate E[ell^e] for the other party's ell^e. On a deterministic basis {R1, R2} of E[ell^e] of the Montgomery model
+// E_A of the public curve, phiP = a0*R1 + b0*R2 and phiQ = a1*R1 + b1*R2, and the coordinates follow from the pairings
+// t(R1, phiP) = g^b0, t(R2, phiP) = g^-a0, t(R1, phiQ) = g^b1 and t(R2, phiQ) = g^-a1, where g = t(R1, R2).
+// The compressed public key holds A and the coordinates divided by a0 (flag 0) or by b0 if a0 is not a unit (flag 1),
+// which only scales the three points by a common unit and leaves the shared secrets unchanged. The ratios do not depend
+// on the base of the logarithms either, which are then taken in base the fixed generator of the subgroup (see dlog.c).
+
+static unsigned int mod_ell(const digit_t* a, const unsigned int ell)
+{ // Computes a mod ell, for a of NWORDS_ORDER words (see mod3())
+    digit_t temp;
+    hdigit_t *val = (hdigit_t*)a, r = 0;
+
+    for (int i = (2*NWORDS_ORDER-1); i >= 0; i--) {
+        temp = ((digit_t)r << (sizeof(hdigit_t)*8)) | (digit_t)val[i];
+        r = (hdigit_t)(temp % ell);
+    }
+    return (unsigned int)r;
+}
+
+
+static void inv_mod_order(const digit_t* a, digit_t* c, const torsion_t* T)
+{ // c = a^(-1) mod ell^e for a unit a, in Montgomery representation c = a^(-1)*2^NBITS_ORDER if ell is odd (see mul_mod_order())
+    if (T->ell == 2) {
+        inv_mod_orderA(a, c);
+    } else {
+        Montgomery_inversion_mod_order_bingcd(a, c, T->order, T->rprime, T->Rprime);     // c = a^-1 * 2^(2*NBITS_ORDER)
+        from_Montgomery_mod_order(c, c, T->order, T->rprime);
+    }
+}
+
+
+static void mul_mod_order(const digit_t* a, const digit_t* b, digit_t* c, const torsion_t* T)
+{ // c = a*b mod ell^e, for b in the representation of inv_mod_order()
+    digit_t t[2*NWORDS_ORDER];
+
+    if (T->ell == 2) {
+        multiply(a, b, t, NWORDS_ORDER);
+        copy_words(t, c, NWORDS_ORDER);
+        c[NWORDS_ORDER-1] &= (digit_t)((uint64_t)(-1) >> (NBITS_ORDER - OALICE_BITS));   // mod 2^216
+    } else {
+        Montgomery_multiply_mod_order(a, b, c, T->order, T->rprime);
+    }
+}
+
+
+static int compress_pk_Huff(const unsigned char* PublicKey, unsigned char* CompressedPK, const torsion_t* T)
+{ // Compression of a Huff public key whose points generate E[ell^e] for T = (ell, e). Returns 1 if the public key is not valid.
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public keys.
+    pk_decoded_t pk;
+    point_t S[2], R[2];
+    f2elm_t x[3], A, t0, t1, t2, h[4], two = {0};
+    digit_t l[4][NWORDS_ORDER], c[3][NWORDS_ORDER], inv[NWORDS_ORDER];
+    unsigned int i, flag, div, num[3], neg[3];
+
+    if (decode_pk_Huff(PublicKey, &pk, NULL) != 0) {
+        return 1;
+    }
+    fpcopy((digit_t*)&Montgomery_one, two[0]);
+    fp2add(two, two, two);
+    fp2add(pk.A, two, A);                           // A = c+1/c, the coefficient of the Montgomery model, with x = 1/w
+    mont_n_way_inv(pk.PK, 3, x);
+
+    // S[0] = phiP = (xP, yP) for either square root yP, and S[1] = phiQ with yQ from x(phiP-phiQ): (yP + yQ)^2 = (xR + A + xP + xQ)*(xP - xQ)^2
+    fp2copy(x[0], S[0]->x);
+    fp2copy(x[1], S[1]->x);
+    curve_rhs(A, S[0]->x, t0);
+    sqrt_Fp2(t0, S[0]->y);
+    curve_rhs(A, S[1]->x, t1);
+    fp2add(x[2], A, t2);
+    fp2add(t2, S[0]->x, t2);
+    fp2add(t2, S[1]->x, t2);
+    fp2sub(S[0]->x, S[1]->x, S[1]->y);
+    fp2sqr_mont(S[1]->y, S[1]->y);
+    fp2mul_mont(t2, S[1]->y, t2);
+    fp2sub(t2, t0, t2);
+    fp2sub(t2, t1, t2);                             // t2 = 2*yP*yQ
+    fp2add(S[0]->y, S[0]->y, S[1]->y);
+    if (is_fp2_zero(S[1]->y)) {
+        return 1;
+    }
+    fp2inv_mont_bingcd(S[1]->y);
+    fp2mul_mont(t2, S[1]->y, S[1]->y);
+    fp2sqr_mont(S[1]->y, t2);
+    if (cmp_f2elm(t2, t1) != 0) {                   // phiQ is not on E_A: the public key is not valid
+        return 1;
+    }
+
+    // Coordinates on the torsion basis, l = -c*(b0, -a0, b1, -a1) for the logarithm c of g = t(R1, R2), from the pairings
+    // t(phiP, R1) = t(R1, phiP)^-1, t(phiP, R2), t(phiQ, R1) and t(phiQ, R2) computed in two Miller loops
+    if (torsion_basis(A, T, R[0], R[1]) != 0 || tate_pairings(S, 2, R, 2, A, T, h) != 0) {
+        return 1;
+    }
+    for (i = 0; i < 4; i++) {
+        if (dlog_pohlig_hellman(h[i], T, l[i]) != 0) {
+            return 1;
+        }
+    }
+
+    // Flag 0: (b0/a0, a1/a0, b1/a0) = (-l0/l1, l3/l1, -l2/l1). Flag 1: (a0/b0, a1/b0, b1/b0) = (-l1/l0, -l3/l0, l2/l0)
+    flag = (mod_ell(l[1], T->ell) == 0);
+    if (flag == 0) {
+        div = 1; num[0] = 0; num[1] = 3; num[2] = 2; neg[0] = 1; neg[1] = 0; neg[2] = 1;
+    } else {
+        div = 0; num[0] = 1; num[1] = 3; num[2] = 2; neg[0] = 1; neg[1] = 1; neg[2] = 0;
+    }
+    if (mod_ell(l[div], T->ell) == 0) {             // phiP has order less than ell^e
+        return 1;
+    }
+    inv_mod_order(l[div], inv, T);
+    for (i = 0; i < 3; i++) {
+        mul_mod_order(l[num[i]], inv, c[i], T);                                           // c[i] = l[num[i]]/l[div]
+        if (neg[i] == 1 && !is_zero(c[i], NWORDS_ORDER)) {
+            Montgomery_neg(c[i], (digit_t*)T->order);
+        }
+    }
+
+    fp2_encode(A, CompressedPK);
+    for (i = 0; i < 3; i++) {
+        encode_to_bytes(c[i], CompressedPK + FP2_ENCODED_BYTES + i*T->nbytes, T->nbytes);
+    }
+    CompressedPK[FP2_ENCODED_BYTES + 3*T->nbytes] = (unsigned char)flag;
+
+    return 0;
+}
+
+
+static int decompress_pk_Huff(const unsigned char* CompressedPK, unsigned char* PublicKey, const torsion_t* T)
+{ // Decompression of a public key compressed by compress_pk_Huff(). Returns 1 if the compressed public key is not valid:
+  // an encoding out of range, a singular curve or a curve without a torsion basis. Further checks are left to the shared
+  // secret computations, which validate the decompressed public key as any other.
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public keys.
+    point_t R1, R2;
+    point_full_proj_t P, Q, D;
+    f2elm_t A, A24, t0, X[3], invX[3], one = {0};
+    digit_t c[3][NWORDS_ORDER], t[NWORDS_ORDER];
+    unsigned char enc[FP2_ENCODED_BYTES];
+    unsigned int i, flag = CompressedPK[FP2_ENCODED_BYTES + 3*T->nbytes];
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2_decode(CompressedPK, A);
+    fp2_encode(A, enc);
+    if (flag > 1 || memcmp(enc, CompressedPK, FP2_ENCODED_BYTES) != 0) {    // Encodings of A are canonical
+        return 1;
+    }
+    for (i = 0; i < 3; i++) {
+        decode_to_digits(CompressedPK + FP2_ENCODED_BYTES + i*T->nbytes, c[i], T->nbytes, NWORDS_ORDER);
+        if (mp_sub(c[i], T->order, t, NWORDS_ORDER) == 0) {                // c[i] >= ell^e
+            return 1;
+        }
+    }
+    fp2add(one, one, t0);
+    fp2sqr_mont(A, A24);
+    fp2add(t0, t0, t0);
+    fp2sub(A24, t0, A24);
+    if (is_fp2_zero(A24)) {                                                 // Singular curves: A^2 = 4
+        return 1;
+    }
+    if (torsion_basis(A, T, R1, R2) != 0) {
+        return 1;
+    }
+
+    fp2add(one, one, t0);
+    fp2add(A, t0, A24);
+    fp2div2(A24, A24);
+    fp2div2(A24, A24);                                                      // A24 = (A+2)/4
+    if (flag == 0) {
+        mont_twodim_scalarmult(c[0], R1, R2, A, A24, P, T->nbits);        // P = R1 + [c0]R2
+    } else {
+        mont_twodim_scalarmult(c[0], R2, R1, A, A24, P, T->nbits);        // P = R2 + [c0]R1
+    }
+    mont_scalarmult_full(c[1], R1, A, A24, D, T->nbits);
+    mont_scalarmult_full(c[2], R2, A, A24, Q, T->nbits);
+    ADD(D, Q->X, Q->Y, Q->Z, A, Q);                                         // Q = [c1]R1 + [c2]R2
+    fp2neg(Q->Y);
+    ADD(P, Q->X, Q->Y, Q->Z, A, D);                                         // D = P - Q
+
+    // w = Z/X, with one inversion
+    fp2copy(P->X, X[0]);
+    fp2copy(Q->X, X[1]);
+    fp2copy(D->X, X[2]);
+    for (i = 0; i < 3; i++) {
+        if (is_fp2_zero(X[i])) {
+            return 1;
+        }
+    }
+    mont_n_way_inv(X, 3, invX);
+    fp2mul_mont(P->Z, invX[0], t0);
+    fp2_encode(t0, PublicKey);
+    fp2mul_mont(Q->Z, invX[1], t0);
+    fp2_encode(t0, PublicKey + FP2_ENCODED_BYTES);
+    fp2mul_mont(D->Z, invX[2], t0);
+    fp2_encode(t0, PublicKey + 2*FP2_ENCODED_BYTES);
+
+    return 0;
+}
+
+
+int PublicKeyCompression_A_Huff(const unsigned char* PublicKeyA, unsigned char* CompressedPKA)
+{ // Compression of Alice's public key, in SIDH_PUBLICKEYBYTES_COMPRESSED bytes. Returns 1 if PublicKeyA is not valid.
+    return compress_pk_Huff(PublicKeyA, CompressedPKA, &torsion_B);
+}
+
+
+int PublicKeyCompression_B_Huff(const unsigned char* PublicKeyB, unsigned char* CompressedPKB)
+{ // Compression of Bob's public key, in SIDH_PUBLICKEYBYTES_COMPRESSED bytes. Returns 1 if PublicKeyB is not valid.
+    return compress_pk_Huff(PublicKeyB, CompressedPKB, &torsion_A);
+}
+
+
+int PublicKeyDecompression_A_Huff(const unsigned char* CompressedPKA, unsigned char* PublicKeyA)
+{ // Decompression of Alice's public key. Returns 1 if CompressedPKA is not valid.
+    return decompress_pk_Huff(CompressedPKA, PublicKeyA, &torsion_B);
+}
+
+
+int PublicKeyDecompression_B_Huff(const unsigned char* CompressedPKB, unsigned char* PublicKeyB)
+{ // Decompression of Bob's public key. Returns 1 if CompressedPKB is not valid.
+    return decompress_pk_Huff(CompressedPKB, PublicKeyB, &torsion_A);
+}
+
+
+int EphemeralKeyGeneration_A_Huff_compressed(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
+{ // Alice's ephemeral public key generation, with the public key compressed
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES];
+
+    EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+    return PublicKeyCompression_A_Huff(PublicKeyA, CompressedPKA);
+}
+
+
+int EphemeralKeyGeneration_B_Huff_compressed(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB)
+{ // Bob's ephemeral public key generation, with the public key compressed
+    unsigned char PublicKeyB[SIDH_PUBLICKEYBYTES];
+
+    EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+    return PublicKeyCompression_B_Huff(PublicKeyB, CompressedPKB);
+}
+
+
+int EphemeralSecretAgreement_A_Huff_compressed(const unsigned char* PrivateKeyA, const unsigned char* CompressedPKB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation with Bob's compressed public key. Returns 1 if it is not valid.
+    unsigned char PublicKeyB[SIDH_PUBLICKEYBYTES];
+
+    if (PublicKeyDecompression_B_Huff(CompressedPKB, PublicKeyB) != 0) {
+        return 1;
+    }
+    return EphemeralSecretAgreement_A_Huff(PrivateKeyA, PublicKeyB, SharedSecretA);
+}
+
+
+int EphemeralSecretAgreement_B_Huff_compressed(const unsigned char* PrivateKeyB, const unsigned char* CompressedPKA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation with Alice's compressed public key. Returns 1 if it is not valid.
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES];
+
+    if (PublicKeyDecompression_A_Huff(CompressedPKA, PublicKeyA) != 0) {
+        return 1;
+    }
+    return EphemeralSecretAgreement_B_Huff(PrivateKeyB, PublicKeyA, SharedSecretB);
+}
+#endif
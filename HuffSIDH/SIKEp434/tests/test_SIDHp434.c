@@ -0,0 +1,17 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: benchmarking/testing isogeny-based key exchange SIDHp434
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P434/api.h"
+
+
+#define SCHEME_NAME    "SIDHp434"
+
+
+
+#include "test_sidh.c"
\ No newline at end of file
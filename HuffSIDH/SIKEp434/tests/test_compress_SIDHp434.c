@@ -0,0 +1,25 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing and benchmarking the primitives of the public key compression of SIDHp434
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P434/P434_internal.h"
+#include "../internal.h"
+
+
+#define SCHEME_NAME        "SIDHp434"
+#define fp2copy_test       fp2copy434
+#define fp2sqr_test        fp2sqr434_mont
+#define fp2mul_test        fp2mul434_mont
+#define fp2add_test        fp2add434
+#define fp2div2_test       fp2div2_434
+#define fp2inv_test        fp2inv434_mont_bingcd
+#define fp2random_test     fp2random434_test
+
+
+
+#include "test_compress.c"
@@ -0,0 +1,350 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: supersingular isogeny parameters and generation of functions for P503
+*********************************************************************************************/  
+
+#include "api.h" 
+#include "P503_internal.h"
+#include "../internal.h"
+
+
+// Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
+// --------------------------------------------------------------------------------------------------
+// Elements over GF(p) and Z_order are encoded with the least significant octet (and digit) located at the leftmost position (i.e., little endian format). 
+// Elements (a+b*i) over GF(p^2), where a and b are defined over GF(p), are encoded as {a, b}, with a in the least significant position.
+// Elliptic curve points P = (x,y) are encoded as {x, y}, with x in the least significant position. 
+// Internally, the number of digits used to represent all these elements is obtained by approximating the number of bits to the immediately greater multiple of 32.
+// For example, a 503-bit field element is represented with Ceil(503 / 64) = 8 64-bit digits or Ceil(503 / 32) = 16 32-bit digits.
+
+//
+// Curve isogeny system "SIDHp503". Base curve: Montgomery curve By^2 = Cx^3 + Ax^2 + Cx defined over GF(p503^2), where A=6, B=1, C=1 and p503 = 2^250*3^159-1
+//
+         
+const uint64_t p503[NWORDS64_FIELD]              = { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xABFFFFFFFFFFFFFF, 0x13085BDA2211E7A0, 0x1B9BF6C87B7E7DAF, 0x6045C6BDDA77A4D0, 0x004066F541811E1E };
+const uint64_t p503x2[NWORDS64_FIELD]            = { 0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x57FFFFFFFFFFFFFF, 0x2610B7B44423CF41, 0x3737ED90F6FCFB5E, 0xC08B8D7BB4EF49A0, 0x0080CDEA83023C3C };
+const uint64_t p503x4[NWORDS64_FIELD]            = { 0xFFFFFFFFFFFFFFFC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xAFFFFFFFFFFFFFFF, 0x4C216F6888479E82, 0x6E6FDB21EDF9F6BC, 0x81171AF769DE9340, 0x01019BD506047879 };
+const uint64_t p503p1[NWORDS64_FIELD]            = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xAC00000000000000, 0x13085BDA2211E7A0, 0x1B9BF6C87B7E7DAF, 0x6045C6BDDA77A4D0, 0x004066F541811E1E };
+const uint64_t p503x16p[2*NWORDS64_FIELD]        = { 0x0000000000000010, 0x0000000000000000, 0x0000000000000000, 0x8000000000000000, 0x9EF484BBBDC30BEA, 0x8C8126F090304A1D, 0xF7472844B10B65FC, 0x30F32157CFDC3C33,
+                                                     0x1463AB4329A333F7, 0xDFC933977C47D3A4, 0x338A3767F6F2520B, 0x4F8CB7565CCC13FA, 0xDE43B73AACD2189B, 0xBCF845CAC5405FBD, 0x516D02A09E684B7A, 0x0001033A4091BB86 };
+// Order of Alice's subgroup, 2^250
+const uint64_t Alice_order[NWORDS64_ORDER]       = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0400000000000000 };
+// Order of Bob's subgroup, 3^159
+const uint64_t Bob_order[NWORDS64_ORDER]         = { 0xC216F6888479E82B, 0xE6FDB21EDF9F6BC4, 0x1171AF769DE93406, 0x1019BD5060478798 };
+#ifdef COMPRESS
+// Montgomery constants for the arithmetic modulo Bob's order: rprime = -order^(-1) mod 2^256 and Rprime = (2^256)^2 mod order
+const uint64_t Montgomery_rprime_B[NWORDS64_ORDER] = { 0x49C8A87190C0697D, 0x2EB7968EA0F0A558, 0x944257B696777FA2, 0xBAA4DDCD6139D2B3 };
+const uint64_t Montgomery_Rprime_B[NWORDS64_ORDER] = { 0x0C2615CA3C5BAA99, 0x5A4FF3072AB6AA6A, 0xA6AFD4B039AD6AA2, 0x010DA06A26DD05CB };
+// Elligator 2 candidates v = 1/(1 + u*r^2) for r = 1, ..., TABLE_R_LEN and the non-square u = 2 + i, in Montgomery representation
+const uint64_t basis_table[TABLE_R_LEN][2*NWORDS64_FIELD] = {
+                                                   { 0x9999999999999ACA, 0x9999999999999999, 0x9999999999999999, 0xE199999999999999, 0xF80F9506B04F6159,
+                                                     0x922628D05B98276C, 0x536E7BDA3A893A25, 0x0038C6C682DEFCAE, 0xCCCCCCCCCCCCCC67, 0xCCCCCCCCCCCCCCCC,
+                                                     0xCCCCCCCCCCCCCCCC, 0x98CCCCCCCCCCCCCC, 0x5E52ECF125EB8217, 0x2DD1EF52B54CC76B, 0xAEF26E4BDFFA238E,
+                                                     0x00028ABA3F8B607A },   // r = 1
+                                                   { 0xB61A6449E59BB678, 0xE59BB61A6449E59B, 0x6449E59BB61A6449, 0x161A6449E59BB61A, 0xB0A7A696AD14F403,
+                                                     0x5908519429BF6752, 0xF8F5C2FDB95D626B, 0x003415A91EB9B01B, 0x59BB61A6449E5991, 0x449E59BB61A6449E,
+                                                     0x61A6449E59BB61A6, 0xEDBB61A6449E59BB, 0xDCBBFD66B1210ED0, 0xD1759BAF69F0DE7F, 0x151E605BC94FFF1C,
+                                                     0x001AF11E41BC9044 },   // r = 2
+                                                   { 0x865EFC865EFC868A, 0x5EFC865EFC865EFC, 0xFC865EFC865EFC86, 0xCE5EFC865EFC865E, 0x4CC228DC36501857,
+                                                     0x73987670F8421161, 0xE0DF934DDA9372B7, 0x002EFD8AF527F647, 0x548FA3548FA3547A, 0x8FA3548FA3548FA3,
+                                                     0xA3548FA3548FA354, 0x5C8FA3548FA3548F, 0x370CE767DB69F0A1, 0x148A42FD9FA8E75E, 0x95D3497A1836567A,
+                                                     0x003B176D3CEE7B7D },   // r = 3
+                                                   { 0x50217FB6E959A5E1, 0x55D744B5F5B8D09B, 0xF7A01245A9968DFD, 0x5E2ED28291CBD92B, 0x327D6A4F12ED9197,
+                                                     0x22F38DE9B94342A8, 0xF08F9207C0BC4954, 0x000092CA7D85CB62, 0x554517694148E5E0, 0x810BFDB74ACD2E40,
+                                                     0xAEBA25AFADC684DA, 0x3D00922D4CB46FEA, 0x9B6A27893DA502ED, 0x70CDC63D75720D1A, 0x079E291279150591,
+                                                     0x001EF28157438CF6 },   // r = 4
+                                                   { 0x59D483698ADF25AD, 0xDF259D483698ADF2, 0x98ADF259D483698A, 0x47698ADF259D4836, 0x8A409FE323B0C564,
+                                                     0x7776BA73BB1425E9, 0xA9C30185C47DDDD5, 0x0017CB3BFFF6729E, 0x6F92CEA41B4C56F1, 0x4C56F92CEA41B4C5,
+                                                     0x41B4C56F92CEA41B, 0xE2A41B4C56F92CEA, 0x9D076460B8435788, 0x54F113B72EB92D94, 0x2A66E44EFC731303,
+                                                     0x0012A4AB560F3F66 },   // r = 5
+                                                   { 0x2B1FB984943A94A8, 0x30572CDCDFF75824, 0x86B44D20E248E0BD, 0x91D67FBFB355D2A2, 0x1FB62ABAE68FD35D,
+                                                     0x3C9EB762B7B42EE1, 0x9F02146D035C6473, 0x002E16E82F80CE94, 0x57721BBE9E5A5800, 0xA2061AF8C6275649,
+                                                     0x3BD12A9F2030397F, 0x11812DB680FC4074, 0xE65278C2B095007B, 0x8F2E2CBAE91FE5D5, 0xED8F5676C276CA45,
+                                                     0x003DF6D70A1D206A },   // r = 6
+                                                   { 0xBE8AB88AA30ECFE7, 0x4BA78C308192D1B7, 0xB3E24AC5F8070CA1, 0x096351F2D30F7BBD, 0x81FEFCEA948AD196,
+                                                     0xD3C5B4543AD9805F, 0x00A75812F48753D9, 0x001724C5EDAB3470, 0x2827F23CACB56FB9, 0x0157BD32FB57A7B7,
+                                                     0x70A9DAFDB132D060, 0x792BEEB65C0F9BF7, 0xE56FC183B1F50CE1, 0xCCAD12C0789DBF02, 0x8C2146875FF342E2,
+                                                     0x001CE0B3C0517507 },   // r = 7
+                                                   { 0x49B33CFF3F381BC6, 0xD8CAC1728CCEDAAE, 0x1DF2FD00097B2467, 0x0AB713DCFD459086, 0x08836E5EA1B2EDAB,
+                                                     0x1716275997ADF384, 0x191CA247A36D2F50, 0x0032176EFFF620B5, 0x4C8D46F27B6D17EC, 0x50F8ADEAE3D0F0C7,
+                                                     0x545DC5F4131C3561, 0xE5B904096E80374E, 0xA86F14DB302AE72D, 0x8F42BC329DB7D7E0, 0x83BAE6D9FEE5F302,
+                                                     0x0031094190A0F887 },   // r = 8
+                                                   { 0x8EB074F53A76A870, 0xB126FDBA6CC46493, 0x555A9BBF86580EF5, 0x2D766D1384CC6DD9, 0x488C1D0E043C69F6,
+                                                     0xE46574481370F9B8, 0x20011A2950633B25, 0x002C90D406DC97FF, 0x25760E200D5A3CC9, 0x5B029C9D13C41968,
+                                                     0x4CF262816A003763, 0xECB895F7DEFD5B79, 0x5500D603F7586E63, 0xD3B73E937238582B, 0xE0717E4434F561B4,
+                                                     0x0024B97B8A231B62 },   // r = 9
+                                                   { 0x3B59E87672CD3132, 0x39065FDDB46E42BB, 0xDFF1DBFCEE9FB3C5, 0x95D0A17ADF5B0686, 0x004F4AE55C15F6F6,
+                                                     0xEC7A661AF31BEEA2, 0x0CA7A05464470274, 0x0032630B4C55211E, 0x9DB227BAE1A18E5E, 0x2D8003402FC924D9,
+                                                     0xDBBA9E0412D57B42, 0x00E3590E03813384, 0x50E5FD1EE6160BE7, 0x319EE53F2DE7E963, 0xAFBEDCC8195A0FE7,
+                                                     0x001D66C22AE5E03D },   // r = 10
+                                                   { 0xFA1D721B8012AD24, 0x4D5A34CA856360AA, 0x2C74166DA03E082F, 0xA334C1A0A8C0EECA, 0x4BD3029C76081336,
+                                                     0xC17E91F7FE1620AB, 0x602C6464DF6D7B5A, 0x0037C56195A01609, 0xF42E70CB53B77D89, 0x971CD3CDB95DCA98,
+                                                     0x98BED2110CEA97D7, 0x29E8E40FDE89CEA0, 0x066762394F501B5D, 0x768E393C98EDB0DC, 0x7B7177B9782A051C,
+                                                     0x002419F31B5536B7 },   // r = 11
+                                                   { 0x6B9078F75FB9FD5A, 0xAAE697DEF085EE62, 0x55F0635BB0920820, 0xB6EB4C44F59DA609, 0x9D20534E797B55E3,
+                                                     0xE586320878C2E00C, 0x4B2C04D2265832BF, 0x002B7A08CADF8ABE, 0xA28AD65405737E37, 0x01A7AD3DA645AE6C,
+                                                     0xA007C768042513DE, 0xB862E5834961B9AB, 0xD751FD817FF50BD6, 0xD40A969925029B74, 0x38326A08AA3FE933,
+                                                     0x0033A720FE49B1C0 },   // r = 12
+                                                   { 0x6F33A8DC20803BD8, 0x2846C4B267C2FEA9, 0x3007D269048CB91D, 0x149AF087F10343DC, 0xA411643250BFE57D,
+                                                     0xFE05DA28BEBBD6A2, 0xA1CC30AB16469EDF, 0x00073147428B8D6E, 0x14144FB077BA07EC, 0xBDDB35BAB1D76D69,
+                                                     0x161ED689F2678887, 0x635E2E3996327A7D, 0xEF1D6C7CA5686991, 0x50B90BE915F46926, 0x1CA4E335B9AB5FD5,
+                                                     0x0027BAA66DCED0C5 },   // r = 13
+                                                   { 0xEFA7AC2F83918F15, 0x1180A29870F3D459, 0x90347A6E04DDB73E, 0x80D765C86450E8FF, 0xB872718F0F19F98D,
+                                                     0xD6A86F096DCF4922, 0x0B38BB34120254D9, 0x002E5A1621B615F2, 0xB2D181BD4FA52AA2, 0xDC904B3EB8AF6F02,
+                                                     0xD6B25DF9558317E8, 0x85BF914F31A23BAC, 0xBDA3E9AB557B29B7, 0x5CD5E1D426B1789D, 0x8A6AED659E678CD3,
+                                                     0x001C56D6E1BB93F5 },   // r = 14
+                                                   { 0x924E6058D015A38D, 0x1E2EC7DD7A5132B7, 0xA97C2194346DA32D, 0x41EF1F31CD51333B, 0xFB89E6E30C1162AA,
+                                                     0x4061678E5962580A, 0x09ECCCCB3B6FAD5A, 0x0037AF58627A887A, 0xE8F5D903F0BD0269, 0x200E1FFA8489B9DA,
+                                                     0xDE882C8D3156A460, 0x8C4DABC11F877458, 0xD54C3B40CD538F2F, 0x41674635284DFEBB, 0xAD9B8330BFF569FC,
+                                                     0x0030C2633BF078F7 },   // r = 15
+                                                   { 0x75C1E6ED473130D0, 0xFD624B7CC04D355F, 0x313DC4BCA820911E, 0x449D8112D71CF106, 0x23A25A83664B420E,
+                                                     0x16A55C6AF6910691, 0xDA58FB0631B2EAD0, 0x002D42B72E1FA0F5, 0x4AF98FC17BA992CE, 0x19C1F944FD5AB7F4,
+                                                     0x68ACC73E0CE942CF, 0x7B3F9FA6C110FEFD, 0x3DEFD9B6CFCF2AD2, 0x4B080446336C5FA5, 0x19508DFD60080814,
+                                                     0x000FD442DBA88642 },   // r = 16
+                                                   { 0x4EE43F3D8CAC1374, 0x0AF2E7784E2460F7, 0x50133AD8519FCCA1, 0xBDB81ECD10C888CF, 0x0675791FE9112FBA,
+                                                     0x364B5F4D282C51A3, 0xA3A53FD5546E97E0, 0x00261C6F73A8BA64, 0x13DE8B19DF5E0FEE, 0x1D05A6FE505FEA21,
+                                                     0x634E634AA1C25DBB, 0x2C49E6E62282B432, 0xE989B2E0D9775E22, 0x104ABC59A97037E8, 0x03DFAB907857260E,
+                                                     0x003B8179D525D960 }   // r = 17
+                                                   };
+// Tables of the Pohlig-Hellman discrete logarithms, generated by dloggen.py
+#include "P503_dlog_tables.h"
+// Torsion subgroups E[2^250], carried by Bob's public keys, and E[3^159], carried by Alice's public keys
+// 2^250 has OALICE_BITS+1 bits, and the arithmetic modulo 2^250 needs no Montgomery constants (see mul_mod_order())
+const torsion_t torsion_A = { 2, EXPON_2, OALICE_BITS + 1, ORDER_A_ENCODED_BYTES, (const digit_t*)Alice_order, NULL, NULL,
+                              W_2, DLEN_2, ELL2_W, ELL2_EMODW, (const uint64_t*)ph2_table, (const uint64_t*)ph2_table0, ph2_path };
+const torsion_t torsion_B = { 3, EXPON_3, OBOB_BITS, ORDER_B_ENCODED_BYTES, (const digit_t*)Bob_order, (const digit_t*)Montgomery_rprime_B, (const digit_t*)Montgomery_Rprime_B,
+                              W_3, DLEN_3, ELL3_W, ELL3_EMODW, (const uint64_t*)ph3_table, (const uint64_t*)ph3_table0, ph3_path };
+#endif
+// Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p503^2), expressed in Montgomery representation
+const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x5D083011589AD893, 0xADFD8D2CB67D0637, 0x330C9AC34FFB6361, 0xF0D47489A2E805A2, 0x27E2789259C6B8DC, 0x63866A2C121931B9, 0x8D4C65A7137DCF44, 0x003A183AE5967B3F,   // XPA0
+                                                     0x7E3541B8C96D1519, 0xD3ADAEEC0D61A26C, 0xC0A2219CE7703DD9, 0xFF3E46658FCDBC52, 0xD5B38DEAE6E196FF, 0x1AAC826364956D58, 0xEC9F4875B9A5F27A, 0x001B0B475AB99843,   // XPA1
+                                                     0x4D83695107D03BAD, 0x221F3299005E2FCF, 0x78E6AE22F30DECF2, 0x6D982DB5111253E4, 0x504C80A8AB4526A8, 0xEFD0C3AA210BB024, 0xCB77483501DC6FCF, 0x001052544A96BDF3,   // XQA0
+                                                     0x0D74FE3402BCAE47, 0xDF5B8CDA832D8AED, 0xB86BCF06E4BD837E, 0x892A2933A0FA1F63, 0x9F88FC67B6CCB461, 0x822926EA9DDA3AC8, 0xEAC8DDE5855425ED, 0x000618FE6DA37A80,   // XQA1
+                                                     0x6B6F4A4F786CF310, 0xB019D444BDCFDBE3, 0xA14CB06680607834, 0xCB0D5582E7E6E60A, 0xBA4EE8771667E241, 0xE42A114FCB12E5FF, 0x9A0C074E275BCD98, 0x001871329B28689E,   // XRA0
+                                                     0x685FA8378513FE76, 0x84E8FC1785E8BDF0, 0x8A380F177CB7C1B7, 0x2227464F4F812C94, 0x117C94A81A90C279, 0x193D73132FB9FA28, 0x99335336F192C9EB, 0x0006C2FE778A34FD }; // XRA1
+// Bob's generator values {XPB0, XQB0, XRB0 + XRB1*i} in GF(p503^2), expressed in Montgomery representation
+const uint64_t B_gen[6 * NWORDS64_FIELD]         = { 0xDF630FC5FB2468DB, 0xC30C5541C102040E, 0x3CDC9987B76511FC, 0xF54B5A09353D0CDD, 0x3ADBA8E00703C42F, 0x8253F9303DDC95D0, 0x62D30778763ABFD7, 0x001CD00FB581CD55,   // XPB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XPB1
+                                                     0x2E3457A12B429261, 0x311F94E89627DCF8, 0x5B71C98FD1DB73F6, 0x3671DB7DCFC21541, 0xB6D1484C9FE0CF4F, 0x19CD110717356E35, 0xF4F9FB00AC9919DF, 0x0035BC124D38A70B,   // XQB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XQB1
+                                                     0x2E08BB99413D2952, 0xD3021467CD088D72, 0x21017AF859752245, 0x26314ED8FFD9DE5C, 0x4AF43C73344B6686, 0xCFA1F91149DF0993, 0xF327A95365587A89, 0x000DBF54E03D3906,   // XRB0
+                                                     0xFC1FC00CBD0A0CFB, 0x66C29FB284B491A9, 0x7FBED0B26D7F18E0, 0x9C02361066F4C67D, 0x2D83758DD0B19E6F, 0x0827029DB2CDC1D7, 0x58700A85FAD38A71, 0x0006FA256B614AD2 }; // XRB1
+
+
+// Huff initial curve c
+const uint64_t Huff_c[NWORDS64_FIELD]            = { 0xC7670A44560F9F78, 0xAB8547B43C3479D3, 0x3D569F5772456BB6, 0xDBB5B53C0FA23B31, 0x3D7199CD5FD0E3BA, 0x06A712F4F34F0EE1, 0xE73F62AAEA4B6A5E, 0x000A45E1F1855233 };
+
+// Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p503^2), expressed in Montgomery representation
+const uint64_t A_gen_Huff[6 * NWORDS64_FIELD]    = { 0x4D2CE47203FB7F35, 0x9C4688AE1933AC88, 0x8CAA10A904D4F2CC, 0xBEE0C14ABC71E1C5, 0xC8382F1B8DB95BB9, 0xCA6361189686195A, 0x4350B6913EDFF2CC, 0x000A4B2E08E0CC03,   // XPA0
+                                                     0xFF0158E077B3CCB6, 0x01E7FBB8E51B61D4, 0x1073C4536F0C0ECB, 0xE4232771170D8A18, 0xCF2526FF3D617FE0, 0xFE48670BCFD0D2EB, 0xD19D663FC645CB2E, 0x0006E0D5E336F432,   // XPA1
+                                                     0x83C804E049A9E970, 0xDA16C281B7704117, 0x122FCBD5EB9EC3F3, 0xC4A902AD3D3AA9DA, 0x05173F979AB431C6, 0x6A0F88F8F77F8514, 0x1CA2CE816060DA3E, 0x0031576EFB3C160C,   // XQA0
+                                                     0x4042EA02068C2E33, 0x916E930A7207A9D5, 0xB943A17F53196BDB, 0xABABD73548DA9535, 0x2BA4CBA97937D77A, 0x1D86987D4D854BC0, 0x4602E71353F95943, 0x0014C23E7B68D232,   // XQA1
+                                                     0x73A54CD4ABC708DF, 0xD949E091DAD466CB, 0x1BFFF0F80053688A, 0xCDC64B92B21E99AF, 0x146D9276870B2396, 0x9F751263CF9B87A0, 0xF0225422A4BCFE15, 0x000E1B968BA499D7,   // XRA0
+                                                     0xA411DAFFD0A8A1C2, 0x7CD4EE239AC8781B, 0x39E20BAC0787E0E2, 0x8841110F60AA6415, 0x5E557FDB117BF6DE, 0x82751048C3E5AC2A, 0x63CCB8F3D5076FB6, 0x000BF07850E0BAF7 }; // XRA1
+
+
+
+
+
+
+
+// Bob's generator values {XPB0, XQB0, XRB0 + XRB1*i} in GF(p503^2), expressed in Montgomery representation
+const uint64_t B_gen_Huff[6 * NWORDS64_FIELD]    = { 0x20DA8C676C8F8325, 0xD2C6C4B1F7FDCF86, 0xAF3D9918CD5B0889, 0x19B2353527C5D01A, 0xC623E3CD78F45250, 0xDD78B712C6C18539, 0x5D91D5CF0ACA39F0, 0x0031CB415047A934,   // XPB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XPB1
+                                                     0xA77003284CCD169C, 0xABE6BBDCAE3CDCC7, 0x8B4DB11B6C7E263C, 0x542C2411EF796B23, 0xC93CA687D13C23E5, 0xAA8C0BD5E6D8C941, 0x823A93D2FF273E0C, 0x000BEF949A533BCB,   // XQB0
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   // XQB1
+                                                     0x88C182F19C686D3E, 0x3F1B9E10CB75F9C7, 0x781F57BD43EF08A4, 0xC51283953420CEAA, 0xF242B99820FA0312, 0x627AA5E15B5FDBB5, 0x3D0C6A4608B8E79D, 0x0004961BEBEAA4F9,   // XRB0
+                                                     0x0C6C5FCBD495DAF9, 0x622130718D685ACC, 0x72A9B1D230306DE6, 0x754C1C5789840ECE, 0xD499D22402623AB5, 0x7A9EBD82222AF595, 0x5921C305D990294A, 0x001FFEA66BC51AD9 }; // XRB1
+#ifdef FIXED_BASE
+// Fixed-base tables of the Huff key generation, generated by fixedgen.py from A_gen_Huff and B_gen_Huff
+#include "P503_fixed_base_tables.h"
+#endif
+
+
+
+// Montgomery constant Montgomery_R2 = (2^512)^2 mod p503
+const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x5289A0CF641D011F, 0x9B88257189FED2B9, 0xA3B365D58DC8F17A, 0x5BC57AB6EFF168EC, 0x9E51998BD84D4423, 0xBF8999CBAC3B5695, 0x46E9127BCE14CDB6, 0x003F6CFCE8B81771 };
+// Value one in Montgomery representation 
+const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000, 0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953 };
+
+
+// Fixed parameters for isogeny tree computation
+const unsigned int strat_Alice[MAX_Alice-1] = { 
+61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2,
+1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 29, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1,
+2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 8, 4, 2, 1, 1, 2, 1,
+1, 4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob[MAX_Bob-1] = { 
+71, 38, 21, 13, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1,
+1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17,
+9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1,
+2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2,
+1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2,
+1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2,
+1, 1 };
+
+// Strategies for the Huff isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Huff[MAX_Alice-1] = { 
+56, 32, 17, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2,
+1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 24, 15, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1,
+2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 7, 4, 2,
+1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Alice_par_Huff[MAX_Alice-1] = { 
+47, 32, 20, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1,
+1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1,
+1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 15, 12, 8, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1,
+1, 1, 1, 1, 1, 5, 3, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_Huff[MAX_Bob-1] = { 
+66, 38, 22, 13, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1,
+1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1,
+2, 1, 1, 3, 2, 1, 1, 1, 1, 28, 16, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3,
+2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_par_Huff[MAX_Bob-1] = { 
+52, 39, 26, 17, 11, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 3, 2,
+1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+1, 1, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 14, 12, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 1, 3, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 4, 3,
+2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+// Strategies for the twisted Edwards isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Edwards[MAX_Alice-1] = { 
+61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2,
+1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1,
+1, 29, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2,
+1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 8, 4, 2, 1, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_Edwards[MAX_Bob-1] = { 
+52, 39, 26, 17, 11, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 3, 2,
+1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+1, 1, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 14, 12, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 1, 3, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 4, 3,
+2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+// Working-set-bounded strategies for the Huff trees, storing at most strat_bounds[i] points and listed in traversal order
+const unsigned int strat_bounds[STRAT_NBOUNDS] = { 4, 6, 8 };
+
+const unsigned int strat_Alice_ws4_Huff[MAX_Alice-1] = { 
+68, 36, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1,
+1, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1,
+3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 32, 21, 10, 4, 3, 2,
+1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5,
+3, 2, 1, 1, 1, 2, 1, 1, 1, 16, 8, 4, 3, 2, 1, 2, 1, 1, 4, 2, 1,
+1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Alice_ws6_Huff[MAX_Alice-1] = { 
+58, 31, 16, 10, 6, 3, 2, 1, 3, 2, 1, 1, 1, 4, 3, 2, 1, 1, 1, 2, 1,
+1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1,
+1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1,
+7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2,
+1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Alice_ws8_Huff[MAX_Alice-1] = { 
+55, 32, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4,
+2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1,
+1, 3, 2, 1, 1, 1, 1, 23, 15, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1,
+1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 6, 4,
+2, 1, 1, 2, 1, 1, 2, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Bob_ws4_Huff[MAX_Bob-1] = { 
+95, 42, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2,
+1, 1, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3,
+2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1,
+1, 53, 26, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15, 7, 3,
+2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1,
+1, 27, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4,
+2, 1, 1, 2, 1, 1, 12, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws6_Huff[MAX_Bob-1] = { 
+64, 44, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5,
+3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 18, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 7, 4, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 28, 16, 9, 5, 3, 2, 1, 1, 1, 2,
+1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3,
+2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws8_Huff[MAX_Bob-1] = { 
+66, 38, 22, 13, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1,
+1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1,
+2, 1, 1, 3, 2, 1, 1, 1, 1, 28, 16, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3,
+2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+// Measured costs of the kernels of the Huff trees in the Huff and Montgomery models (columns MODEL_HUFF, MODEL_MONT),
+// the hybrid traversals (HYBRID_MODELS) run each kernel in the cheaper model
+const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { 
+{ 31018, 31324 }, { 21319, 21460 }, { 30680, 31406 }, { 15474, 20108 } };
+
+
+// Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
+#define fpcopy                        fpcopy503
+#define fpzero                        fpzero503
+#define fpadd                         fpadd503
+#define fpsub                         fpsub503
+#define fpneg                         fpneg503
+#define fpdiv2                        fpdiv2_503
+#define fpcorrection                  fpcorrection503
+#define fpmul_mont                    fpmul503_mont
+#define fpsqr_mont                    fpsqr503_mont
+#define fpinv_mont                    fpinv503_mont
+#define fpinv_chain_mont              fpinv503_chain_mont
+#define fpinv_mont_bingcd             fpinv503_mont_bingcd
+#define fp2copy                       fp2copy503
+#define fp2zero                       fp2zero503
+#define fp2add                        fp2add503
+#define fp2sub                        fp2sub503
+#define mp_sub_p2                     mp_sub503_p2
+#define mp_sub_p4                     mp_sub503_p4
+#define sub_p4                        mp_sub_p4
+#define fp2neg                        fp2neg503
+#define fp2div2                       fp2div2_503
+#define fp2correction                 fp2correction503
+#define fp2mul_mont                   fp2mul503_mont
+#define fp2sqr_mont                   fp2sqr503_mont
+#define fp2inv_mont                   fp2inv503_mont
+#define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
+#define fpequal_non_constant_time     fpequal503_non_constant_time
+#define mp_add_asm                    mp_add503_asm
+#define mp_subaddx2_asm               mp_subadd503x2_asm
+#define mp_dblsubx2_asm               mp_dblsub503x2_asm
+
+
+#include "../fpx.c"
+#include "../ec_isogeny.c"
+#ifdef COMPRESS
+#include "../pairing.c"
+#include "../dlog.c"
+#include "../torsion_basis.c"
+#endif
+#include "../parallel.c"
+#include "../traverse.c"
+#include "../sidh.c"
+#include "../sike.c"
\ No newline at end of file
@@ -0,0 +1,1274 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: elliptic curve and isogeny functions
+*********************************************************************************************/
+
+
+void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24)
+{ // Doubling of a Montgomery point in projective coordinates (X:Z).
+  // Input: projective Montgomery x-coordinates P = (X1:Z1), where x1=X1/Z1 and Montgomery curve constants A+2C and 4C.
+  // Output: projective Montgomery x-coordinates Q = 2*P = (X2:Z2).
+    f2elm_t t0, t1;
+    
+    mp2_sub_p2(P->X, P->Z, t0);                     // t0 = X1-Z1
+    mp2_add(P->X, P->Z, t1);                        // t1 = X1+Z1
+    fp2sqr_mont(t0, t0);                            // t0 = (X1-Z1)^2 
+    fp2sqr_mont(t1, t1);                            // t1 = (X1+Z1)^2 
+    fp2mul_mont(C24, t0, Q->Z);                     // Z2 = C24*(X1-Z1)^2   
+    fp2mul_mont(t1, Q->Z, Q->X);                    // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+    mp2_sub_p2(t1, t0, t1);                         // t1 = (X1+Z1)^2-(X1-Z1)^2 
+    fp2mul_mont(A24plus, t1, t0);                   // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+    mp2_add(Q->Z, t0, Q->Z);                        // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+    fp2mul_mont(Q->Z, t1, Q->Z);                    // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+}
+
+// CmDsq = (C-D)^2
+// CD4 = 4CD
+void xDBL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1;
+
+    mp2_add(P->X, P->Z, t0);                        // t0 = P->X + P->Z
+    fp2sqr_mont(t0, t0);                            // sp = (P->X+P->Z)^2
+    mp2_sub_p2(P->X, P->Z, Q->Z);                   // Q->Z = P->X - P->Z
+    fp2sqr_mont(Q->Z, Q->Z);                        // sm = (P->X-P->Z)^2
+    fp2mul_mont(t0, CD4, Q->X);                     // t = sp*CD4
+    mp2_sub_p2(t0, Q->Z, t0);                       // xz4 = sp - sm
+    fp2mul_mont(Q->Z, Q->X, Q->Z);                  // Q->Z = sm*t
+    fp2mul_mont(t0, CmDsq, t1);                     // t1 = xz4*CmDsq
+    mp2_add(Q->X, t1, Q->X);                        // Q->X = t + xz4*CmDsq
+    fp2mul_mont(t0, Q->X, Q->X);                    // Q->X = xz4*(t+xz4*CmDsq)
+}
+
+
+
+
+
+void xDBLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24, const int e)
+{ // Computes [2^e](X:Z) on Montgomery curve with projective constant via e repeated doublings.
+  // Input: projective Montgomery x-coordinates P = (XP:ZP), such that xP=XP/ZP and Montgomery curve constants A+2C and 4C.
+  // Output: projective Montgomery x-coordinates Q <- (2^e)*P.
+    int i;
+    
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xDBL(Q, Q, A24plus, C24);
+    }
+}
+
+// CmDsq = (C-D)^2
+// CD4 = 4CD
+void xDBLe_inplace_Huff(point_proj_t P, const f2elm_t CmDsq, const f2elm_t CD4, const int e)
+{ // Computes [2^e](X:Z) on Huff curve with projective constant via e repeated doublings, in place.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants (C-D)^2 and 4CD.
+  // Output: projective Huff w-coordinates P <- (2^e)*P.
+    int i;
+
+    for (i = 0; i < e; i++) {
+        xDBL_Huff(P, P, CmDsq, CD4);
+    }
+}
+
+void xDBLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4, const int e)
+{ // Computes [2^e](X:Z) on Huff curve with projective constant via e repeated doublings.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants (C-D)^2 and 4CD.
+  // Output: projective Huff w-coordinates Q <- (2^e)*P. The first doubling reads P and writes Q, so P is only copied when e = 0.
+    if (e == 0) {
+        copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+        return;
+    }
+    xDBL_Huff(P, Q, CmDsq, CD4);
+    xDBLe_inplace_Huff(Q, CmDsq, CD4, e-1);
+}
+
+
+void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t* coeff)
+{ // Computes the corresponding 4-isogeny of a projective Montgomery point (X4:Z4) of order 4.
+  // Input:  projective point of order four P = (X4:Z4).
+  // Output: the 4-isogenous Montgomery curve with projective coefficients A+2C/4C and the 3 coefficients 
+  //         that are used to evaluate the isogeny at a point in eval_4_isog().
+    
+    mp2_sub_p2(P->X, P->Z, coeff[1]);               // coeff[1] = X4-Z4
+    mp2_add(P->X, P->Z, coeff[2]);                  // coeff[2] = X4+Z4
+    fp2sqr_mont(P->Z, coeff[0]);                    // coeff[0] = Z4^2
+    mp2_add(coeff[0], coeff[0], coeff[0]);          // coeff[0] = 2*Z4^2
+    fp2sqr_mont(coeff[0], C24);                     // C24 = 4*Z4^4
+    mp2_add(coeff[0], coeff[0], coeff[0]);          // coeff[0] = 4*Z4^2
+    fp2sqr_mont(P->X, A24plus);                     // A24plus = X4^2
+    mp2_add(A24plus, A24plus, A24plus);             // A24plus = 2*X4^2
+    fp2sqr_mont(A24plus, A24plus);                  // A24plus = 4*X4^4
+}
+
+
+void get_4_isog_Huff(const point_proj_t P, f2elm_t CmDsq, f2elm_t CD4, f2elm_t* coeff)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    fp2sqr_mont(P->X, coeff[1]);                    // coeff[1] = P->X^2
+    mp2_add(coeff[1], coeff[1], coeff[1]);          // coeff[1] = 2*P->X^2
+    fp2sqr_mont(coeff[1], CD4);                     // x4 = (2*P->X^2)^2
+    fp2sub(P->X, P->Z, coeff[1]);                   // coeff[1] = P->X - P->Z
+    fp2add(P->X, P->Z, coeff[2]);                   // coeff[2] = P->X + P->Z
+    fp2sqr_mont(P->Z, coeff[0]);                    // coeff[0] = P->Z^2
+    fp2add(coeff[0], coeff[0], CmDsq);              // CmDsq = 2*P->Z^2
+    fp2add(CmDsq, CmDsq, coeff[0]);                 // coeff[0] = 4*P->Z^2
+    fp2sqr_mont(CmDsq, CmDsq);                      // CmDsq = (2*P->Z^2)^2
+    fp2sub(CmDsq, CD4, CmDsq);                      // CmDsq = (2*P->Z^2)^2 - x4
+}
+
+
+void eval_4_isog(point_proj_t P, const f2elm_t* coeff)
+{ // Evaluates the isogeny at the point (X:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
+  // by the 3 coefficients in coeff (computed in the function get_4_isog()).
+  // Inputs: the coefficients defining the isogeny, and the projective point P = (X:Z).
+  // Output: the projective point P = phi(P) = (X:Z) in the codomain. 
+    f2elm_t t0, t1;
+    
+    mp2_add(P->X, P->Z, t0);                        // t0 = X+Z
+    mp2_sub_p2(P->X, P->Z, t1);                     // t1 = X-Z
+    fp2mul_mont(t0, coeff[1], P->X);                // X = (X+Z)*coeff[1]
+    fp2mul_mont(t1, coeff[2], P->Z);                // Z = (X-Z)*coeff[2]
+    fp2mul_mont(t0, t1, t0);                        // t0 = (X+Z)*(X-Z)
+    fp2mul_mont(coeff[0], t0, t0);                  // t0 = coeff[0]*(X+Z)*(X-Z)
+    mp2_add(P->X, P->Z, t1);                        // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    mp2_sub_p2(P->X, P->Z, P->Z);                   // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_mont(t1, t1);                            // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_mont(P->Z, P->Z);                        // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    mp2_add(t1, t0, P->X);                          // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    mp2_sub_p2(P->Z, t0, t0);                       // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_mont(P->X, t1, P->X);                    // Xfinal
+    fp2mul_mont(P->Z, t0, P->Z);                    // Zfinal
+}
+
+
+
+
+void eval_4_isog_Huff(point_proj_t P, const f2elm_t* coeff)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1;
+
+    mp2_add(P->X, P->Z, t0);                        // s = P->X + P->Z
+    mp2_sub_p2(P->X, P->Z, P->X);                   // d = P->X - P->Z
+    fp2mul_mont(t0, coeff[1], P->Z);                // a = s*coeff[1]
+    fp2mul_mont(t0, P->X, t0);                      // t0 = s*d
+    fp2mul_mont(P->X, coeff[2], P->X);              // b = d*coeff[2]
+    fp2mul_mont(coeff[0], t0, t0);                  // e = coeff[0]*s*d
+    mp2_add(P->Z, P->X, t1);                        // t1 = a + b
+    mp2_sub_p2(P->Z, P->X, P->X);                   // P->X = a - b
+    fp2sqr_mont(t1, P->Z);                          // u = (a+b)^2
+    fp2sqr_mont(P->X, t1);                          // v = (a-b)^2
+    mp2_add(t0, P->Z, P->X);                        // P->X = e + u
+    fp2mul_mont(t1, P->X, P->X);                    // P->X = v*(e+u)
+    mp2_sub_p2(t1, t0, t0);                         // t0 = v - e
+    fp2mul_mont(P->Z, t0, P->Z);                    // P->Z = u*(v-e)
+}
+
+//
+void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)              
+{ // Tripling of a Montgomery point in projective coordinates (X:Z).
+  // Input: projective Montgomery x-coordinates P = (X:Z), where x=X/Z and Montgomery curve constants A24plus = A+2C and A24minus = A-2C.
+  // Output: projective Montgomery x-coordinates Q = 3*P = (X3:Z3).
+    f2elm_t t0, t1, t2, t3, t4, t5, t6;
+                                    
+    mp2_sub_p2(P->X, P->Z, t0);                     // t0 = X-Z 
+    fp2sqr_mont(t0, t2);                            // t2 = (X-Z)^2           
+    mp2_add(P->X, P->Z, t1);                        // t1 = X+Z 
+    fp2sqr_mont(t1, t3);                            // t3 = (X+Z)^2
+    mp2_add(P->X, P->X, t4);                        // t4 = 2*X
+    mp2_add(P->Z, P->Z, t0);                        // t0 = 2*Z 
+    fp2sqr_mont(t4, t1);                            // t1 = 4*X^2
+    mp2_sub_p2(t1, t3, t1);                         // t1 = 4*X^2 - (X+Z)^2 
+    mp2_sub_p2(t1, t2, t1);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
+    fp2mul_mont(A24plus, t3, t5);                   // t5 = A24plus*(X+Z)^2 
+    fp2mul_mont(t3, t5, t3);                        // t3 = A24plus*(X+Z)^4
+    fp2mul_mont(A24minus, t2, t6);                  // t6 = A24minus*(X-Z)^2
+    fp2mul_mont(t2, t6, t2);                        // t2 = A24minus*(X-Z)^4
+    mp2_sub_p2(t2, t3, t3);                         // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    mp2_sub_p2(t5, t6, t2);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
+    fp2mul_mont(t1, t2, t1);                        // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2add(t3, t1, t2);                             // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    fp2sqr_mont(t2, t2);                            // t2 = t2^2
+    fp2mul_mont(t4, t2, Q->X);                      // X3 = 2*X*t2
+    fp2sub(t3, t1, t1);                             // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2sqr_mont(t1, t1);                            // t1 = t1^2
+    fp2mul_mont(t0, t1, Q->Z);                      // Z3 = 2*Z*t1
+}
+
+// A24minus = (C-D)^2
+//  A24plus = (C+D)^2
+void xTPL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)              
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1, t2, t3, t4;
+
+    mp2_sub_p2(P->X, P->Z, t0);                     // t0 = P->X - P->Z
+    fp2sqr_mont(t0, t0);                            // sm = (P->X-P->Z)^2
+    mp2_add(P->X, P->Z, t1);                        // t1 = P->X + P->Z
+    fp2sqr_mont(t1, t1);                            // sp = (P->X+P->Z)^2
+    mp2_add(P->X, P->X, Q->X);                      // x2 = 2*P->X
+    fp2sqr_mont(Q->X, t2);                          // t2 = x2^2
+    fp2sub(t2, t1, t2);                             // t2 = x2^2 - sp
+    mp2_sub_p2(t2, t0, t2);                         // u = x2^2-sp - sm
+    fp2mul_mont(t1, A24plus, t3);                   // ap = sp*A24plus
+    fp2mul_mont(t1, t3, t1);                        // t1 = sp*ap
+    fp2mul_mont(t0, A24minus, t4);                  // am = sm*A24minus
+    fp2mul_mont(t0, t4, t0);                        // t0 = sm*am
+    fp2sub(t0, t1, t0);                             // v = sm*am - sp*ap
+    mp2_sub_p2(t3, t4, t1);                         // t1 = ap - am
+    fp2mul_mont(t2, t1, t1);                        // w = u*(ap-am)
+    mp2_add(t0, t1, t2);                            // t2 = v + w
+    mp2_sub_p2(t0, t1, t0);                         // t0 = v - w
+    fp2sqr_mont(t2, t1);                            // t1 = (v+w)^2
+    fp2mul_mont(Q->X, t1, Q->X);                    // Q->X = x2*(v+w)^2
+    fp2sqr_mont(t0, t0);                            // t0 = (v-w)^2
+    mp2_add(P->Z, P->Z, Q->Z);                      // Q->Z = 2*P->Z
+    fp2mul_mont(Q->Z, t0, Q->Z);                    // Q->Z = 2*P->Z*(v-w)^2
+}
+
+
+
+void xTPLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
+{ // Computes [3^e](X:Z) on Montgomery curve with projective constant via e repeated triplings.
+  // Input: projective Montgomery x-coordinates P = (XP:ZP), such that xP=XP/ZP and Montgomery curve constants A24plus = A+2C and A24minus = A-2C.
+  // Output: projective Montgomery x-coordinates Q <- (3^e)*P.
+    int i;
+        
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xTPL(Q, Q, A24minus, A24plus);
+    }
+}
+
+// A24minus = (C-D)^2
+//  A24plus = (C+D)^2
+void xTPLe_inplace_Huff(point_proj_t P, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
+{ // Computes [3^e](X:Z) on Huff curve with projective constant via e repeated triplings, in place.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants A24plus = (C+D)^2 and A24minus = (C-D)^2.
+  // Output: projective Huff w-coordinates P <- (3^e)*P.
+    int i;
+
+    for (i = 0; i < e; i++) {
+        xTPL_Huff(P, P, A24minus, A24plus);
+    }
+}
+
+void xTPLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
+{ // Computes [3^e](X:Z) on Huff curve with projective constant via e repeated triplings.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants A24plus = (C+D)^2 and A24minus = (C-D)^2.
+  // Output: projective Huff x-coordinates Q <- (3^e)*P. The first tripling reads P and writes Q, so P is only copied when e = 0.
+    if (e == 0) {
+        copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+        return;
+    }
+    xTPL_Huff(P, Q, A24minus, A24plus);
+    xTPLe_inplace_Huff(Q, A24minus, A24plus, e-1);
+}
+
+
+
+void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff)
+{ // Computes the corresponding 3-isogeny of a projective Montgomery point (X3:Z3) of order 3.
+  // Input:  projective point of order three P = (X3:Z3).
+  // Output: the 3-isogenous Montgomery curve with projective coefficient A/C. 
+    f2elm_t t0, t1, t2, t3, t4;
+    
+    mp2_sub_p2(P->X, P->Z, coeff[0]);               // coeff0 = X-Z
+    fp2sqr_mont(coeff[0], t0);                      // t0 = (X-Z)^2
+    mp2_add(P->X, P->Z, coeff[1]);                  // coeff1 = X+Z
+    fp2sqr_mont(coeff[1], t1);                      // t1 = (X+Z)^2
+    mp2_add(P->X, P->X, t3);                        // t3 = 2*X
+    fp2sqr_mont(t3, t3);                            // t3 = 4*X^2 
+    fp2sub(t3, t0, t2);                             // t2 = 4*X^2 - (X-Z)^2 
+    fp2sub(t3, t1, t3);                             // t3 = 4*X^2 - (X+Z)^2
+    mp2_add(t0, t3, t4);                            // t4 = 4*X^2 - (X+Z)^2 + (X-Z)^2 
+    mp2_add(t4, t4, t4);                            // t4 = 2(4*X^2 - (X+Z)^2 + (X-Z)^2) 
+    mp2_add(t1, t4, t4);                            // t4 = 8*X^2 - (X+Z)^2 + 2*(X-Z)^2
+    fp2mul_mont(t2, t4, A24minus);                  // A24minus = [4*X^2 - (X-Z)^2]*[8*X^2 - (X+Z)^2 + 2*(X-Z)^2] //(C=D)
+    mp2_add(t1, t2, t4);                            // t4 = 4*X^2 + (X+Z)^2 - (X-Z)^2
+    mp2_add(t4, t4, t4);                            // t4 = 2(4*X^2 + (X+Z)^2 - (X-Z)^2) 
+    mp2_add(t0, t4, t4);                            // t4 = 8*X^2 + 2*(X+Z)^2 - (X-Z)^2
+    fp2mul_mont(t3, t4, A24plus);                   // A24plus = [4*X^2 - (X+Z)^2]*[8*X^2 + 2*(X+Z)^2 - (X-Z)^2] //(C+D)^2
+}  
+
+// A24minus = (C-D)^2
+//  A24plus = (C+D)^2
+void get_3_isog_Huff(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1, t2;
+
+    fp2sub(P->X, P->Z, coeff[0]);                   // c0 = P->X - P->Z
+    fp2add(P->X, P->Z, coeff[1]);                   // c1 = P->X + P->Z
+    fp2sqr_mont(coeff[0], A24plus);                 // sm = c0^2
+    fp2sqr_mont(coeff[1], t0);                      // sp = c1^2
+    mp2_add(P->Z, P->Z, A24minus);                  // A24minus = 2*P->Z
+    fp2sqr_mont(A24minus, A24minus);                // z4 = (2*P->Z)^2
+    fp2sub(A24minus, A24plus, t1);                  // u = z4 - sm
+    fp2sub(A24minus, t0, t2);                       // v = z4 - sp
+    fp2add(A24plus, t2, A24minus);                  // A24minus = sm + v
+    fp2add(A24minus, A24minus, A24minus);           // A24minus = 2*(sm+v)
+    mp2_add(t0, A24minus, A24minus);                // A24minus = sp + 2*(sm+v)
+    fp2mul_mont(t1, A24minus, A24minus);            // A24minus = u*(sp+2*(sm+v))
+    fp2add(t0, t1, t0);                             // t0 = sp + u
+    fp2add(t0, t0, t0);                             // t0 = 2*(sp+u)
+    mp2_add(A24plus, t0, A24plus);                  // A24plus = sm + 2*(sp+u)
+    fp2mul_mont(t2, A24plus, A24plus);              // A24plus = v*(sm+2*(sp+u))
+}  
+
+void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
+{ // Computes the 3-isogeny R=phi(X:Z), given projective point (X3:Z3) of order 3 on a Montgomery curve and 
+  // a point P with 2 coefficients in coeff (computed in the function get_3_isog()).
+  // Inputs: projective points P = (X3:Z3) and Q = (X:Z).
+  // Output: the projective point Q <- phi(Q) = (X3:Z3). 
+    f2elm_t t0, t1, t2;
+
+    mp2_add(Q->X, Q->Z, t0);                      // t0 = X+Z
+    mp2_sub_p2(Q->X, Q->Z, t1);                   // t1 = X-Z
+    fp2mul_mont(coeff[0], t0, t0);                // t0 = coeff0*(X+Z)
+    fp2mul_mont(coeff[1], t1, t1);                // t1 = coeff1*(X-Z)
+    mp2_add(t0, t1, t2);                          // t2 = coeff0*(X+Z) + coeff1*(X-Z)
+    mp2_sub_p2(t1, t0, t0);                       // t0 = coeff1*(X-Z) - coeff0*(X+Z)
+    fp2sqr_mont(t2, t2);                          // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2sqr_mont(t0, t0);                          // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
+    fp2mul_mont(Q->X, t2, Q->X);                  // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2        
+    fp2mul_mont(Q->Z, t0, Q->Z);                  // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+}
+
+
+void eval_3_isog_Huff(point_proj_t Q, const f2elm_t* coeff)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1, t2;
+
+    mp2_add(Q->X, Q->Z, t0);                        // t0 = Q->X + Q->Z
+    fp2mul_mont(coeff[0], t0, t0);                  // a = coeff[0]*(Q->X+Q->Z)
+    mp2_sub_p2(Q->X, Q->Z, t1);                     // t1 = Q->X - Q->Z
+    fp2mul_mont(coeff[1], t1, t1);                  // b = coeff[1]*(Q->X-Q->Z)
+    mp2_sub_p2(t1, t0, t2);                         // t2 = b - a
+    mp2_add(t0, t1, t0);                            // t0 = a + b
+    fp2sqr_mont(t2, t1);                            // t1 = (b-a)^2
+    fp2mul_mont(Q->X, t1, Q->X);                    // Q->X = Q->X*(b-a)^2
+    fp2sqr_mont(t0, t0);                            // t0 = (a+b)^2
+    fp2mul_mont(Q->Z, t0, Q->Z);                    // Q->Z = Q->Z*(a+b)^2
+}
+
+
+
+void map_mont_huff(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective point between Montgomery x-coordinates and Huff w-coordinates, where w = 1/x (see monttohuff.sage).
+  // The map is an involution, Q = (Z:X) for P = (X:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2copy(P->X, t);
+    fp2copy(P->Z, Q->X);
+    fp2copy(t, Q->Z);
+}
+
+
+void huff_to_mont_curve(const f2elm_t CmDsq, const f2elm_t CD4, f2elm_t A24plus, f2elm_t C24)
+{ // Montgomery curve constants of the Huff curve with constants CmDsq = (C-D)^2 and CD4 = 4CD: A24plus = (C+D)^2 and C24 = 4CD.
+  // The Montgomery curve is y^2 = x^3 + (C^2+D^2)/(CD)*x^2 + x, on which w = 1/x.
+    fp2add(CmDsq, CD4, A24plus);
+    fp2copy(CD4, C24);
+}
+
+
+void map_mont_edwards(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective Montgomery x-coordinate to a twisted Edwards y-coordinate, where y = (x-1)/(x+1).
+  // Edwards points (Y:Z) are stored in the X and Z fields of a point_proj_t. Q = (X-Z:X+Z) for P = (X:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2sub(P->X, P->Z, t);
+    fp2add(P->X, P->Z, Q->Z);
+    fp2copy(t, Q->X);
+}
+
+
+void map_edwards_mont(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective twisted Edwards y-coordinate to a Montgomery x-coordinate, where x = (1+y)/(1-y).
+  // Q = (Z+Y:Z-Y) for P = (Y:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2add(P->Z, P->X, t);
+    fp2sub(P->Z, P->X, Q->Z);
+    fp2copy(t, Q->X);
+}
+
+
+// The twisted Edwards curve a*x^2 + y^2 = 1 + d*x^2*y^2 is birationally equivalent to the Montgomery curve with A = 2(a+d)/(a-d),
+// so its projective constants are those of the Montgomery kernels: A24plus = a, C24 = a-d and A24minus = d (up to a common factor).
+// The Edwards kernels are the Montgomery kernels with X-Z and X+Z replaced by Y and Z; their outputs are mapped back with Y = X-Z, Z = X+Z.
+
+void xDBL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd)
+{ // Doubling of a twisted Edwards point in projective y-coordinates (Y:Z).
+  // Input: projective Edwards y-coordinates P = (Y1:Z1), where y1=Y1/Z1 and Edwards curve constants a and a-d.
+  // Output: projective Edwards y-coordinates Q = 2*P = (Y2:Z2).
+    f2elm_t t0, t1, t2;
+    
+    fp2sqr_mont(P->X, t0);                          // t0 = Y1^2 
+    fp2sqr_mont(P->Z, t1);                          // t1 = Z1^2 
+    fp2mul_mont(amd, t0, t2);                       // t2 = (a-d)*Y1^2   
+    fp2mul_mont(t1, t2, Q->X);                      // X2 = (a-d)*Y1^2*Z1^2
+    mp2_sub_p2(t1, t0, t1);                         // t1 = Z1^2-Y1^2 
+    fp2mul_mont(a, t1, t0);                         // t0 = a*(Z1^2-Y1^2)
+    mp2_add(t2, t0, t2);                            // t2 = a*(Z1^2-Y1^2) + (a-d)*Y1^2
+    fp2mul_mont(t2, t1, t2);                        // Z2 = [a*(Z1^2-Y1^2) + (a-d)*Y1^2]*(Z1^2-Y1^2)
+    fp2add(Q->X, t2, Q->Z);                         // Zfinal = X2+Z2
+    fp2sub(Q->X, t2, Q->X);                         // Yfinal = X2-Z2
+}
+
+
+void xDBLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd, const int e)
+{ // Computes [2^e](Y:Z) on twisted Edwards curve with projective constants via e repeated doublings.
+  // Input: projective Edwards y-coordinates P = (YP:ZP), such that yP=YP/ZP and Edwards curve constants a and a-d.
+  // Output: projective Edwards y-coordinates Q <- (2^e)*P.
+    int i;
+    
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xDBL_Edwards(Q, Q, a, amd);
+    }
+}
+
+
+void get_4_isog_Edwards(const point_proj_t P, f2elm_t a, f2elm_t amd, f2elm_t* coeff)
+{ // Computes the corresponding 4-isogeny of a projective twisted Edwards point (Y4:Z4) of order 4.
+  // Input:  projective point of order four P = (Y4:Z4).
+  // Output: the 4-isogenous Edwards curve with projective constants a and a-d and the 3 coefficients 
+  //         that are used to evaluate the isogeny at a point in eval_4_isog_Edwards().
+    
+    fp2copy(P->X, coeff[1]);                        // coeff[1] = Y4
+    fp2copy(P->Z, coeff[2]);                        // coeff[2] = Z4
+    mp2_sub_p2(P->Z, P->X, coeff[0]);               // coeff[0] = Z4-Y4
+    fp2sqr_mont(coeff[0], coeff[0]);                // coeff[0] = (Z4-Y4)^2
+    fp2sqr_mont(coeff[0], amd);                     // amd = (Z4-Y4)^4
+    mp2_add(P->Z, P->X, a);                         // a = Z4+Y4
+    fp2sqr_mont(a, a);                              // a = (Z4+Y4)^2
+    fp2sqr_mont(a, a);                              // a = (Z4+Y4)^4
+}
+
+
+void eval_4_isog_Edwards(point_proj_t P, const f2elm_t* coeff)
+{ // Evaluates the isogeny at the point (Y:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
+  // by the 3 coefficients in coeff (computed in the function get_4_isog_Edwards()).
+  // Inputs: the coefficients defining the isogeny, and the projective point P = (Y:Z).
+  // Output: the projective point P = phi(P) = (Y:Z) in the codomain. 
+    f2elm_t t0, t1, t2;
+    
+    fp2mul_mont(P->Z, coeff[1], t2);                // t2 = Z*coeff[1]
+    fp2mul_mont(P->X, coeff[2], t1);                // t1 = Y*coeff[2]
+    fp2mul_mont(P->Z, P->X, t0);                    // t0 = Z*Y
+    fp2mul_mont(coeff[0], t0, t0);                  // t0 = coeff[0]*Z*Y
+    mp2_add(t2, t1, P->X);                          // X = Y*coeff[2] + Z*coeff[1]
+    mp2_sub_p2(t1, t2, P->Z);                       // Z = Y*coeff[2] - Z*coeff[1]
+    fp2sqr_mont(P->X, t1);                          // t1 = [Y*coeff[2] + Z*coeff[1]]^2
+    fp2sqr_mont(P->Z, P->Z);                        // Z = [Y*coeff[2] - Z*coeff[1]]^2
+    mp2_add(t1, t0, P->X);                          // X = coeff[0]*Z*Y + [Y*coeff[2] + Z*coeff[1]]^2
+    mp2_sub_p2(P->Z, t0, t0);                       // t0 = [Y*coeff[2] - Z*coeff[1]]^2 - coeff[0]*Z*Y
+    fp2mul_mont(P->X, t1, t2);                      // X = X*t1
+    fp2mul_mont(P->Z, t0, t0);                      // Z = Z*t0
+    fp2add(t2, t0, P->Z);                           // Zfinal = X+Z
+    fp2sub(t2, t0, P->X);                           // Yfinal = X-Z
+}
+
+
+void xTPL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a)              
+{ // Tripling of a twisted Edwards point in projective y-coordinates (Y:Z).
+  // Input: projective Edwards y-coordinates P = (Y:Z), where y=Y/Z and Edwards curve constants d and a.
+  // Output: projective Edwards y-coordinates Q = 3*P = (Y3:Z3).
+    f2elm_t t0, t1, t2, t3, t4, t5, t6;
+                                    
+    fp2sqr_mont(P->X, t2);                          // t2 = Y^2           
+    fp2sqr_mont(P->Z, t3);                          // t3 = Z^2
+    mp2_add(P->Z, P->X, t4);                        // t4 = Z+Y
+    mp2_sub_p2(P->Z, P->X, t0);                     // t0 = Z-Y 
+    fp2sqr_mont(t4, t1);                            // t1 = (Z+Y)^2
+    mp2_sub_p2(t1, t3, t1);                         // t1 = (Z+Y)^2 - Z^2 
+    mp2_sub_p2(t1, t2, t1);                         // t1 = (Z+Y)^2 - Z^2 - Y^2
+    fp2mul_mont(a, t3, t5);                         // t5 = a*Z^2 
+    fp2mul_mont(t3, t5, t3);                        // t3 = a*Z^4
+    fp2mul_mont(d, t2, t6);                         // t6 = d*Y^2
+    fp2mul_mont(t2, t6, t2);                        // t2 = d*Y^4
+    mp2_sub_p2(t2, t3, t3);                         // t3 = d*Y^4 - a*Z^4
+    mp2_sub_p2(t5, t6, t2);                         // t2 = a*Z^2 - d*Y^2
+    fp2mul_mont(t1, t2, t1);                        // t1 = 2*Y*Z*[a*Z^2 - d*Y^2]
+    fp2add(t3, t1, t2);                             // t2 = 2*Y*Z*[a*Z^2 - d*Y^2] + d*Y^4 - a*Z^4
+    fp2sqr_mont(t2, t2);                            // t2 = t2^2
+    fp2mul_mont(t4, t2, t2);                        // X3 = (Z+Y)*t2
+    fp2sub(t3, t1, t1);                             // t1 = d*Y^4 - a*Z^4 - 2*Y*Z*[a*Z^2 - d*Y^2]
+    fp2sqr_mont(t1, t1);                            // t1 = t1^2
+    fp2mul_mont(t0, t1, t1);                        // Z3 = (Z-Y)*t1
+    fp2add(t2, t1, Q->Z);                           // Zfinal = X3+Z3
+    fp2sub(t2, t1, Q->X);                           // Yfinal = X3-Z3
+}
+
+
+void xTPLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a, const int e)
+{ // Computes [3^e](Y:Z) on twisted Edwards curve with projective constants via e repeated triplings.
+  // Input: projective Edwards y-coordinates P = (YP:ZP), such that yP=YP/ZP and Edwards curve constants d and a.
+  // Output: projective Edwards y-coordinates Q <- (3^e)*P.
+    int i;
+        
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xTPL_Edwards(Q, Q, d, a);
+    }
+}
+
+
+void get_3_isog_Edwards(const point_proj_t P, f2elm_t d, f2elm_t a, f2elm_t* coeff)
+{ // Computes the corresponding 3-isogeny of a projective twisted Edwards point (Y3:Z3) of order 3.
+  // Input:  projective point of order three P = (Y3:Z3).
+  // Output: the 3-isogenous Edwards curve with projective constants d and a, and the 2 coefficients
+  //         that are used to evaluate the isogeny at a point in eval_3_isog_Edwards(). 
+    f2elm_t t0, t1, t2, t3, t4;
+    
+    fp2copy(P->X, coeff[0]);                        // coeff0 = Y
+    fp2sqr_mont(P->X, t0);                          // t0 = Y^2
+    fp2copy(P->Z, coeff[1]);                        // coeff1 = Z
+    fp2sqr_mont(P->Z, t1);                          // t1 = Z^2
+    mp2_add(P->Z, P->X, t3);                        // t3 = Z+Y
+    fp2sqr_mont(t3, t3);                            // t3 = (Z+Y)^2 
+    fp2sub(t3, t0, t2);                             // t2 = (Z+Y)^2 - Y^2 
+    fp2sub(t3, t1, t3);                             // t3 = (Z+Y)^2 - Z^2
+    mp2_add(t0, t3, t4);                            // t4 = (Z+Y)^2 - Z^2 + Y^2 
+    mp2_add(t4, t4, t4);                            // t4 = 2((Z+Y)^2 - Z^2 + Y^2) 
+    mp2_add(t1, t4, t4);                            // t4 = 2*(Z+Y)^2 - Z^2 + 2*Y^2
+    fp2mul_mont(t2, t4, d);                         // d = [(Z+Y)^2 - Y^2]*[2*(Z+Y)^2 - Z^2 + 2*Y^2]
+    mp2_add(t1, t2, t4);                            // t4 = (Z+Y)^2 + Z^2 - Y^2
+    mp2_add(t4, t4, t4);                            // t4 = 2((Z+Y)^2 + Z^2 - Y^2) 
+    mp2_add(t0, t4, t4);                            // t4 = 2*(Z+Y)^2 + 2*Z^2 - Y^2
+    fp2mul_mont(t3, t4, a);                         // a = [(Z+Y)^2 - Z^2]*[2*(Z+Y)^2 + 2*Z^2 - Y^2]
+}  
+
+
+void eval_3_isog_Edwards(point_proj_t Q, const f2elm_t* coeff)
+{ // Computes the 3-isogeny R=phi(Y:Z), given projective point (Y3:Z3) of order 3 on a twisted Edwards curve and 
+  // a point P with 2 coefficients in coeff (computed in the function get_3_isog_Edwards()).
+  // Inputs: projective points P = (Y3:Z3) and Q = (Y:Z).
+  // Output: the projective point Q <- phi(Q) = (Y3:Z3). 
+    f2elm_t t0, t1, t2, t3;
+
+    fp2mul_mont(coeff[0], Q->Z, t0);              // t0 = coeff0*Z
+    fp2mul_mont(coeff[1], Q->X, t1);              // t1 = coeff1*Y
+    mp2_add(t0, t1, t2);                          // t2 = coeff0*Z + coeff1*Y
+    mp2_sub_p2(t1, t0, t0);                       // t0 = coeff1*Y - coeff0*Z
+    fp2sqr_mont(t2, t2);                          // t2 = [coeff0*Z + coeff1*Y]^2
+    fp2sqr_mont(t0, t0);                          // t0 = [coeff1*Y - coeff0*Z]^2
+    mp2_add(Q->Z, Q->X, t1);                      // t1 = Z+Y
+    mp2_sub_p2(Q->Z, Q->X, t3);                   // t3 = Z-Y
+    fp2mul_mont(t1, t2, t2);                      // X3 = (Z+Y)*[coeff0*Z + coeff1*Y]^2        
+    fp2mul_mont(t3, t0, t0);                      // Z3 = (Z-Y)*[coeff1*Y - coeff0*Z]^2
+    fp2add(t2, t0, Q->Z);                         // Zfinal = X3+Z3
+    fp2sub(t2, t0, Q->X);                         // Yfinal = X3-Z3
+}
+
+
+void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3)
+{ // 3-way simultaneous inversion
+  // Input:  z1,z2,z3
+  // Output: 1/z1,1/z2,1/z3 (override inputs).
+    f2elm_t t0, t1, t2, t3;
+
+    fp2mul_mont(z1, z2, t0);                      // t0 = z1*z2
+    fp2mul_mont(z3, t0, t1);                      // t1 = z1*z2*z3
+    fp2inv_mont(t1);                              // t1 = 1/(z1*z2*z3)
+    fp2mul_mont(z3, t1, t2);                      // t2 = 1/(z1*z2) 
+    fp2mul_mont(t2, z2, t3);                      // t3 = 1/z1
+    fp2mul_mont(t2, z1, z2);                      // z2 = 1/z2
+    fp2mul_mont(t0, t1, z3);                      // z3 = 1/z3
+    fp2copy(t3, z1);                              // z1 = 1/z1
+}
+
+
+void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
+{ // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
+  // Input:  the x-coordinates xP, xQ, and xR of the points P, Q and R.
+  // Output: the coefficient A corresponding to the curve E_A: y^2=x^3+A*x^2+x.
+    f2elm_t t0, t1, one = {0};
+    
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2add(xP, xQ, t1);                           // t1 = xP+xQ
+    fp2mul_mont(xP, xQ, t0);                      // t0 = xP*xQ
+    fp2mul_mont(xR, t1, A);                       // A = xR*t1
+    fp2add(t0, A, A);                             // A = A+t0
+    fp2mul_mont(t0, xR, t0);                      // t0 = t0*xR
+    fp2sub(A, one, A);                            // A = A-1
+    fp2add(t0, t0, t0);                           // t0 = t0+t0
+    fp2add(t1, xR, t1);                           // t1 = t1+xR
+    fp2add(t0, t0, t0);                           // t0 = t0+t0
+    fp2sqr_mont(A, A);                            // A = A^2
+    fp2inv_mont(t0);                              // t0 = 1/t0
+    fp2mul_mont(A, t0, A);                        // A = A*t0
+    fp2sub(A, t1, A);                             // Afinal = A-t1
+}
+
+
+void get_A_Huff_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A, f2elm_t C)
+{ // Given the w-coordinates of P, Q, and R, returns the value A/C=c+1/c-2 corresponding to the Huff curve E_c: cx(y^2-1)=y(x^2-1) such that R=Q-P on E_c.
+  // Input:  the w-coordinates xP, xQ, and xR of the points P, Q and R.
+  // Output: the projective value A/C=c+1/c-2 corresponding to the curve E_c: cx(y^2-1)=y(x^2-1), with C = 4wR*wP*wQ.
+    f2elm_t t0;
+
+    fp2mul_mont(xR, xP, t0);                     // t0 = wR*wP
+    fp2mul_mont(t0, xQ, C);                      // C = wR*wP*wQ
+
+    fp2sub(xP, xQ, A);                           // A = wP-wQ 
+    fp2sub(A, C, A);                             // A = wP-wQ-wR*wP*wQ
+    fp2add(A, xR, A);                            // A = wP-wQ-wR*wP*wQ+wR   
+    fp2sqr_mont(A, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2
+
+    fp2add(C, C, C);                             // C = 2wR*wP*wQ
+    fp2add(C, C, C);                             // C = 4wR*wP*wQ
+
+    fp2add(t0, t0, t0);                         // t0 = 2wR*wP
+    fp2add(t0, C, t0);                          // t0 = 4wR*wP*wQ + 2wR*wP
+    fp2add(t0, t0, t0);                         // t0 = 8wR*wP*wQ + 4wR*wP
+    fp2sub(A, t0, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP
+
+    fp2mul_mont(xQ, C, t0);                     // t0 = 4wR*wP*wQ^2
+    fp2sub(A, t0, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP - 4wR*wP*wQ^2
+}
+
+
+void get_A_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
+{ // Given the w-coordinates of P, Q, and R, returns the value A=c+1/c-2 corresponding to the Huff curve E_c: cx(y^2-1)=y(x^2-1) such that R=Q-P on E_c.
+  // Input:  the w-coordinates xP, xQ, and xR of the points P, Q and R.
+  // Output: the value A=c+1/c-2 corresponding to the curve E_c: cx(y^2-1)=y(x^2-1).
+    f2elm_t C;
+
+    get_A_Huff_proj(xP, xQ, xR, A, C);
+    fp2inv_mont_bingcd(C);                      // C = 1/4wR*wP*wQ, not in constant time: the w-coordinates are public
+    fp2mul_mont(A, C, A);
+}
+
+
+
+void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv)
+{ // Computes the j-invariant of a Montgomery curve with projective constant.
+  // Input: A,C in GF(p^2).
+  // Output: j=256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2)), which is the j-invariant of the Montgomery curve B*y^2=x^3+(A/C)*x^2+x or (equivalently) j-invariant of B'*y^2=C*x^3+A*x^2+C*x.
+    f2elm_t t0, t1;
+    
+    fp2sqr_mont(A, jinv);                           // jinv = A^2        
+    fp2sqr_mont(C, t1);                             // t1 = C^2
+    fp2add(t1, t1, t0);                             // t0 = t1+t1
+    fp2sub(jinv, t0, t0);                           // t0 = jinv-t0
+    fp2sub(t0, t1, t0);                             // t0 = t0-t1
+    fp2sub(t0, t1, jinv);                           // jinv = t0-t1
+    fp2sqr_mont(t1, t1);                            // t1 = t1^2
+    fp2mul_mont(jinv, t1, jinv);                    // jinv = jinv*t1
+    fp2add(t0, t0, t0);                             // t0 = t0+t0
+    fp2add(t0, t0, t0);                             // t0 = t0+t0
+    fp2sqr_mont(t0, t1);                            // t1 = t0^2
+    fp2mul_mont(t0, t1, t0);                        // t0 = t0*t1
+    fp2add(t0, t0, t0);                             // t0 = t0+t0
+    fp2add(t0, t0, t0);                             // t0 = t0+t0
+    fp2inv_mont(jinv);                              // jinv = 1/jinv 
+    fp2mul_mont(jinv, t0, jinv);                    // jinv = t0*jinv
+}
+
+
+
+void j_inv_Huff(const f2elm_t CpD, const f2elm_t CmD, const f2elm_t CD4, f2elm_t jinv)
+{ // Computes the j-invariant of a Huff curve with projective constant.
+  // Input: CpD=(C+D)^2, CmD=(C-D)^2, CD4=4CD in GF(p^2).
+  // Output: j=256*(C^4-C^2D^2+D^4)^3/(C^4D^4*(A^2-C^2)^2), which is the j-invariant of the Huff curve (C/D)x(y^2-1)=y(x^2-1) or (equivalently) j-invariant of  Cx(y^2-1)=Dy(x^2-1)
+    f2elm_t t0, t1, t2;
+    
+    fp2mul_mont(CpD, CmD, t0);              // t0 = (C-D)^2(C+D)^2
+    fp2sqr_mont(CD4, t1);                   // t1 = 2^4(C^2D^2)
+    fp2sqr_mont(t1, t2);                    // t2 = 2^8(C^4D^4)
+    fp2mul_mont(t0, t2, t2);                // t2 = 2^8(C^4D^4)(C-D)^2(C+D)^2
+    fp2add(t1, t1, t1);                     // t1 = 2^5(C^2D^2)
+    fp2add(t0, t0, t0);                     // t0 = 2*(C-D)^2(C+D)^2
+    fp2add(t0, t0, t0);                     // t0 = 4*t0
+    fp2add(t0, t0, t0);                     // t0 = 8*t0
+    fp2add(t0, t0, t0);                     // t0 = 16*t0
+    fp2add(t0, t0, t0);                     // t0 = 32*C-D)^2(C+D)^2
+    fp2add(t0, t1, t1);                     // t1  =32(C^4-C^2D^2+D^4)
+    fp2sqr_mont(t1, t0);                    // t0 = 2^10*A^2                 
+    fp2mul_mont(t0, t1, t0);                // t0 = 2^15*A^3  
+    fp2add(t0, t0, t0);                       // t0 = 2^16*A^3 
+    fp2inv_mont(t2);
+    fp2mul_mont(t0, t2, jinv);
+}
+
+
+
+void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t xPQ, const f2elm_t A24)
+{ // Simultaneous doubling and differential addition.
+  // Input: projective Montgomery points P=(XP:ZP) and Q=(XQ:ZQ) such that xP=XP/ZP and xQ=XQ/ZQ, affine difference xPQ=x(P-Q) and Montgomery curve constant A24=(A+2)/4.
+  // Output: projective Montgomery points P <- 2*P = (X2P:Z2P) such that x(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = x(Q+P)=XQP/ZQP. 
+    f2elm_t t0, t1, t2;
+
+    mp2_add(P->X, P->Z, t0);                        // t0 = XP+ZP
+    mp2_sub_p2(P->X, P->Z, t1);                     // t1 = XP-ZP
+    fp2sqr_mont(t0, P->X);                          // XP = (XP+ZP)^2
+    mp2_sub_p2(Q->X, Q->Z, t2);                     // t2 = XQ-ZQ
+    mp2_add(Q->X, Q->Z, Q->X);                      // XQ = XQ+ZQ
+    fp2mul_mont(t0, t2, t0);                        // t0 = (XP+ZP)*(XQ-ZQ)
+    fp2sqr_mont(t1, P->Z);                          // ZP = (XP-ZP)^2
+    fp2mul_mont(t1, Q->X, t1);                      // t1 = (XP-ZP)*(XQ+ZQ)
+    mp2_sub_p2(P->X, P->Z, t2);                     // t2 = (XP+ZP)^2-(XP-ZP)^2
+    fp2mul_mont(P->X, P->Z, P->X);                  // XP = (XP+ZP)^2*(XP-ZP)^2
+    fp2mul_mont(A24, t2, Q->X);                     // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]
+    mp2_sub_p2(t0, t1, Q->Z);                       // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    mp2_add(Q->X, P->Z, P->Z);                      // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2
+    mp2_add(t0, t1, Q->X);                          // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    fp2mul_mont(P->Z, t2, P->Z);                    // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    fp2mul_mont(Q->Z, xPQ, Q->Z);                   // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+}
+
+// A24 = 1/4(c+1/c-2)
+void xDBLADD_Huff(point_proj_t P, point_proj_t Q, const f2elm_t xPQ, const f2elm_t A24)
+{ // Simultaneous doubling and differential addition.
+  // Input: projective Huff points P=(XP:ZP) and Q=(XQ:ZQ) such that wP=XP/ZP and wQ=XQ/ZQ, affine difference wPQ=w(P-Q) and Huff curve constant A24=1/4(c+1/c-2).
+  // Output: projective Huff points P <- 2*P = (X2P:Z2P) such that w(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = w(Q+P)=XQP/ZQP. 
+    f2elm_t t0, t1, t2, t3;
+
+    mp2_add(P->X, P->Z, t0);                        // t0 = XP+ZP
+    mp2_sub_p2(P->X, P->Z, t1);                     // t1 = XP-ZP
+    fp2sqr_mont(t0, t3);                          // t3 = (XP+ZP)^2
+    mp2_sub_p2(Q->X, Q->Z, t2);                     // t2 = XQ-ZQ
+    mp2_add(Q->X, Q->Z, Q->Z);                      // ZQ = XQ+ZQ
+    fp2mul_mont(t0, t2, t0);                        // t0 = (XP+ZP)*(XQ-ZQ)
+    fp2sqr_mont(t1, P->X);                          // XP = (XP-ZP)^2
+    fp2mul_mont(t1, Q->Z, t1);                      // t1 = (XP-ZP)*(XQ+ZQ)
+    mp2_sub_p2(t3, P->X, t2);                     // t2 = (XP+ZP)^2-(XP-ZP)^2 // 4XpZp
+    fp2mul_mont(t3, P->X, P->Z);                  // ZP = (XP+ZP)^2*(XP-ZP)^2
+
+    fp2mul_mont(A24, t2, Q->Z);                     // ZQ = A24*[(XP+ZP)^2-(XP-ZP)^2] = 4CXPZP
+    mp2_sub_p2(t0, t1, Q->X);                       // XQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    mp2_add(Q->Z, t3, P->X);                      // XP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP+ZP)^2
+    mp2_add(t0, t1, Q->Z);                          // ZQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ) = XpXq-ZpZq
+    fp2mul_mont(P->X, t2, P->X);                    // XP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2 //XpXq-ZpZq
+
+    fp2mul_mont(Q->Z, xPQ, Q->Z);                   // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+}
+
+
+static void swap_points(point_proj_t P, point_proj_t Q, const digit_t option)
+{ // Swap points.
+  // If option = 0 then P <- P and Q <- Q, else if option = 0xFF...FF then P <- Q and Q <- P
+    digit_t temp;
+    unsigned int i;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        temp = option & (P->X[0][i] ^ Q->X[0][i]);
+        P->X[0][i] = temp ^ P->X[0][i]; 
+        Q->X[0][i] = temp ^ Q->X[0][i];  
+        temp = option & (P->X[1][i] ^ Q->X[1][i]);
+        P->X[1][i] = temp ^ P->X[1][i]; 
+        Q->X[1][i] = temp ^ Q->X[1][i];
+        temp = option & (P->Z[0][i] ^ Q->Z[0][i]);
+        P->Z[0][i] = temp ^ P->Z[0][i]; 
+        Q->Z[0][i] = temp ^ Q->Z[0][i];
+        temp = option & (P->Z[1][i] ^ Q->Z[1][i]);
+        P->Z[1][i] = temp ^ P->Z[1][i]; 
+        Q->Z[1][i] = temp ^ Q->Z[1][i]; 
+    }
+}
+
+
+static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A)
+{
+    point_proj_t R0 = {0}, R2 = {0};
+    f2elm_t A24 = {0};
+    digit_t mask;
+    int i, nbits, bit, swap, prevbit = 0;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+    } else {
+        nbits = OBOB_BITS - 1;
+    }
+
+    // Initializing constant
+    fpcopy((digit_t*)&Montgomery_one, A24[0]);
+    mp2_add(A24, A24, A24);
+    mp2_add(A, A24, A24);
+    fp2div2(A24, A24);  
+    fp2div2(A24, A24);  // A24 = (A+2)/4
+
+    // Initializing points
+    fp2copy(xQ, R0->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R0->Z);
+    fp2copy(xPQ, R2->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
+    fp2copy(xP, R->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
+    fpzero((digit_t*)(R->Z)[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R, R2, mask);
+        xDBLADD(R0, R2, R->X, A24);
+        fp2mul_mont(R2->X, R->Z, R2->X);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R, R2, mask);
+}
+
+
+
+static void LADDER3PT_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A, const f2elm_t C)
+{ // Huff three-point ladder R = P+[m]Q on the curve A/C = c+1/c-2, from the w-coordinates xP, xQ and xPQ of P, Q and P-Q.
+  // C = NULL stands for C = 1. Otherwise the curve comes from a public key and A/C is normalized with one variable-time inversion.
+    point_proj_t R0 = {0}, R2 = {0};
+    f2elm_t A24 = {0};
+    digit_t mask;
+    int i, nbits, bit, swap, prevbit = 0;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+    } else {
+        nbits = OBOB_BITS - 1;
+    }
+
+    // Initializing constant: A24 = A/(4C)
+    if (C == NULL) {
+        fp2div2(A, A24);
+        fp2div2(A24, A24);
+    } else {
+        fp2add(C, C, A24);
+        fp2add(A24, A24, A24);
+        fp2inv_mont_bingcd(A24);                // The curve is public: the binary GCD is much faster than fp2inv_mont()
+        fp2mul_mont(A, A24, A24);
+    }
+
+    // Initializing points
+    fp2copy(xQ, R0->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R0->Z);
+    fp2copy(xPQ, R2->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
+    fp2copy(xP, R->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
+    fpzero((digit_t*)(R->Z)[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R, R2, mask);
+        xDBLADD_Huff(R0, R2, R->X, A24);
+        fp2mul_mont(R2->X, R->Z, R2->X);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R, R2, mask);
+}
+
+
+#ifdef FIXED_BASE
+// The fixed-base tables fixed_base_A and fixed_base_B of the key generation kernel computation are generated by fixedgen.py.
+// Entry i holds {X_i+Z_i, X_i-Z_i}, where (X_i:Z_i) are the projective w-coordinates of [2^i]Q for the public generator Q of
+// Alice (resp. Bob) on the starting Huff curve.
+
+
+static void xADD_fixed_Huff(point_proj_t Q, const f2elm_t* T, const point_proj_t PQ)
+{ // Differential addition of a precomputed Huff point.
+  // Input: projective Huff point Q=(XQ:ZQ), table entry T = {XT+ZT, XT-ZT} of a point T and projective difference PQ=(XPQ:ZPQ) of Q and T.
+  // Output: projective Huff point Q <- Q+T = (XQT:ZQT).
+    f2elm_t t0, t1;
+
+    mp2_sub_p2(Q->X, Q->Z, t0);                     // t0 = XQ-ZQ
+    mp2_add(Q->X, Q->Z, t1);                        // t1 = XQ+ZQ
+    fp2mul_mont(T[0], t0, t0);                      // t0 = (XT+ZT)*(XQ-ZQ)
+    fp2mul_mont(T[1], t1, t1);                      // t1 = (XT-ZT)*(XQ+ZQ)
+    mp2_sub_p2(t0, t1, Q->X);                       // XQ = (XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)
+    mp2_add(t0, t1, Q->Z);                          // ZQ = (XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)
+    fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)]^2
+    fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)]^2
+    fp2mul_mont(Q->X, PQ->Z, Q->X);                 // XQ = ZPQ*[(XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)]^2
+    fp2mul_mont(Q->Z, PQ->X, Q->Z);                 // ZQ = XPQ*[(XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)]^2
+}
+
+
+static void LADDER3PT_fixed_Huff(const f2elm_t xP, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R)
+{ // Fixed-base version of LADDER3PT_Huff for the public basis on the starting curve. Computes R = P+[m]Q.
+  // The multiples [2^i]Q are read from a precomputed table. The table index only depends on the loop counter,
+  // so memory accesses are independent of the secret scalar m, and each step costs a single differential addition.
+    point_proj_t R2 = {0};
+    const f2elm_t (*table)[2];
+    digit_t mask;
+    int i, nbits, bit, swap, prevbit = 0;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+        table = (const f2elm_t (*)[2])fixed_base_A;
+    } else {
+        nbits = OBOB_BITS - 1;
+        table = (const f2elm_t (*)[2])fixed_base_B;
+    }
+
+    // Initializing points
+    fp2copy(xPQ, R2->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
+    fp2copy(xP, R->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
+    fpzero((digit_t*)(R->Z)[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R, R2, mask);
+        xADD_fixed_Huff(R2, table[i], R);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R, R2, mask);
+}
+#endif
+
+
+
+
+#ifdef COMPRESS
+
+static void CompletePoint(const point_proj_t P, point_full_proj_t R)
+{ // Complete point on A = 0 curve
+    f2elm_t xz, s2, r2, yz, invz, t0, t1, one = {0};
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2mul_mont(P->X, P->Z, xz);
+    fpsub(P->X[0], P->Z[1], t0[0]);
+    fpadd(P->X[1], P->Z[0], t0[1]);
+    fpadd(P->X[0], P->Z[1], t1[0]);
+    fpsub(P->X[1], P->Z[0], t1[1]);
+    fp2mul_mont(t0, t1, s2);
+    fp2mul_mont(xz, s2, r2);
+    sqrt_Fp2(r2, yz);
+    fp2copy(P->Z,invz);
+    fp2inv_mont_bingcd(invz);    
+    fp2mul_mont(P->X, invz, R->X);
+    fp2sqr_mont(invz, t0);
+    fp2mul_mont(yz, t0, R->Y);
+    fp2copy(one, R->Z);
+}
+
+
+void CompleteMPoint(const f2elm_t A, point_proj_t P, point_full_proj_t R)
+{ // Given an xz-only representation on a montgomery curve, compute its affine representation
+    f2elm_t zero = {0}, one = {0}, xz, yz, s2, r2, invz, temp0, temp1;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);    
+    if (!is_fp2_zero(P->Z)) {
+        fp2mul_mont(P->X, P->Z, xz);       // xz = x*z;
+        fpsub(P->X[0], P->Z[1], temp0[0]);
+        fpadd(P->X[1], P->Z[0], temp0[1]);
+        fpadd(P->X[0], P->Z[1], temp1[0]);
+        fpsub(P->X[1], P->Z[0], temp1[1]);        
+        fp2mul_mont(temp0, temp1, s2);     // s2 = (x + i*z)*(x - i*z);
+        fp2mul_mont(A, xz, temp0);
+        fp2add(temp0, s2, temp1);
+        fp2mul_mont(xz, temp1, r2);        // r2 = xz*(A*xz + s2);
+        sqrt_Fp2(r2, yz);
+        fp2copy(P->Z, invz);
+        fp2inv_mont_bingcd(invz);        
+        fp2mul_mont(P->X, invz, R->X);
+        fp2sqr_mont(invz, temp0);
+        fp2mul_mont(yz, temp0, R->Y);      // R = EM![x*invz, yz*invz^2];
+        fp2copy(one, R->Z);
+    } else {
+        fp2copy(zero, R->X);
+        fp2copy(one, R->Y); 
+        fp2copy(zero, R->Z);               // R = EM!0;
+    }
+}
+
+
+void Double(point_proj_t P, point_proj_t Q, f2elm_t A24, const int k)
+{ // Doubling of a Montgomery point in projective coordinates (X:Z) over affine curve coefficient A. 
+  // Input: projective Montgomery x-coordinates P = (X1:Z1), where x1=X1/Z1 and Montgomery curve constants (A+2)/4.
+  // Output: projective Montgomery x-coordinates Q = 2*P = (X2:Z2). 
+    f2elm_t temp, a, b, c, aa, bb;    
+    
+    fp2copy(P->X, Q->X);
+    fp2copy(P->Z, Q->Z);
+    
+    for (int j = 0; j < k; j++) {
+        fp2add(Q->X, Q->Z, a);
+        fp2sub(Q->X, Q->Z, b);
+        fp2sqr_mont(a, aa);
+        fp2sqr_mont(b, bb);
+        fp2sub(aa, bb, c);
+        fp2mul_mont(aa, bb, Q->X);
+        fp2mul_mont(A24, c, temp);
+        fp2add(temp, bb, temp);
+        fp2mul_mont(c, temp, Q->Z);
+    }
+}
+
+
+void xTPL_fast(const point_proj_t P, point_proj_t Q, const f2elm_t A2)
+{ // Montgomery curve (E: y^2 = x^3 + A*x^2 + x) x-only tripling at a cost 5M + 6S + 9A = 27p + 61a.
+  // Input : projective Montgomery x-coordinates P = (X:Z), where x=X/Z and Montgomery curve constant A/2. 
+  // Output: projective Montgomery x-coordinates Q = 3*P = (X3:Z3).
+       f2elm_t t1, t2, t3, t4;
+       
+       fp2sqr_mont(P->X, t1);        // t1 = x^2
+       fp2sqr_mont(P->Z, t2);        // t2 = z^2
+       fp2add(t1, t2, t3);           // t3 = t1 + t2
+       fp2add(P->X, P->Z, t4);       // t4 = x + z
+       fp2sqr_mont(t4, t4);          // t4 = t4^2
+       fp2sub(t4, t3, t4);           // t4 = t4 - t3
+       fp2mul_mont(A2, t4, t4);      // t4 = t4*A2
+       fp2add(t3, t4, t4);           // t4 = t4 + t3
+       fp2sub(t1, t2, t3);           // t3 = t1 - t2
+       fp2sqr_mont(t3, t3);          // t3 = t3^2
+       fp2mul_mont(t1, t4, t1);      // t1 = t1*t4
+       fp2shl(t1, 2, t1);            // t1 = 4*t1
+       fp2sub(t1, t3, t1);           // t1 = t1 - t3
+       fp2sqr_mont(t1, t1);          // t1 = t1^2
+       fp2mul_mont(t2, t4, t2);      // t2 = t2*t4
+       fp2shl(t2, 2, t2);            // t2 = 4*t2
+       fp2sub(t2, t3, t2);           // t2 = t2 - t3
+       fp2sqr_mont(t2, t2);          // t2 = t2^2
+       fp2mul_mont(P->X, t2, Q->X);  // x = x*t2
+       fp2mul_mont(P->Z, t1, Q->Z);  // z = z*t1    
+}
+
+
+void xTPLe_fast(point_proj_t P, point_proj_t Q, const f2elm_t A2, int e)
+{ // Computes [3^e](X:Z) on Montgomery curve with projective constant via e repeated triplings. e triplings in E costs k*(5M + 6S + 9A)
+  // Input: projective Montgomery x-coordinates P = (X:Z), where x=X/Z, Montgomery curve constant A2 = A/2 and the number of triplings e.
+  // Output: projective Montgomery x-coordinates Q <- [3^e]P.    
+    point_proj_t T;
+
+    copy_words((digit_t*)P, (digit_t*)T, 2*2*NWORDS_FIELD);
+    for (int j = 0; j < e; j++) { 
+        xTPL_fast(T, T, A2);
+    }
+    copy_words((digit_t*)T, (digit_t*)Q, 2*2*NWORDS_FIELD);
+}
+
+
+void ADD(const point_full_proj_t P, const f2elm_t QX, const f2elm_t QY, const f2elm_t QZ, const f2elm_t A, point_full_proj_t R)
+{ // General addition.
+  // Input: projective Montgomery points P=(XP:YP:ZP) and Q=(XQ:YQ:ZQ).
+  // Output: projective Montgomery point R <- P+Q = (XQP:YQP:ZQP). 
+    f2elm_t t0 = {0}, t1 = {0}, t2 = {0}, t3 = {0}, t4 = {0}, t5 = {0}, t6 = {0}, t7 = {0};
+
+    fp2mul_mont(QX, P->Z, t0);            // t0 = x2*Z1    
+    fp2mul_mont(P->X, QZ, t1);            // t1 = X1*z2    
+    fp2add(t0, t1, t2);                   // t2 = t0 + t1
+    fp2sub(t1, t0, t3);                   // t3 = t1 - t0
+    fp2mul_mont(QX, P->X, t0);            // t0 = x2*X1    
+    fp2mul_mont(P->Z, QZ, t1);            // t1 = Z1*z2
+    fp2add(t0, t1, t4);                   // t4 = t0 + t1
+    fp2mul_mont(t0, A, t0);               // t0 = t0*A
+    fp2mul_mont(QY, P->Y, t5);            // t5 = y2*Y1
+    fp2sub(t0, t5, t0);                   // t0 = t0 - t5
+    fp2mul_mont(t0, t1, t0);              // t0 = t0*t1
+    fp2add(t0, t0, t0);                   // t0 = t0 + t0
+    fp2mul_mont(t2, t4, t5);              // t5 = t2*t4
+    fp2add(t5, t0, t5);                   // t5 = t5 + t0
+    fp2sqr_mont(P->X, t0);                // t0 = X1 ^ 2
+    fp2sqr_mont(P->Z, t6);                // t6 = Z1 ^ 2
+    fp2add(t0, t6, t0);                   // t0 = t0 + t6    
+    fp2add(t1, t1, t1);                   // t1 = t1 + t1
+    fp2mul_mont(QY, P->X, t7);            // t7 = y2*X1
+    fp2mul_mont(QX, P->Y, t6);            // t6 = x2*Y1
+    fp2sub(t7, t6, t7);                   // t7 = t7 - t6
+    fp2mul_mont(t1, t7, t1);              // t1 = t1*t7
+    fp2mul_mont(A, t2, t7);               // t7 = A*t2
+    fp2add(t7, t4, t4);                   // t4 = t4 + t7
+    fp2mul_mont(t1, t4, t4);              // t4 = t1*t4
+    fp2mul_mont(QY, QZ, t1);              // t1 = y2*z2
+    fp2mul_mont(t0, t1, t0);              // t0 = t0*t1
+    fp2sqr_mont(QZ, t1);                  // t1 = z2 ^ 2
+    fp2sqr_mont(QX, t6);                  // t6 = x2 ^ 2
+    fp2add(t1, t6, t1);                   // t1 = t1 + t6
+    fp2mul_mont(P->Z, P->Y, t6);          // t6 = Z1*Y1
+    fp2mul_mont(t1, t6, t1);              // t1 = t1*t6
+    fp2sub(t0, t1, t0);                   // t0 = t0 - t1
+    fp2mul_mont(t2, t0, t0);              // t0 = t2*t0
+    fp2mul_mont(t5, t3, R->X);            // X3 = t5*t3    
+    fp2add(t4, t0, R->Y);                 // Y3 = t4 + t0
+    fp2sqr_mont(t3, t0);                  // t0 = t3 ^ 2
+    fp2mul_mont(t3, t0, R->Z);            // Z3 = t3*t0
+}
+
+
+void Mont_ladder(const f2elm_t x, const digit_t* m, point_proj_t P, point_proj_t Q, const f2elm_t A24, const unsigned int order_bits, const unsigned int order_fullbits)
+{ // The Montgomery ladder
+  // Inputs: the affine x-coordinate of a point P on E: B*y^2=x^3+A*x^2+x, 
+  //         scalar m
+  //         curve constant A24 = (A+2)/4
+  //         order_bits = subgroup order bitlength
+  //         order_fullbits = smallest multiple of 32 larger than the order bitlength
+  // Output: P = m*(x:1)
+    unsigned int bit = 0, owords = NBITS_TO_NWORDS(order_fullbits);
+    digit_t mask, scalar[NWORDS_ORDER];
+    int i;
+    
+    // Initializing with the points (1:0) and (x:1)
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)P->X[0]);
+    fpzero(P->X[1]);
+    fp2zero(P->Z);
+    
+    fp2copy(x, Q->X);    
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)Q->Z[0]);    
+    fpzero(Q->Z[1]);
+
+    for (i = NWORDS_ORDER-1; i >= 0; i--) {
+        scalar[i] = m[i];
+    }
+    
+    for (i = order_fullbits-order_bits; i > 0; i--) {
+        mp_shiftl1(scalar, owords);
+    }    
+    
+    for (i = order_bits; i > 0; i--) {
+        bit = (unsigned int)(scalar[owords-1] >> (RADIX-1));
+        mp_shiftl1(scalar, owords);
+        mask = 0-(digit_t)bit;
+
+        swap_points(P, Q, mask);        
+        xDBLADD(P, Q, x, A24);                     // If bit=0 then P <- 2*P and Q <- P+Q, 
+        swap_points(P, Q, mask);                   // else if bit=1 then Q <- 2*Q and P <- P+Q
+    }
+}
+
+
+void mont_scalarmult_full(const digit_t* a, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits)
+{ // Computes P = [a]S in full projective coordinates, with the ladder and the Okeya-Sakurai y-coordinate recovery
+    point_proj_t P0 = {0}, P1 = {0};
+
+    Mont_ladder(S->x, a, P0, P1, A24, order_bits, MAXBITS_ORDER);    
+    recover_os(P0->X, P0->Z, P1->X, P1->Z, S->x, S->y, A, P->X, P->Y, P->Z);     
+}
+
+
+void mont_twodim_scalarmult(digit_t* a, const point_t R, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits)
+{ // Computes P = R + [a]S  
+    point_full_proj_t P2 = {0};
+    f2elm_t one = {0};    
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    mont_scalarmult_full(a, S, A, A24, P2, order_bits);
+    ADD(P2, R->x, R->y, one, A, P);       
+}
+
+
+void xDBLADD_proj(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24)
+{ // Simultaneous doubling and differential addition.
+  // Input: projective Montgomery points P=(XP:ZP) and Q=(XQ:ZQ) such that xP=XP/ZP and xQ=XQ/ZQ, affine difference xPQ=x(P-Q) and Montgomery curve constant A24=(A+2)/4.
+  // Output: projective Montgomery points P <- 2*P = (X2P:Z2P) such that x(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = x(Q+P)=XQP/ZQP. 
+    f2elm_t t0, t1, t2;
+
+    fp2add(P->X, P->Z, t0);                         // t0 = XP+ZP
+    fp2sub(P->X, P->Z, t1);                         // t1 = XP-ZP    
+    fp2sqr_mont(t0, P->X);                          // XP = (XP+ZP)^2    
+    fp2sub(Q->X, Q->Z, t2);                         // t2 = XQ-ZQ
+    fp2correction(t2);    
+    fp2add(Q->X, Q->Z, Q->X);                       // XQ = XQ+ZQ    
+    fp2mul_mont(t0, t2, t0);                        // t0 = (XP+ZP)*(XQ-ZQ)    
+    fp2sqr_mont(t1, P->Z);                          // ZP = (XP-ZP)^2    
+    fp2mul_mont(t1, Q->X, t1);                      // t1 = (XP-ZP)*(XQ+ZQ)    
+    fp2sub(P->X, P->Z, t2);                         // t2 = (XP+ZP)^2-(XP-ZP)^2    
+    fp2mul_mont(P->X, P->Z, P->X);                  // XP = (XP+ZP)^2*(XP-ZP)^2    
+    fp2mul_mont(t2, A24, Q->X);                     // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]    
+    fp2sub(t0, t1, Q->Z);                           // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)    
+    fp2add(Q->X, P->Z, P->Z);                       // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2    
+    fp2add(t0, t1, Q->X);                           // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)    
+    fp2mul_mont(P->Z, t2, P->Z);                    // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]    
+    fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2    
+    fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2    
+    fp2mul_mont(Q->X, ZPQ, Q->X);                   // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2    
+    fp2mul_mont(Q->Z, XPQ, Q->Z);                   // ZQ = XPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2          
+}
+
+
+void xDBL_e(const point_proj_t P, point_proj_t Q, const f2elm_t A24, const int e)
+{ // Doubling of a Montgomery point in projective coordinates (X:Z) over affine curve coefficient A. 
+  // Input: projective Montgomery x-coordinates P = (X1:Z1), where x1=X1/Z1 and Montgomery curve constants (A+2)/4.
+  // Output: projective Montgomery x-coordinates Q = 2*P = (X2:Z2). 
+    f2elm_t temp, a, b, c, aa, bb;    
+    
+    fp2copy(P->X,Q->X);
+    fp2copy(P->Z,Q->Z);
+    
+    for (int j = 0; j < e; j++) {
+        fp2add(Q->X, Q->Z, a);           // a = xQ + zQ
+        fp2sub(Q->X, Q->Z, b);           // b = xQ - zQ
+        fp2sqr_mont(a, aa);              //aa = (xQ + zQ)^2
+        fp2sqr_mont(b, bb);              //bb = (xQ - zQ)^2
+        fp2sub(aa, bb, c);               // c = (xQ + zQ)^2 - (xQ - zQ)^2
+        fp2mul_mont(aa, bb, Q->X);       // xQ = (xQ + zQ)^2 * (xQ - zQ)^2
+        fp2mul_mont(A24, c, temp);       // temp = A24 * ((xQ + zQ)^2 - (xQ - zQ)^2)
+        fp2add(temp, bb, temp);          // temp = A24 * ((xQ + zQ)^2 - (xQ - zQ)^2) + (xQ - zQ)^2
+        fp2mul_mont(c, temp, Q->Z);      // temp =  (A24 * ((xQ + zQ)^2 - (xQ - zQ)^2) + (xQ - zQ)^2) * ((xQ + zQ)^2 - (xQ - zQ)^2)
+    }
+}
+
+
+void Ladder(const point_proj_t P, const digit_t* m, const f2elm_t A, const unsigned int order_bits, point_proj_t R) 
+{
+    point_proj_t R0, R1;
+    f2elm_t A24 = {0};
+    unsigned int bit = 0;
+    digit_t mask;
+    int j, swap, prevbit = 0;    
+        
+    fpcopy((digit_t*)&Montgomery_one, A24[0]);
+    fpadd(A24[0], A24[0], A24[0]);
+    fp2add(A, A24, A24);
+    fp2div2(A24, A24);  
+    fp2div2(A24, A24);  // A24 = (A+2)/4          
+
+    j = order_bits - 1;
+    bit = (m[j >> LOG2RADIX] >> (j & (RADIX-1))) & 1;
+    while (bit == 0) {
+        j--;
+        bit = (m[j >> LOG2RADIX] >> (j & (RADIX-1))) & 1;
+    }
+
+    // R0 <- P, R1 <- 2P
+    fp2copy(P->X, R0->X);
+    fp2copy(P->Z, R0->Z);
+    xDBL_e(P, R1, A24, 1);    
+    
+    // Main loop
+    for (int i = j - 1;  i >= 0; i--) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R0, R1, mask);
+        xDBLADD_proj(R0, R1, P->X, P->Z, A24);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R0, R1, mask);    
+    
+    fp2copy(R0->X, R->X);
+    fp2copy(R0->Z, R->Z);
+}
+
+#endif
\ No newline at end of file
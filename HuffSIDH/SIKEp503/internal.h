@@ -0,0 +1,221 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: internal header file for function definitions
+*********************************************************************************************/  
+
+#ifndef INTERNAL_H
+#define INTERNAL_H
+
+
+/**************** Function prototypes ****************/
+/************* Multiprecision functions **************/ 
+
+// Copy wordsize digits, c = a, where lng(a) = nwords
+void copy_words(const digit_t* a, digit_t* c, const unsigned int nwords);
+
+// Compare two byte arrays in constant time
+int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len) ;
+
+// Conditional move in constant time
+void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector);
+
+// Multiprecision addition, c = a+b, where lng(a) = lng(b) = nwords. Returns the carry bit 
+unsigned int mp_add(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
+
+// Multiprecision subtraction, c = a-b, where lng(a) = lng(b) = nwords. Returns the borrow bit 
+unsigned int mp_sub(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
+
+// 2x434-bit multiprecision subtraction followed by addition with p434*2^448, c = a-b+(p434*2^448) if a-b < 0, otherwise c=a-b 
+void mp_subaddx2_asm(const digit_t* a, const digit_t* b, digit_t* c);
+
+// Multiprecision left shift
+void mp_shiftleft(digit_t* x, unsigned int shift, const unsigned int nwords);
+
+// Multiprecision right shift by one
+void mp_shiftr1(digit_t* x, const unsigned int nwords);
+
+// Multiprecision left right shift by one    
+void mp_shiftl1(digit_t* x, const unsigned int nwords);
+
+// Digit multiplication, digit * digit -> 2-digit result
+void digit_x_digit(const digit_t a, const digit_t b, digit_t* c); 
+
+// Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
+
+/************ Montgomery reduction and conversion functions *************/
+
+// Montgomery reduction, c = a mod p
+void rdc_mont(digit_t* a, digit_t* c);
+
+// Conversion to Montgomery representation
+void to_mont(const digit_t* a, digit_t* mc);
+    
+// Conversion from Montgomery representation to standard representation
+void from_mont(const digit_t* ma, digit_t* c);
+    
+// Conversion of a GF(p^2) element to Montgomery representation
+void to_fp2mont(const f2elm_t a, f2elm_t mc);
+
+// Conversion of a GF(p^2) element from Montgomery representation to standard representation
+void from_fp2mont(const f2elm_t ma, f2elm_t c);
+
+// n-way Montgomery inversion
+void mont_n_way_inv(const f2elm_t* vec, const int n, f2elm_t* out);
+
+/************ Elliptic curve and isogeny functions *************/
+
+// Computes the j-invariant of a Montgomery curve with projective constant.
+void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv);
+void j_inv_Huff(const f2elm_t CpD, const f2elm_t CmD, const f2elm_t CD4, f2elm_t jinv);
+
+// Simultaneous doubling and differential addition.
+void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t xPQ, const f2elm_t A24);
+void xDBLADD_Huff(point_proj_t P, point_proj_t Q, const f2elm_t xPQ, const f2elm_t A24);
+
+// Doubling of a Montgomery point in projective coordinates (X:Z).
+void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24);
+void xDBL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4);
+
+// Computes [2^e](X:Z) on Montgomery curve with projective constant via e repeated doublings.
+void xDBLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24, const int e);
+void xDBLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4, const int e);
+
+// Computes [2^e](X:Z) on Huff curve in place via e repeated doublings.
+void xDBLe_inplace_Huff(point_proj_t P, const f2elm_t CmDsq, const f2elm_t CD4, const int e);
+
+// Differential addition.
+void xADD(point_proj_t P, const point_proj_t Q, const f2elm_t xPQ);
+
+// Computes the corresponding 4-isogeny of a projective Montgomery point (X4:Z4) of order 4.
+void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t* coeff);
+void get_4_isog_Huff(const point_proj_t P, f2elm_t CmDsq, f2elm_t CD4, f2elm_t* coeff);
+
+// Evaluates the isogeny at the point (X:Z) in the domain of the isogeny.
+void eval_4_isog(point_proj_t P, const f2elm_t* coeff);
+void eval_4_isog_Huff(point_proj_t P, const f2elm_t* coeff);
+
+// Tripling of a Montgomery point in projective coordinates (X:Z).
+void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus);
+void xTPL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus);
+
+// Computes [3^e](X:Z) on Montgomery curve with projective constant via e repeated triplings.
+void xTPLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e);
+void xTPLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e);
+
+// Computes [3^e](X:Z) on Huff curve in place via e repeated triplings.
+void xTPLe_inplace_Huff(point_proj_t P, const f2elm_t A24minus, const f2elm_t A24plus, const int e);
+
+// Computes the corresponding 3-isogeny of a projective Montgomery point (X3:Z3) of order 3.
+void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff);
+void get_3_isog_Huff(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff);
+
+
+// Computes the 3-isogeny R=phi(X:Z), given projective point (X3:Z3) of order 3 on a Montgomery curve and a point P with coefficients given in coeff.
+void eval_3_isog(point_proj_t Q, const f2elm_t* coeff);
+void eval_3_isog_Huff(point_proj_t Q, const f2elm_t* coeff);
+
+// Kernels of an isogeny tree traversal with steps of degree l (see traverse.c): multiplication by l^e, computation of
+// the isogeny with kernel <R> (coefficients and codomain curve constants) and evaluation of the isogeny at a point
+typedef void (*mul_isog_t)(const point_proj_t P, point_proj_t Q, const f2elm_t* curve, const int e);
+typedef void (*get_isog_t)(const point_proj_t R, f2elm_t* curve, f2elm_t* coeff);
+typedef void (*eval_isog_t)(point_proj_t Q, const f2elm_t* coeff);
+
+// Rows and columns of the kernel cost table hybrid_costs, which selects the model of each kernel in the hybrid traversals (HYBRID_MODELS)
+#define HYBRID_ALICE_MUL   0
+#define HYBRID_ALICE_EVAL  1
+#define HYBRID_BOB_MUL     2
+#define HYBRID_BOB_EVAL    3
+#define HYBRID_NKERNELS    4
+#define MODEL_HUFF         0
+#define MODEL_MONT         1
+
+// Maps between Montgomery x-coordinates and Huff w-coordinates (w = 1/x), and Montgomery constants of a Huff curve
+void map_mont_huff(const point_proj_t P, point_proj_t Q);
+void huff_to_mont_curve(const f2elm_t CmDsq, const f2elm_t CD4, f2elm_t A24plus, f2elm_t C24);
+
+// Maps between Montgomery x-coordinates and twisted Edwards y-coordinates, y = (x-1)/(x+1)
+void map_mont_edwards(const point_proj_t P, point_proj_t Q);
+void map_edwards_mont(const point_proj_t P, point_proj_t Q);
+
+// Twisted Edwards kernels in projective y-coordinates (Y:Z), with the curve constants a, d and a-d of the corresponding Montgomery kernels
+void xDBL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd);
+void xDBLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd, const int e);
+void get_4_isog_Edwards(const point_proj_t P, f2elm_t a, f2elm_t amd, f2elm_t* coeff);
+void eval_4_isog_Edwards(point_proj_t P, const f2elm_t* coeff);
+void xTPL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a);
+void xTPLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a, const int e);
+void get_3_isog_Edwards(const point_proj_t P, f2elm_t d, f2elm_t a, f2elm_t* coeff);
+void eval_3_isog_Edwards(point_proj_t Q, const f2elm_t* coeff);
+
+// 3-way simultaneous inversion
+void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
+
+// Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
+void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
+void get_A_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
+void get_A_Huff_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A, f2elm_t C);
+
+#ifdef COMPRESS
+/************ Public key compression functions *************/
+
+// Torsion subgroup E[ell^e] carried by the public keys of one party, with the constants of the Montgomery arithmetic modulo ell^e
+typedef struct {
+    unsigned int ell;
+    unsigned int e;
+    unsigned int nbits;                 // Bitlength of ell^e
+    unsigned int nbytes;                // Bytes of an encoded element of Z_(ell^e)
+    const digit_t* order;               // ell^e
+    const digit_t* rprime;              // -order^(-1) mod 2^NBITS_ORDER, NULL for ell = 2
+    const digit_t* Rprime;              // (2^NBITS_ORDER)^2 mod order, NULL for ell = 2
+    unsigned int w;                     // Window of the discrete logarithms, in base-ell digits (see dlog.c)
+    unsigned int ndigits;               // Number of windows, ceil(e/w)
+    unsigned int ellw;                  // ell^w
+    unsigned int ellr;                  // ell^r, for the lowest window of r = e - w*(ndigits-1) digits
+    const uint64_t* table;              // g^(j*ell^(r+w*i)), i = 0, ..., ndigits-2 and j = 1, ..., ellw/2, for the generator g of the subgroup of order ell^e of GF(p^2)*
+    const uint64_t* table0;             // g^j, j = 1, ..., ellr/2
+    const unsigned int* path;           // Optimal traversal of the Pohlig-Hellman tree
+} torsion_t;
+
+// Torsion subgroups carried by Bob's public keys (torsion_A) and by Alice's public keys (torsion_B)
+extern const torsion_t torsion_A, torsion_B;
+
+// Square tests in GF(p^2), and comparison of GF(p^2) elements
+unsigned char is_sqr_fp2(const f2elm_t a, felm_t s);
+unsigned char is_sqr_fp2_vartime(const f2elm_t a);
+int8_t cmp_f2elm(const f2elm_t x, const f2elm_t y);
+
+// Cyclotomic squaring, cubing and fifth power, and a = a^(ell^e), on elements of norm 1 in GF(p^2)
+void fp2_conj(const f2elm_t v, f2elm_t r);
+void sqr_Fp2_cycl(f2elm_t a, const felm_t one);
+void cube_Fp2_cycl(f2elm_t a, const felm_t one);
+void pow5_Fp2_cycl(f2elm_t a, const felm_t one);
+void exp_ell_Fp2_cycl(f2elm_t a, const unsigned int ell, const unsigned int e, const felm_t one);
+
+// Arithmetic modulo the subgroup orders: Montgomery arithmetic modulo Bob's odd order, and inversion modulo Alice's order 2^250
+void Montgomery_multiply_mod_order(const digit_t* ma, const digit_t* mb, digit_t* mc, const digit_t* order, const digit_t* Montgomery_rprime);
+void Montgomery_inversion_mod_order_bingcd(const digit_t* a, digit_t* c, const digit_t* order, const digit_t* Montgomery_rprime, const digit_t* Montgomery_Rprime);
+void from_Montgomery_mod_order(const digit_t* ma, digit_t* c, const digit_t* order, const digit_t* Montgomery_rprime);
+void multiply(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
+void inv_mod_orderA(const digit_t* a, digit_t* c);
+
+// Points in affine and full projective (X:Y:Z) Montgomery coordinates: y-coordinate of an (X:Z) point, addition, and scalar
+// multiplications P = [a]S and P = R + [a]S of affine points
+void CompleteMPoint(const f2elm_t A, point_proj_t P, point_full_proj_t R);
+void ADD(const point_full_proj_t P, const f2elm_t QX, const f2elm_t QY, const f2elm_t QZ, const f2elm_t A, point_full_proj_t R);
+void mont_scalarmult_full(const digit_t* a, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits);
+void mont_twodim_scalarmult(digit_t* a, const point_t R, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits);
+
+// Reduced Tate pairings of order ell^e of points of E_A[ell^e], sharing the Miller loops of their first arguments (see pairing.c)
+#define MAX_PAIRINGS    4
+int tate_pairings(const point_t* P, const unsigned int nP, const point_t* Q, const unsigned int nQ, const f2elm_t A, const torsion_t* T, f2elm_t* t);
+
+// Discrete logarithm in the cyclotomic subgroup of order ell^e, in base its fixed generator (see dlog.c)
+int dlog_pohlig_hellman(const f2elm_t h, const torsion_t* T, digit_t* x);
+
+// Deterministic basis of E_A[ell^e] (see torsion_basis.c)
+int torsion_basis(const f2elm_t A, const torsion_t* T, point_t R1, point_t R2);
+#endif
+
+#endif
@@ -0,0 +1,241 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: worker threads for the parallel isogeny tree traversal and the parallel encapsulation
+*********************************************************************************************/
+
+#ifdef PARALLEL_TRAVERSAL
+#include <pthread.h>
+
+#define PARALLEL_WORKERS      (PARALLEL_THREADS - 1)
+#define PARALLEL_MAX_JOBS     (MAX_INT_POINTS_ALICE + MAX_INT_POINTS_BOB + 3)
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t wake, done;
+    pthread_t thread[PARALLEL_WORKERS];
+    unsigned int id[PARALLEL_WORKERS];
+    unsigned int nworkers;                          // Number of running worker threads
+    unsigned int busy;                              // The pool is owned by a traversal
+    point_proj* job[PARALLEL_MAX_JOBS];             // Points to be evaluated by the workers
+    unsigned int njobs;
+    f2elm_t coeff[4];                               // Private copy of the isogeny coefficients
+    eval_isog_t eval;
+    unsigned long generation;                       // Number of batches handed to the workers
+    unsigned int pending;                           // Number of workers still evaluating the current batch
+} eval_pool_t;
+
+static eval_pool_t eval_pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+static pthread_once_t eval_pool_once = PTHREAD_ONCE_INIT;
+
+
+static void* eval_pool_worker(void* arg)
+{ // Worker thread: sleeps until a new batch of points is handed out and evaluates every nworkers-th point of it
+    const unsigned int id = *(const unsigned int*)arg;
+    eval_pool_t* pool = &eval_pool;
+    unsigned long seen = 0;
+    unsigned int i;
+
+    pthread_mutex_lock(&pool->lock);
+    while (1) {
+        while (pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        for (i = id; i < pool->njobs; i += pool->nworkers) {
+            pool->eval(pool->job[i], (const f2elm_t*)pool->coeff);
+        }
+        pthread_mutex_lock(&pool->lock);
+        pool->pending -= 1;
+        if (pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    return NULL;
+}
+
+
+static void eval_pool_start(void)
+{ // Starts PARALLEL_THREADS-1 worker threads on first use. They are kept for the lifetime of the process and reused by every traversal.
+  // If a thread cannot be created, the pool runs with fewer workers (possibly none)
+    unsigned int i;
+
+    pthread_mutex_lock(&eval_pool.lock);
+    for (i = 0; i < PARALLEL_WORKERS; i++) {
+        eval_pool.id[i] = i;
+        if (pthread_create(&eval_pool.thread[i], NULL, eval_pool_worker, &eval_pool.id[i]) != 0) {
+            break;
+        }
+        pthread_detach(eval_pool.thread[i]);
+        eval_pool.nworkers += 1;
+    }
+    pthread_mutex_unlock(&eval_pool.lock);
+}
+
+
+static eval_pool_t* eval_pool_acquire(void)
+{ // Reserves the worker threads for the calling traversal. Returns NULL if they are busy with a concurrent traversal or could not be
+  // started, in which case the traversal evaluates every point on the calling thread
+    eval_pool_t* pool = &eval_pool;
+
+    pthread_once(&eval_pool_once, eval_pool_start);
+    pthread_mutex_lock(&pool->lock);
+    if (pool->nworkers == 0 || pool->busy != 0) {
+        pthread_mutex_unlock(&pool->lock);
+        return NULL;
+    }
+    pool->busy = 1;
+    pthread_mutex_unlock(&pool->lock);
+    return pool;
+}
+
+
+static void eval_pool_wait(eval_pool_t* pool)
+{ // Waits until the workers have finished the current batch. Must be called with pool->lock held
+    while (pool->pending != 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+}
+
+
+static void eval_pool_release(eval_pool_t* pool)
+{ // Waits for the last batch and returns the worker threads to the pool
+    if (pool == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    eval_pool_wait(pool);
+    pool->busy = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+
+static void eval_pool_run(eval_pool_t* pool, point_proj_t* pts, const unsigned int npts, point_proj** extra, const unsigned int nextra, const f2elm_t* coeff, const unsigned int ncoeff, eval_isog_t eval)
+{ // Evaluates the points pts[0],...,pts[npts-1] and extra[0],...,extra[nextra-1] at the isogeny defined by the ncoeff coefficients in coeff.
+  // The last stored point pts[npts-1], on which the traversal continues, is evaluated by the calling thread before returning.
+  // The other points are handed to the workers of pool (or evaluated on the calling thread if pool is NULL): they can only be accessed
+  // again after the next call to eval_pool_run() or eval_pool_release().
+    unsigned int i, n = 0;
+
+    if (pool == NULL) {
+        for (i = 0; i < npts; i++) {
+            eval(pts[i], coeff);
+        }
+        for (i = 0; i < nextra; i++) {
+            eval(extra[i], coeff);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    eval_pool_wait(pool);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i + 1 < npts; i++) {
+        pool->job[n++] = pts[i];
+    }
+    for (i = 0; i < nextra; i++) {
+        pool->job[n++] = extra[i];
+    }
+
+    if (n > 0) {
+        for (i = 0; i < ncoeff; i++) {
+            fp2copy(coeff[i], pool->coeff[i]);
+        }
+        pool->njobs = n;
+        pool->eval = eval;
+        pthread_mutex_lock(&pool->lock);
+        pool->pending = pool->nworkers;
+        pool->generation += 1;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    if (npts > 0) {
+        eval(pts[npts-1], coeff);
+    }
+}
+#endif
+
+
+#ifdef PARALLEL_ENCAPSULATION
+#include <pthread.h>
+
+typedef void (*task_t)(void* arg);
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t wake, done;
+    pthread_t thread;
+    unsigned int running;                           // The worker thread was created
+    task_t task;                                    // Task being run by the worker, NULL if the worker is idle
+    void* arg;
+    unsigned long submitted, finished;              // Number of tasks handed to and completed by the worker
+} task_pool_t;
+
+static task_pool_t task_pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+static pthread_once_t task_pool_once = PTHREAD_ONCE_INIT;
+
+
+static void* task_pool_worker(void* arg)
+{ // Worker thread: sleeps until a task is submitted, runs it and signals its completion
+    task_pool_t* pool = (task_pool_t*)arg;
+    task_t task;
+
+    pthread_mutex_lock(&pool->lock);
+    while (1) {
+        while (pool->task == NULL) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        task = pool->task;
+        pthread_mutex_unlock(&pool->lock);
+        task(pool->arg);
+        pthread_mutex_lock(&pool->lock);
+        pool->task = NULL;
+        pool->finished += 1;
+        pthread_cond_broadcast(&pool->done);
+    }
+    return NULL;
+}
+
+
+static void task_pool_start(void)
+{ // Starts the worker thread on first use. It is kept for the lifetime of the process and reused by every encapsulation
+    if (pthread_create(&task_pool.thread, NULL, task_pool_worker, &task_pool) == 0) {
+        pthread_detach(task_pool.thread);
+        task_pool.running = 1;
+    }
+}
+
+
+static int task_pool_submit(task_t task, void* arg, unsigned long* ticket)
+{ // Hands task(arg) to the worker thread. Returns 1 if the worker is busy with another caller's task or could not be started,
+  // in which case the caller runs the task itself. Otherwise returns 0 and a ticket for task_pool_join()
+    pthread_once(&task_pool_once, task_pool_start);
+    if (task_pool.running == 0) {
+        return 1;
+    }
+
+    pthread_mutex_lock(&task_pool.lock);
+    if (task_pool.task != NULL) {
+        pthread_mutex_unlock(&task_pool.lock);
+        return 1;
+    }
+    task_pool.task = task;
+    task_pool.arg = arg;
+    *ticket = ++task_pool.submitted;
+    pthread_cond_signal(&task_pool.wake);
+    pthread_mutex_unlock(&task_pool.lock);
+    return 0;
+}
+
+
+static void task_pool_join(const unsigned long ticket)
+{ // Waits until the task with the given ticket has completed
+    pthread_mutex_lock(&task_pool.lock);
+    while (task_pool.finished < ticket) {
+        pthread_cond_wait(&task_pool.done, &task_pool.lock);
+    }
+    pthread_mutex_unlock(&task_pool.lock);
+}
+#endif
@@ -0,0 +1,14 @@
+/********************************************************************************************
+* Abstract: run tests of the Huff KEM against its known answer test vectors
+*           (KAT/PQCkemKAT_Huff_*.rsp, written by PQCgenKAT_kem503_Huff.c)
+*********************************************************************************************/
+
+#include "../P503/api.h"
+
+#define KAT_NAME               "PQCkemKAT_Huff"
+#define KAT_ALGNAME            CRYPTO_ALGNAME_HUFF
+#define crypto_kem_keypair     crypto_kem_keypair_Huff
+#define crypto_kem_enc         crypto_kem_enc_Huff
+#define crypto_kem_dec         crypto_kem_dec_Huff
+
+#include "PQCtestKAT_kem503.c"
@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmarking/testing isogeny-based key encapsulation mechanism SIKEp503
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/api.h"
+#include "../sha3/fips202.h"
+
+
+#define SCHEME_NAME    "SIKEp503"
+
+
+#include "test_sike.c"
\ No newline at end of file
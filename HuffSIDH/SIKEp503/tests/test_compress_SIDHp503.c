@@ -0,0 +1,25 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing and benchmarking the primitives of the public key compression of SIDHp503
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503_internal.h"
+#include "../internal.h"
+
+
+#define SCHEME_NAME        "SIDHp503"
+#define fp2copy_test       fp2copy503
+#define fp2sqr_test        fp2sqr503_mont
+#define fp2mul_test        fp2mul503_mont
+#define fp2add_test        fp2add503
+#define fp2div2_test       fp2div2_503
+#define fp2inv_test        fp2inv503_mont_bingcd
+#define fp2random_test     fp2random503_test
+
+
+
+#include "test_compress.c"
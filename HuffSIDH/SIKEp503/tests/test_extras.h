@@ -0,0 +1,61 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: utility header file for tests
+*********************************************************************************************/  
+
+#ifndef TEST_EXTRAS_H
+#define TEST_EXTRAS_H
+    
+#include "../config.h"
+
+#define PASSED    0
+#define FAILED    1
+
+
+#if (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+    #define print_unit printf("nsec");
+#else
+    #define print_unit printf("cycles");
+#endif
+
+    
+// Access system counter for benchmarking
+int64_t cpucycles(void);
+
+// Counting L1 data cache misses for benchmarking (Linux perf events). The functions are no-ops and cachemisses_stop() returns -1
+// when the counter is not available
+int cachemisses_open(void);
+void cachemisses_start(int counter);
+int64_t cachemisses_stop(int counter);
+void cachemisses_close(int counter);
+
+// Comparing "nword" elements, a=b? : (1) a!=b, (0) a=b
+int compare_words(digit_t* a, digit_t* b, unsigned int nwords);
+
+// Generating a pseudo-random field element in [0, p434-1] 
+void fprandom434_test(digit_t* a);
+
+// Generating a pseudo-random element in GF(p434^2)
+void fp2random434_test(digit_t* a);
+
+// Generating a pseudo-random field element in [0, p503-1] 
+void fprandom503_test(digit_t* a);
+
+// Generating a pseudo-random element in GF(p503^2)
+void fp2random503_test(digit_t* a);
+
+// Generating a pseudo-random field element in [0, p546-1] 
+void fprandom610_test(digit_t* a);
+
+// Generating a pseudo-random element in GF(p546^2)
+void fp2random610_test(digit_t* a);
+
+// Generating a pseudo-random field element in [0, p751-1] 
+void fprandom751_test(digit_t* a);
+
+// Generating a pseudo-random element in GF(p751^2)
+void fp2random751_test(digit_t* a);
+
+
+#endif
\ No newline at end of file
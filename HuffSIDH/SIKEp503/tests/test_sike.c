@@ -0,0 +1,363 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmarking/testing isogeny-based key encapsulation mechanism
+*********************************************************************************************/ 
+
+
+// Benchmark and test parameters  
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) 
+    #define BENCH_LOOPS        5      // Number of iterations per bench 
+    #define TEST_LOOPS         5      // Number of iterations per test
+#else
+    #define BENCH_LOOPS       100
+    #define TEST_LOOPS        10      
+#endif
+
+
+int cryptotest_kem()
+{ // Testing KEM
+    unsigned int i;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ct_[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char temp[2*CRYPTO_CIPHERTEXTBYTES-CRYPTO_PUBLICKEYBYTES] = {0};    // s||ct
+    const unsigned int msg_bytes = CRYPTO_CIPHERTEXTBYTES - CRYPTO_PUBLICKEYBYTES;
+    bool passed = true;
+
+    printf("\n\nTESTING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        crypto_kem_enc(ct, ss, pk);
+        crypto_kem_dec(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Ciphertext with xP = 0, rejected by the public key validation: ss_ = H(s||ct) and no encapsulation to it
+        memset(ct, 0, CRYPTO_PUBLICKEYBYTES/3);
+        crypto_kem_dec(ss_, ct, sk);
+        memcpy(temp, sk, msg_bytes);
+        memcpy(&temp[msg_bytes], ct, CRYPTO_CIPHERTEXTBYTES);
+        shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+msg_bytes);
+
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0 || crypto_kem_enc(ct_, ss, ct) != 1) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  KEM tests .................................................... PASSED");
+    else { printf("  KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem()
+{ // Benchmarking key exchange
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        // Benchmarking key generation
+        cycles1 = cpucycles();
+        crypto_kem_keypair(pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+        
+        // Benchmarking encapsulation    
+        cycles1 = cpucycles();
+        crypto_kem_enc(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking decapsulation
+        cycles1 = cpucycles();
+        crypto_kem_dec(ss_, ct, sk);   
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  Key generation runs in ....................................... %10lld ", cycles_keygen/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Encapsulation runs in ........................................ %10lld ", cycles_encaps/BENCH_LOOPS); print_unit;
+    printf("\n");        
+    printf("  Decapsulation runs in ........................................ %10lld ", cycles_decaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int cryptotest_kem_Huff()
+{ // Testing KEM using Huff curves
+    unsigned int i;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char temp[2*CRYPTO_CIPHERTEXTBYTES-CRYPTO_PUBLICKEYBYTES] = {0};    // s||ct
+    const unsigned int msg_bytes = CRYPTO_CIPHERTEXTBYTES - CRYPTO_PUBLICKEYBYTES;
+    pk_handle_t handle;
+    bool passed = true;
+
+    printf("\n\nTESTING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s USING HUFF CURVES\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair_Huff(pk, sk);
+        crypto_kem_enc_Huff(ct, ss, pk);
+        crypto_kem_dec_Huff(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        pk_handle_init_B_Huff(&handle, pk);     // Encapsulation with a public key handle
+        crypto_kem_enc_Huff_pk(ct, ss, &handle);
+        crypto_kem_dec_Huff(ss_, ct, sk);
+
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Ciphertext with wP = 0, rejected by the public key validation: ss_ = H(s||ct) and no encapsulation to it
+        memset(ct, 0, CRYPTO_PUBLICKEYBYTES/3);
+        crypto_kem_dec_Huff(ss_, ct, sk);
+        memcpy(temp, sk, msg_bytes);
+        memcpy(&temp[msg_bytes], ct, CRYPTO_CIPHERTEXTBYTES);
+        shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+msg_bytes);
+
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0 || crypto_kem_enc_Huff(ct, ss, ct) != 1) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  KEM tests .................................................... PASSED");
+    else { printf("  KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_Huff()
+{ // Benchmarking KEM using Huff curves
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    pk_handle_t handle;
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_encaps_pk = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s USING HUFF CURVES\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        // Benchmarking key generation
+        cycles1 = cpucycles();
+        crypto_kem_keypair_Huff(pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+        
+        // Benchmarking encapsulation    
+        cycles1 = cpucycles();
+        crypto_kem_enc_Huff(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking encapsulation with a public key handle, made once per public key
+        pk_handle_init_B_Huff(&handle, pk);
+        cycles1 = cpucycles();
+        crypto_kem_enc_Huff_pk(ct, ss, &handle);
+        cycles2 = cpucycles();
+        cycles_encaps_pk = cycles_encaps_pk+(cycles2-cycles1);
+
+        // Benchmarking decapsulation
+        cycles1 = cpucycles();
+        crypto_kem_dec_Huff(ss_, ct, sk);   
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  Key generation runs in ....................................... %10lld ", cycles_keygen/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Encapsulation runs in ........................................ %10lld ", cycles_encaps/BENCH_LOOPS); print_unit;
+    printf("\n");        
+    printf("  Encapsulation with a public key handle runs in ............... %10lld ", cycles_encaps_pk/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Decapsulation runs in ........................................ %10lld ", cycles_decaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+#ifdef COMPRESS
+int cryptotest_kem_Huff_compressed()
+{ // Testing KEM using Huff curves with compressed public keys and ciphertexts
+    unsigned int i;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES_COMPRESSED] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES_COMPRESSED] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES_COMPRESSED] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char temp[2*CRYPTO_CIPHERTEXTBYTES_COMPRESSED-CRYPTO_PUBLICKEYBYTES_COMPRESSED] = {0};    // s||ct
+    const unsigned int msg_bytes = CRYPTO_CIPHERTEXTBYTES_COMPRESSED - CRYPTO_PUBLICKEYBYTES_COMPRESSED;
+    bool passed = true;
+
+    printf("\n\nTESTING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s USING HUFF CURVES AND COMPRESSION\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair_Huff_compressed(pk, sk);
+        if (crypto_kem_enc_Huff_compressed(ct, ss, pk) != 0) {
+            passed = false;
+            break;
+        }
+        crypto_kem_dec_Huff_compressed(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Ciphertext with an invalid flag byte, rejected by the decompression: ss_ = H(s||ct) and no encapsulation to it
+        ct[CRYPTO_PUBLICKEYBYTES_COMPRESSED-1] = 2;
+        crypto_kem_dec_Huff_compressed(ss_, ct, sk);
+        memcpy(temp, sk, msg_bytes);
+        memcpy(&temp[msg_bytes], ct, CRYPTO_CIPHERTEXTBYTES_COMPRESSED);
+        shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES_COMPRESSED+msg_bytes);
+
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0 || crypto_kem_enc_Huff_compressed(ct, ss, ct) != 1) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  KEM tests .................................................... PASSED");
+    else { printf("  KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_Huff_compressed()
+{ // Benchmarking KEM using Huff curves with compressed public keys and ciphertexts
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES_COMPRESSED] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES_COMPRESSED] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES_COMPRESSED] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s USING HUFF CURVES AND COMPRESSION\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        // Benchmarking key generation
+        cycles1 = cpucycles();
+        crypto_kem_keypair_Huff_compressed(pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+        
+        // Benchmarking encapsulation    
+        cycles1 = cpucycles();
+        crypto_kem_enc_Huff_compressed(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking decapsulation
+        cycles1 = cpucycles();
+        crypto_kem_dec_Huff_compressed(ss_, ct, sk);   
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  Key generation runs in ....................................... %10lld ", cycles_keygen/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Encapsulation runs in ........................................ %10lld ", cycles_encaps/BENCH_LOOPS); print_unit;
+    printf("\n");        
+    printf("  Decapsulation runs in ........................................ %10lld ", cycles_decaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+#endif
+
+
+int main()
+{
+    int Status = PASSED;
+    
+    Status = cryptotest_kem();             // Test key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptorun_kem();              // Benchmark key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptotest_kem_Huff();        // Test key encapsulation mechanism using Huff curves
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptorun_kem_Huff();         // Benchmark key encapsulation mechanism using Huff curves
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#ifdef COMPRESS
+
+    Status = cryptotest_kem_Huff_compressed();   // Test key encapsulation mechanism using Huff curves and compression
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptorun_kem_Huff_compressed();    // Benchmark key encapsulation mechanism using Huff curves and compression
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+
+    return Status;
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: strategy-driven isogeny tree traversal with pluggable evaluation schedulers
+*********************************************************************************************/
+
+#define TRAVERSE_MAX_POINTS   ((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+#define EVAL_BATCH            8     // Number of isogenies applied at once to the extra points by the batched scheduler
+
+// Layouts of the strategy tables
+#define STRAT_BY_HEIGHT       0     // Multiplication steps indexed by the height of the current node, consumed as strat[nsteps-index-row]
+#define STRAT_PREORDER        1     // Multiplication steps listed in traversal order, consumed as strat[ii++]
+#ifdef STRATEGY_PREORDER
+    #define STRAT_LAYOUT      STRAT_PREORDER
+#else
+    #define STRAT_LAYOUT      STRAT_BY_HEIGHT
+#endif
+
+typedef struct {
+    mul_isog_t mul;              // Q = [l^e]P, where l is the degree of the isogeny steps
+    get_isog_t get;              // Isogeny with kernel <R>: computes its coefficients and moves the curve constants to the codomain
+    eval_isog_t eval;            // Evaluates the isogeny at a point
+    unsigned int ncoeff;         // Number of coefficients computed by get
+} isog_kernels_t;
+
+typedef struct {
+#ifdef PARALLEL_TRAVERSAL
+    eval_pool_t* pool;           // Worker threads of the parallel scheduler, NULL if they are busy with another traversal
+#endif
+    f2elm_t log[EVAL_BATCH][4];  // Coefficients of the isogenies not yet applied to the extra points (batched scheduler)
+    unsigned int nlog;
+} sched_ctx_t;
+
+typedef struct {
+    void (*init)(sched_ctx_t* ctx);
+    // Evaluates the isogeny at the stored points pts[0],...,pts[npts-1] and at the extra points. pts[npts-1] must be up to date on return
+    void (*step)(sched_ctx_t* ctx, point_proj_t* pts, const unsigned int npts, point_proj** extra, const unsigned int nextra, const f2elm_t* coeff, const unsigned int ncoeff, eval_isog_t eval);
+    // Completes the pending evaluations of the extra points
+    void (*finish)(sched_ctx_t* ctx, point_proj** extra, const unsigned int nextra, eval_isog_t eval);
+} scheduler_t;
+
+
+static void sched_none(sched_ctx_t* ctx)
+{
+    (void)ctx;
+}
+
+
+static void sequential_step(sched_ctx_t* ctx, point_proj_t* pts, const unsigned int npts, point_proj** extra, const unsigned int nextra, const f2elm_t* coeff, const unsigned int ncoeff, eval_isog_t eval)
+{ // Evaluates every point as soon as the isogeny is known
+    unsigned int i;
+    (void)ctx; (void)ncoeff;
+
+    for (i = 0; i < npts; i++) {
+        eval(pts[i], coeff);
+    }
+    for (i = 0; i < nextra; i++) {
+        eval(extra[i], coeff);
+    }
+}
+
+
+static void sequential_finish(sched_ctx_t* ctx, point_proj** extra, const unsigned int nextra, eval_isog_t eval)
+{
+    (void)ctx; (void)extra; (void)nextra; (void)eval;
+}
+
+
+static void batched_flush(sched_ctx_t* ctx, point_proj** extra, const unsigned int nextra, eval_isog_t eval)
+{ // Applies the logged isogenies to the extra points, one point at a time
+    unsigned int i, j;
+
+    for (i = 0; i < nextra; i++) {
+        for (j = 0; j < ctx->nlog; j++) {
+            eval(extra[i], (const f2elm_t*)ctx->log[j]);
+        }
+    }
+    ctx->nlog = 0;
+}
+
+
+static void batched_init(sched_ctx_t* ctx)
+{
+    ctx->nlog = 0;
+}
+
+
+static void batched_step(sched_ctx_t* ctx, point_proj_t* pts, const unsigned int npts, point_proj** extra, const unsigned int nextra, const f2elm_t* coeff, const unsigned int ncoeff, eval_isog_t eval)
+{ // Evaluates the stored points immediately. The extra points do not take part in the traversal, so their evaluations
+  // are deferred and done EVAL_BATCH isogenies at a time, while each point stays in cache
+    unsigned int i;
+
+    for (i = 0; i < npts; i++) {
+        eval(pts[i], coeff);
+    }
+    if (nextra == 0) return;
+
+    for (i = 0; i < ncoeff; i++) {
+        fp2copy(coeff[i], ctx->log[ctx->nlog][i]);
+    }
+    ctx->nlog += 1;
+    if (ctx->nlog == EVAL_BATCH) {
+        batched_flush(ctx, extra, nextra, eval);
+    }
+}
+
+
+#ifdef PARALLEL_TRAVERSAL
+static void parallel_init(sched_ctx_t* ctx)
+{
+    ctx->pool = eval_pool_acquire();
+}
+
+
+static void parallel_step(sched_ctx_t* ctx, point_proj_t* pts, const unsigned int npts, point_proj** extra, const unsigned int nextra, const f2elm_t* coeff, const unsigned int ncoeff, eval_isog_t eval)
+{ // Evaluates pts[npts-1] on the calling thread and hands the other points to the worker threads
+    eval_pool_run(ctx->pool, pts, npts, extra, nextra, coeff, ncoeff, eval);
+}
+
+
+static void parallel_finish(sched_ctx_t* ctx, point_proj** extra, const unsigned int nextra, eval_isog_t eval)
+{
+    (void)extra; (void)nextra; (void)eval;
+    eval_pool_release(ctx->pool);
+}
+#endif
+
+
+static const scheduler_t scheduler_sequential = { sched_none, sequential_step, sequential_finish };
+static const scheduler_t scheduler_batched = { batched_init, batched_step, batched_flush };
+#ifdef PARALLEL_TRAVERSAL
+static const scheduler_t scheduler_parallel = { parallel_init, parallel_step, parallel_finish };
+#endif
+
+#if defined(PARALLEL_TRAVERSAL)
+    #define DEFAULT_SCHEDULER    (&scheduler_parallel)
+#elif defined(BATCHED_EVAL)
+    #define DEFAULT_SCHEDULER    (&scheduler_batched)
+#else
+    #define DEFAULT_SCHEDULER    (&scheduler_sequential)
+#endif
+
+
+static void traverse_tree(const isog_kernels_t* kernels, const scheduler_t* sched, const unsigned int* strat, const int layout, const unsigned int nsteps, const point_proj_t R, f2elm_t* curve, point_proj** extra, const unsigned int nextra)
+{ // Computes the isogeny of degree l^nsteps with kernel <R> as a chain of nsteps isogenies of degree l, following the strategy strat.
+  // Input:  kernel point R, curve constants of the domain in curve (layout defined by the kernel set) and nextra points in extra.
+  //         The strategy table strat has the layout STRAT_BY_HEIGHT or STRAT_PREORDER.
+  // Output: curve constants of the codomain in curve and images of the extra points.
+    point_proj_t pts[TRAVERSE_MAX_POINTS+1];        // Stored points, the current point is always pts[npts]
+    f2elm_t coeff[4];
+    unsigned int i, row, m, index = 0, pts_index[TRAVERSE_MAX_POINTS], npts = 0, ii = 0;
+    sched_ctx_t ctx;
+
+    copy_words((digit_t*)R, (digit_t*)pts[0], 2*2*NWORDS_FIELD);
+    sched->init(&ctx);
+
+    for (row = 1; row < nsteps; row++) {
+        while (index < nsteps-row) {
+            pts_index[npts] = index;
+            npts += 1;
+            m = (layout == STRAT_PREORDER) ? strat[ii++] : strat[nsteps-index-row];
+            kernels->mul(pts[npts-1], pts[npts], (const f2elm_t*)curve, (int)m);
+            index += m;
+        }
+        kernels->get(pts[npts], curve, coeff);
+        sched->step(&ctx, pts, npts, extra, nextra, (const f2elm_t*)coeff, kernels->ncoeff, kernels->eval);
+
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    sched->finish(&ctx, extra, nextra, kernels->eval);
+
+    kernels->get(pts[0], curve, coeff);
+    for (i = 0; i < nextra; i++) {
+        kernels->eval(extra[i], (const f2elm_t*)coeff);
+    }
+}
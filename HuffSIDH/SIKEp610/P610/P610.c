@@ -50,10 +50,95 @@ const uint64_t Mont_P2[NWORDS64_FIELD]           = { 0x847804f4d2c80c6c, 0x0b2a9
 
 
 
-// Order of Alice's subgroup
-const uint64_t Alice_order[NWORDS64_ORDER]       = { 0x74DCFF880845A503, 0x9EE786D7F6818A34, 0x8C77192637BFE85B, 0x19237ADBC4D30B80, 0x3B9F1FB1CC258 }; 
-// Order of Bob's subgroup
-const uint64_t Bob_order[NWORDS64_ORDER]         = { 0x03DF99092E953E01, 0x2374E42F0F1538FD, 0xC404DC08D3CFF5EC, 0xA6337F19BCCDB0DA, 0x24EE91F2603 };
+// Order of Alice's subgroup, 3^175
+const uint64_t Alice_order[NWORDS64_ORDER]       = { 0x4EB4B84EF3200FEB, 0x261F3029D32DF6CE, 0x882ED1524497EBD8, 0xD27E498FFAB6D794, 0x0000000000294F7E };
+// Order of Bob's subgroup, 5^119
+const uint64_t Bob_order[NWORDS64_ORDER]         = { 0x564FBA6B2582026D, 0xA8BD3E0141865511, 0xFFBB9BB35F466012, 0x388029BB4FC50CFC, 0x000000000013D3E2 };
+#ifdef COMPRESS
+// Montgomery constants for the arithmetic modulo the subgroup orders: rprime = -order^(-1) mod 2^320 and Rprime = (2^320)^2 mod order
+const uint64_t Montgomery_rprime_A[NWORDS64_ORDER] = { 0x3F06724A995C5F3D, 0xB7E8C8309446E795, 0xEB0AA37FB4848EFE, 0x8E8431C39F95E50F, 0x0BE17898D5F2986E };
+const uint64_t Montgomery_Rprime_A[NWORDS64_ORDER] = { 0x94CC2414377F8A79, 0x5CB822382453F30C, 0x59BDCAD7A98FD3CB, 0xBAEFAC89C8A85C92, 0x0000000000268BFA };
+const uint64_t Montgomery_rprime_B[NWORDS64_ORDER] = { 0x5C98DE3A44D5A89B, 0x70B901E29CB65134, 0x37ED0645D1F12EF6, 0x44DE81486686EF5B, 0x40FB1C3F8D9B5650 };
+const uint64_t Montgomery_Rprime_B[NWORDS64_ORDER] = { 0xB93C0AB493563326, 0x8698ECD147A178A2, 0xF567648DE0294933, 0x53BC854E26D015B0, 0x000000000003893D };
+// Elligator 2 candidates v = 1/(1 + u*r^2) for r = 1, ..., TABLE_R_LEN and the non-square u = 4 + i, in Montgomery representation
+const uint64_t basis_table[TABLE_R_LEN][2*NWORDS64_FIELD] = {
+                                                   { 0xC4EC4EC4EC50B14B, 0xAC9FE6CCA979D926, 0xB1B69476A11A0514, 0xD6771F1691BB3CA3, 0x3D0A0D2FF8E4076E,
+                                                     0x0BD1E18DE3E3BF5E, 0x2A24191D94A8847F, 0x0DE46CF9A8B971EF, 0x4D3CF68A7D9591C8, 0x00001382F866D9C0,
+                                                     0xD89D89D89D897624, 0x95A42726C6489CA9, 0xEF4FA45B2D747F8E, 0x6DD94EEF51C210FC, 0xBC30D7DFA7192892,
+                                                     0x2B1596C9B6D7A662, 0x5525FA05397EF98E, 0x2AB27A763CF456EA, 0x7F4DF578A0A125B9, 0x000001378D6C25E2 },   // r = 1
+                                                   { 0x98C2BA559CF5A55E, 0x33DACC7FF1149D5A, 0xED9C2DB44D6D26C8, 0x9375EDC46747E908, 0xDA8319BBFD68CDA9,
+                                                     0x525BCD6F24D507A8, 0x8FE0D5679659BB9B, 0xEE4BC942375F2F06, 0xBDB3D3C2F4B30234, 0x0000108818C3D8D2,
+                                                     0x093B97EBDB117EBC, 0xAAF93937733351E5, 0x19B174F2A593DAC7, 0x07738B2E601120DF, 0x9EEEFD291C2C640D,
+                                                     0x7DF7EC7B59C21BD1, 0xFB3D700EF25E38C1, 0xD1D82823D7CAE187, 0xE9501ACE923BFA95, 0x00000E2DABB655CF },   // r = 2
+                                                   { 0xE256DD0AF23ADED1, 0xD91DCFE111AEC70B, 0xD66575A7A2791AE4, 0x67ACB7D387FF746F, 0x1B9ACF02C9A8DAC1,
+                                                     0xB6710E1F5975E698, 0xAC23E858A7F93F75, 0xE2DBDD1C24ECEFA3, 0xAD9561C7895314AD, 0x00000364DA600881,
+                                                     0x30BA7049720D5B19, 0x93A0EDB1818FE4E6, 0xDE689D805633FA3B, 0x5B3E6FDEB30F79B9, 0x620A4EE09328B784,
+                                                     0xB02C8FABD9B9EA50, 0x5B807329EC26E226, 0x9E7CE71AAE576EB6, 0x517F00F1D99AF47B, 0x00000617AA88BF01 },   // r = 3
+                                                   { 0xB8FCBE5B85BDFD08, 0x06618C07BE09F09A, 0x9A8B48938794B1CB, 0xBD50075CBCC6FBD2, 0x4DF6E33CCA2AF89C,
+                                                     0x8E94CC2FFB9C8178, 0xA52392C19E1BEE99, 0xA8D34DD95661E564, 0x5A3D21EBEC89AA74, 0x0000130224B743D6,
+                                                     0x8F82C553CF5333EE, 0xB29908D2DB8FA6A0, 0x7DE8E32FF387D8F7, 0xC07540E4243305E5, 0x708F8C47AFB1FD09,
+                                                     0x2F86180F54FC3E75, 0x2D9848D3F355A205, 0x2919FF68857D539D, 0x802EC30193C33695, 0x00000268C86D7BA0 },   // r = 4
+                                                   { 0xD8BF10E2409A759F, 0xC9349F0E4C887A5D, 0xE2A093C04D7AF820, 0xF6205C69F6107156, 0x7BEDABBA70FDAE3E,
+                                                     0xB6D11DA3D484696C, 0x94BB5135F0976942, 0x7F86223064DDA83A, 0xC71C1189F59DBCF7, 0x0000076D43AACFAA,
+                                                     0xC7D0B4D9BD50E56B, 0xA42029AAB60958AB, 0xDF7C5572EA9CD3A9, 0xBDBD4651076F17FC, 0xB1FE55EF6E574F14,
+                                                     0x883178BA8FB361A4, 0xC36CE8C5F0A824EF, 0x6AE13BDCA7DA5111, 0x13315969C450D1C3, 0x00000EE35FA55F8B },   // r = 5
+                                                   { 0x1D0441481B11302E, 0x7B69B26820CA86EE, 0xA4C3125316EEE248, 0x5EF3584B61F803CB, 0x8B53CDAC599AFA7C,
+                                                     0xB185AA0053BBADD1, 0xC2BED80158DABE58, 0x632652F8F6C78FE0, 0x1B614EE43C43522D, 0x00001958A98FF527,
+                                                     0x2DC2EA7EDECC1049, 0x65E08A1B69162652, 0xC982FF365DB61204, 0x97964D3E3340B2A8, 0x6C58181F8FDCFB61,
+                                                     0x3F20C211F53E770B, 0xD13D2D7497167CB8, 0x50DD5EE7ECFB3243, 0x190E4072DE844655, 0x0000020102CAE27B },   // r = 6
+                                                   { 0xF228D368DF5648B2, 0x2372A716AF794B71, 0x7E7F7B9D273FFEA0, 0xB7E21BE58534280A, 0x9EF626AB1001429C,
+                                                     0xA2B2B2C6E48D2760, 0x08273E6D9A7FCEAF, 0x59431FAF7CE9077E, 0x8E6A22E469C2B19F, 0x000000C90FC5C9E8,
+                                                     0x4084CA1DCB0C5347, 0xD13472564EA4D5FB, 0x9B2A8FB63C208554, 0xA47247FC6BCECFE6, 0x27262D1219813132,
+                                                     0x1174D614C408932D, 0x68A0BD4550D4FE76, 0x57C0FF062D3C9D94, 0x15E5ACFF6BA86D1E, 0x0000098CAF52C50F },   // r = 7
+                                                   { 0xFBE6C9E6F89DF61E, 0xC7382DBC48CB8052, 0xEF1EAEB3A61A6D16, 0xA32805EAF604D776, 0xB09BD21663EFA928,
+                                                     0xEBEB5A13F0DFB903, 0x0911FDBB145874A5, 0xEB26DFB7238FC96C, 0x0DA65E08912B566D, 0x00000671C589AAC6,
+                                                     0x7B8AC2C37E5A2850, 0x92478CFEA8CF3C45, 0xE4013905C981FB48, 0xB7B05DFBDE993C31, 0x21972133DE77F52E,
+                                                     0xB2EDD34F6A826F2E, 0x76FEE0CAE1CEB6EC, 0x4790DE716E756F0E, 0xBBAF3D9B4E89BF58, 0x0000032D04C18026 },   // r = 8
+                                                   { 0x5AD91584BFA9DD0E, 0x6A284A1C9F0FDA46, 0xE9824ABD1A0503C2, 0x44C83AE2A7B193EF, 0x4E7E15F8CAEC67A0,
+                                                     0x979CE51219B2C9D1, 0x9DCB2A27650820E8, 0x214629A5E65C04BE, 0x49B00AE31FDC8344, 0x000005E5E6915AE8,
+                                                     0xEAEEEAE210D28396, 0xF720283EA3B21557, 0x6AD803F7B5C486C1, 0xE57D2115F9424BCF, 0x43CA8A09DC4AA7D6,
+                                                     0x381AAF768FD0CDDB, 0x5999F9DC9C5BFFF8, 0xEE887436D3414E18, 0x2026F2634B07C732, 0x00001587107C8996 },   // r = 9
+                                                   { 0xDB81B8AD58F97CB4, 0x2A785A49CBCB3D7B, 0xE3ED27FCB53B668F, 0xB1E7B3684247F745, 0x55D3A47246C20B35,
+                                                     0xC86367CD62232619, 0xD3EB9D12AE75461C, 0xD5CAB790AEA31C83, 0xBA78BD083013DB87, 0x000006A78EE5981A,
+                                                     0xE88ABE27C381F180, 0xF861967A8245EC92, 0x9D74FE46DE2E88EB, 0xAF5ED65803E1F3AE, 0xC061AD66CD5CEA53,
+                                                     0x55C1EC472BED9419, 0x9BBC8B02A5BF68F6, 0x8396A4696D86C845, 0x297D5A5802249EED, 0x000001678A1CB874 },   // r = 10
+                                                   { 0x713A1E5AF7B948D7, 0xD3C29B3A2F052673, 0x65BA357F45CCD994, 0x2EF06438008699D3, 0x3D9F3733CC41FC85,
+                                                     0xA62CD72FA1C115BB, 0xF3E23F27783814B4, 0x6BDA57A39444DF65, 0x5DD9537EDB07AAFE, 0x00000E2932573918,
+                                                     0x6F199DA3A17891FB, 0x8797E6E3B6C274C9, 0xCB75E52D2E824EE4, 0x459B0B96E7726082, 0xED97C5DAFC70EBF3,
+                                                     0xEAFF17B129494D49, 0x75BA947A2F5ACCBB, 0x3A139024316B9AA9, 0xEB8710A6E849FE98, 0x0000157BAEECB14F },   // r = 11
+                                                   { 0x34D7A86129E6C8CE, 0xAADC528BDF89B946, 0x809BFDDFC39957FD, 0x7AD0092EEE453A06, 0x6DCCA67A873615D9,
+                                                     0x24CEF62BF2500CFB, 0xDB4CA70F363812C4, 0x4C4ED493EDC9E508, 0x7B13290B3BF2CE9F, 0x00000170CBD7926D,
+                                                     0xDE673D5AA9ACABB9, 0x0DD4BA24D73BA195, 0x99F690A401D67E33, 0xA999CD495AB5A4D7, 0x95060B00C662B559,
+                                                     0xE07604C4CA2DAB13, 0x499DA44AF31BE297, 0xC7870EC728FC5D0D, 0x289976A9558669E9, 0x0000015EDDCB8D62 },   // r = 12
+                                                   { 0x316766F331620831, 0x3D28B024A9E3BCB7, 0x7953BAD3408F8496, 0xFCD8C4F4D83C37E4, 0x061E763898E1CF02,
+                                                     0xE8574D098BD067A2, 0xB2A9FEFDEE0F671E, 0xFE97C71848D62F20, 0x7ED34283A840C376, 0x00000C373204E967,
+                                                     0xC8F004EE0571ED51, 0x8BCA9F730E4BDA29, 0xB3F3475D8B478E76, 0xB77647AF8F62973A, 0x527EB8B702A2078E,
+                                                     0x94EA687D2B37F6A6, 0x0E8603FBE7D27816, 0x66EC4E2F6C0F968E, 0x06797B700EEFFCED, 0x00000142C5314AF6 },   // r = 13
+                                                   { 0x5FB02CC7C6E8C70B, 0xE8467E2FACA84AF3, 0xA623419436DA2D6B, 0x97BE9202168AAA1B, 0x82C41D53AC3E3F77,
+                                                     0xC0503B1BDB5F1ABD, 0xB763A32414064647, 0x8933EED150FA54F6, 0x86CCE6A311A46FD7, 0x00000A6DF64D9F99,
+                                                     0x103874A7F6C634B3, 0x44A524FD6DFB2F61, 0x710106E294260F78, 0x13FB7132C4619D0C, 0x294DAD2F8832BFE2,
+                                                     0x12612C56C1AE321A, 0x621CFFBF335C6FE1, 0x1DFA11BFB1872F5B, 0x75AAA762DE704158, 0x000013DCBD2DE527 },   // r = 14
+                                                   { 0x0DFD45317CF2E801, 0x6CFD5E749E570ACC, 0x82FE094CC689D063, 0x90BF01E37EB106D6, 0xBE44BCFB72DB4985,
+                                                     0x4555622EB18CF142, 0xB33F6FF7E0145D09, 0xD1617AA592878C97, 0x385AFC85B9E240C7, 0x00001841BE7A5F88,
+                                                     0xC2D412CE22FFDC39, 0x86876D4E6807D462, 0xB2830D131F63FC99, 0x7F948392776A5EEB, 0x4D72DB4C5880062E,
+                                                     0x3CC972D09459E03B, 0x229CD421323C7AA8, 0xA4D9AD9E062720F5, 0x6E15B87D1C54A26D, 0x00000C2E61B1B551 },   // r = 15
+                                                   { 0x92C9A7872F000E9F, 0xC3B0DFDC101E217D, 0x960EDFC11C164BF3, 0x81E9433480BF9E49, 0x7BB0157F483DC39D,
+                                                     0x4C7BA870726F131F, 0xA6614810AD7090A7, 0x017C3BBC0E0BE955, 0x2D04FE399FE51BE1, 0x00000B04A34A7A60,
+                                                     0x50B967C4432F308C, 0xC173827A82D9AF8A, 0xBBBB242FC208D99F, 0x58B316A8518CD6B5, 0x4F41F7E651335715,
+                                                     0xE525CD65DD4DD9AD, 0x5CD1132C58F5A0C9, 0x3096C31577C27C2E, 0xED9E68CE67A20867, 0x000000251B248067 },   // r = 16
+                                                   { 0xCB575A9D9DAEBDAC, 0x582846B1FE0CB5D0, 0x0FC9270F5B00D21E, 0xDAC0FF34E6C79AE7, 0xB2AAD7CB2044C255,
+                                                     0xB2D99D38925356C5, 0x9A417A1FA4060A9D, 0x762007DCE33041D7, 0x5EB9CB6BA5AA2F6B, 0x00000B4E2E8BC95F,
+                                                     0x6B308AAA62E6F043, 0xA038A5A50AFD1C26, 0x3C15DEAA5AA14BB0, 0x46AAD05ECB31DFF2, 0xBC0A8A40D0FC3927,
+                                                     0xC24584E590C6C943, 0x71AD20DA1D586DA3, 0x6C9AF6E131118B43, 0xA2F70E25A99D9235, 0x0000089D23366B15 }   // r = 17
+                                                   };
+// Tables of the Pohlig-Hellman discrete logarithms, generated by dloggen.py
+#include "P610_dlog_tables.h"
+// Torsion subgroups E[3^175], carried by Bob's public keys, and E[5^119], carried by Alice's public keys
+const torsion_t torsion_A = { 3, EXPON_3, OALICE_BITS, ORDER_A_ENCODED_BYTES, (const digit_t*)Alice_order, (const digit_t*)Montgomery_rprime_A, (const digit_t*)Montgomery_Rprime_A,
+                              W_3, DLEN_3, ELL3_W, ELL3_EMODW, (const uint64_t*)ph3_table, (const uint64_t*)ph3_table0, ph3_path };
+const torsion_t torsion_B = { 5, EXPON_5, OBOB_BITS, ORDER_B_ENCODED_BYTES, (const digit_t*)Bob_order, (const digit_t*)Montgomery_rprime_B, (const digit_t*)Montgomery_Rprime_B,
+                              W_5, DLEN_5, ELL5_W, ELL5_EMODW, (const uint64_t*)ph5_table, (const uint64_t*)ph5_table0, ph5_path };
+#endif
 // Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p610^2), expressed in Montgomery representation
 const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x98ce7aa352ab3c36, 0x80da195d419e75c3, 0xec99654b7df77525, 0x0cb7c8647f383294, 0xf6c085c0d0afd19b,
                                                      0x559f1e82c4d56afe, 0x319be0ab282b67c1, 0x7c967e51ad51e086, 0xfa106315cbd78789, 0x5636b9f0388,   // XPA0
@@ -115,6 +200,10 @@ const uint64_t B_gen_Huff[6 * NWORDS64_FIELD]     = {0x189dca498154c976, 0xd505a
                                                      0x466c34e0eb247db4, 0x56018026620f100d, 0x1a15718da6b15a54, 0x02cf6d0f8df0f334, 0x13e038cfc2fe,   // XRB0
                                                      0xf472b61d0c9b865c, 0xbdcf57273abc5c75, 0x79874a6f9a34548b, 0xe9e2dcfd68fc7732, 0x5b42722650f64bdc,
                                                      0x196595ad11f949d7, 0xd602bd64028d79b1, 0x0312131a05cb54f5, 0xc8cb72131741dda7, 0x189414e171cb }; // XRB1
+#ifdef FIXED_BASE
+// Fixed-base tables of the Huff key generation, generated by fixedgen.py from A_gen_Huff and B_gen_Huff
+#include "P610_fixed_base_tables.h"
+#endif
 
 
 // Initial Huff coefficient c=3+sqrt(8) in GF(p610^2)
@@ -133,24 +222,130 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000A0056, 0xFEFD5
 
 
 const unsigned int strat_Alice_Huff[MAX_Alice] = { 
-0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 5, 5, 5, 5, 5, 6, 6, 7, 8,
-8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14,
-14, 14, 14, 14, 15, 16, 17, 18, 18, 19, 20, 21, 21, 21, 21, 21, 21, 21, 21, 22,
-22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 24, 25, 26, 27, 27, 27, 27, 27, 28,
-29, 30, 31, 32, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35,
-35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39, 40, 41, 41, 41, 41, 41,
-41, 41, 41, 41, 41, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 51, 52, 53, 54,
-55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
-56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56  };
+0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 7, 7, 7, 7, 8, 8,
+9, 9, 9, 9, 10, 11, 12, 12, 12, 12, 12, 13, 13, 13, 14, 15, 16, 16, 16, 16, 16,
+16, 16, 17, 18, 19, 20, 20, 20, 20, 20, 20, 21, 21, 22, 22, 22, 22, 22, 23, 24, 25,
+26, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 33, 33, 33,
+33, 33, 33, 34, 34, 34, 35, 36, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+40, 41, 42, 43, 44, 45, 46, 47, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+48, 48, 48, 49, 50, 51, 52, 53, 54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 56, 56, 56,
+56, 56, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+66, 66, 66, 66, 66, 66, 66 };
+
+const unsigned int strat_Alice_par_Huff[MAX_Alice] = { 
+0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 6, 6,
+6, 6, 6, 7, 7, 7, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 12, 13,
+13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 15, 16, 17, 18, 18, 18, 18,
+18, 18, 18, 18, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 22, 23, 24,
+25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 27, 28, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 31, 32, 33, 34, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 36, 36, 36, 36, 36, 36, 37, 38, 39, 40, 41, 42, 42, 42, 42, 42, 42, 42,
+42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 44, 45, 46, 47, 48,
+49, 49, 49, 49, 49, 49, 49 };
 
 
 const unsigned int strat_Bob_Huff[MAX_Bob] = { 
-0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 7, 7, 7, 7, 8, 8,
-9, 9, 9, 9, 10, 11, 12, 12, 12, 12, 12, 13, 13, 13, 14, 15, 16, 16, 16, 16, 16,
-16, 16, 17, 18, 19, 20, 20, 20, 20, 20, 20, 21, 21, 22, 22, 22, 22, 22, 23, 24,
-25, 26, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 33,
-33, 33, 33, 33, 33, 34, 34, 34, 35, 36, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38,
-38, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 48, 48, 48, 48, 48 };
+0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 7, 7, 7, 7, 8, 9,
+9, 9, 9, 9, 10, 11, 12, 12, 12, 12, 12, 13, 13, 14, 15, 16, 16, 16, 16, 16, 16,
+16, 16, 17, 18, 19, 20, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 24, 25, 26,
+27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 30, 31, 32, 33, 33, 34, 35,
+36, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39, 40,
+41, 42, 43, 44, 45, 46, 47, 48, 49, 49, 49, 49, 49, 49 };
+
+const unsigned int strat_Bob_par_Huff[MAX_Bob] = { 
+0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 6, 6, 6,
+6, 6, 6, 7, 7, 8, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 11, 12, 13, 13,
+13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 16, 17, 18, 19, 19, 19, 19,
+19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 22, 23, 24, 25,
+25, 26, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 30, 31, 32, 33, 34, 35 };
+
+// Strategies for the twisted Edwards isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Edwards[MAX_Alice] = { 
+0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 5, 5, 5, 5, 5, 6, 6, 7, 8,
+8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14,
+14, 14, 14, 14, 14, 15, 16, 17, 18, 18, 19, 20, 21, 21, 21, 21, 21, 21, 21, 21, 22,
+22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 24, 25, 26, 27, 27, 27, 27, 27, 28, 29,
+30, 31, 32, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39, 40, 41, 41, 41, 41, 41, 41, 41, 41,
+41, 41, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 51, 52, 53, 54, 55, 55, 55, 55,
+55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+56, 56, 56, 56, 56, 56, 56 };
+
+const unsigned int strat_Bob_Edwards[MAX_Bob] = { 
+0, 1, 1, 2, 2, 2, 3, 4, 4, 4, 4, 5, 5, 6, 7, 7, 8, 8, 8, 8, 9,
+9, 9, 9, 10, 11, 12, 12, 12, 13, 14, 15, 15, 15, 15, 15, 16, 17, 17, 17, 17, 17,
+17, 17, 18, 19, 20, 21, 21, 21, 21, 21, 21, 22, 23, 24, 25, 26, 27, 27, 27, 27, 27,
+27, 28, 28, 29, 30, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 34, 35, 36,
+37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+47, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49 };
+
+
+// Working-set-bounded strategies for the Huff trees, storing at most strat_bounds[i] points and listed in traversal order
+const unsigned int strat_bounds[STRAT_NBOUNDS] = { 4, 6, 8 };
+
+const unsigned int strat_Alice_ws4_Huff[MAX_Alice-1] = { 
+92, 55, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6,
+3, 2, 1, 3, 2, 1, 1, 1, 34, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6,
+3, 2, 1, 3, 2, 1, 1, 1, 19, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1,
+1, 1, 9, 6, 3, 2, 1, 3, 2, 1, 1, 1, 3, 3, 2, 1, 1, 1, 1, 1, 51,
+25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 14, 7, 3, 2, 1,
+4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 26, 14,
+7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1,
+1, 1, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Alice_ws6_Huff[MAX_Alice-1] = { 
+78, 46, 26, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5,
+3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 20, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 32, 20, 12, 7, 4, 2, 1, 2,
+1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5,
+3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1,
+1, 1, 1, 1, 1, 1 };
+
+const unsigned int strat_Alice_ws8_Huff[MAX_Alice-1] = { 
+62, 40, 27, 20, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3,
+2, 1, 1, 1, 1, 1, 9, 6, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 2, 1,
+1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 14, 9, 6, 4, 3, 2, 1, 1, 1, 1,
+1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1,
+1, 1, 1, 1, 2, 1, 1, 1, 22, 14, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3,
+2, 1, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws4_Huff[MAX_Bob-1] = { 
+62, 36, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1,
+1, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3, 2, 1,
+3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 30, 17, 10, 4, 3, 2,
+1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 8, 5, 3, 2, 1, 2, 2, 1, 1, 4, 2,
+1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7,
+4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws6_Huff[MAX_Bob-1] = { 
+47, 32, 19, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1,
+1, 1, 8, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 13,
+8, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws8_Huff[MAX_Bob-1] = { 
+48, 28, 16, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 20, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1 };
+
+// Measured costs of the kernels of the Huff trees in the Huff and Montgomery models (columns MODEL_HUFF, MODEL_MONT),
+// the hybrid traversals (HYBRID_MODELS) run each kernel in the cheaper model
+const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { 
+{ 72847, 87716 }, { 40503, 40393 }, { 126331, 133719 }, { 72772, 68327 } };
+
 
 
 
@@ -191,5 +386,12 @@ const unsigned int strat_Bob_Huff[MAX_Bob] = {
 
 #include "../fpx.c"
 #include "../ec_isogeny.c"
+#ifdef COMPRESS
+#include "../pairing.c"
+#include "../dlog.c"
+#include "../torsion_basis.c"
+#endif
+#include "../parallel.c"
+#include "../traverse.c"
 #include "../sidh.c"
 #include "../sike.c"
\ No newline at end of file
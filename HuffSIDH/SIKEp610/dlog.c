@@ -0,0 +1,122 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: discrete logarithms in the cyclotomic subgroups of order ell^e of GF(p^2), for the compression of public keys
+*********************************************************************************************/
+
+// Windowed Pohlig-Hellman with signed digits, in base the fixed generator g of the subgroup chosen by dloggen.py. The logarithm
+// is written with n = T->ndigits digits x = d[0] + ell^r*(d[1] + d[2]*ell^w + ... + d[n-1]*ell^(w*(n-2))), where w = T->w,
+// r = e - w*(n-1), |d[0]| <= ell^r/2 and |d[k]| <= ell^w/2 for k > 0. The digits are the leaves of a tree traversed along the
+// optimal path T->path: going down the tree raises an element to the power ell^w, and going right removes known digits
+// with the tables of powers of g (see torsion_t), whose entries of norm 1 are inverted by conjugation.
+
+
+static void ph_entry(const torsion_t* T, const int row, const unsigned int j, f2elm_t a)
+{ // a = g^(j*ell^(r+w*row)), or a = g^j for row = -1, with 1 <= j <= ell^w/2 (ell^r/2 for row = -1)
+    const uint64_t* entry;
+
+    if (row < 0) {
+        entry = T->table0 + (j - 1)*2*NWORDS64_FIELD;
+    } else {
+        entry = T->table + ((unsigned int)row*(T->ellw/2) + j - 1)*2*NWORDS64_FIELD;
+    }
+    copy_words((const digit_t*)entry, (digit_t*)a, 2*NWORDS_FIELD);
+}
+
+
+static int ph_leaf(const f2elm_t a, const torsion_t* T, const unsigned int k, int* d)
+{ // Digit d = d[k], for a = g^(d[k]*ell^(e-w)), or a = g^(d[0]*ell^(e-r)) for k = 0. Returns 1 if a is not in the table.
+    f2elm_t b, c;
+    unsigned int j, scale = (k == 0) ? T->ellw/T->ellr : 1;
+
+    fp2copy(a, b);
+    fp2correction(b);
+    fpcopy((digit_t*)&Montgomery_one, c[0]);
+    fpcorrection(c[0]);
+    if (memcmp(b[0], c[0], sizeof(felm_t)) == 0) {         // a = 1
+        *d = 0;
+        return 0;
+    }
+    for (j = scale; j <= T->ellw/2; j += scale) {                        // The entries and their inverses have distinct real parts
+        ph_entry(T, (int)T->ndigits - 2, j, c);
+        if (memcmp(b[0], c[0], sizeof(felm_t)) == 0) {
+            *d = (memcmp(b[1], c[1], sizeof(felm_t)) == 0) ? (int)(j/scale) : -(int)(j/scale);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+static int ph_traverse(f2elm_t a, const torsion_t* T, const unsigned int k, const unsigned int z, int* d, const felm_t one)
+{ // Digits d[k], ..., d[k+z-1], for a = h'^(ell^(e-r-w*(k+z-1))), where h' is h without its digits d[0], ..., d[k-1]. Overwrites a.
+  // Returns 1 if a digit is not found.
+    f2elm_t b, c;
+    unsigned int t, m, j;
+    int row;
+
+    if (z == 1) {
+        return ph_leaf(a, T, k, &d[k]);
+    }
+    t = T->path[z];                                                         // Leaves of the left subtree
+    fp2copy(a, b);
+    exp_ell_Fp2_cycl(b, T->ell, T->w*(z - t), one);
+    if (ph_traverse(b, T, k, t, d, one) != 0) {
+        return 1;
+    }
+    for (m = k; m < k + t; m++) {                                           // a = a*g^(-d[m]*ell^(e-w*(k+z-m))), from the table row
+        if (d[m] == 0) {                                                    // n-1-(k+z-m), with d[0] scaled to the windows of w digits
+            continue;
+        }
+        row = (int)T->ndigits - 1 - (int)(k + z - m);
+        j = (unsigned int)((d[m] > 0) ? d[m] : -d[m]);
+        if (m == 0 && row >= 0) {
+            j *= T->ellw/T->ellr;
+        }
+        ph_entry(T, row, j, c);
+        if (d[m] > 0) {
+            fp2_conj(c, c);
+        }
+        fp2mul_mont(a, c, a);
+    }
+    return ph_traverse(a, T, k + t, z - t, d, one);
+}
+
+
+static void mul_word_mod(digit_t* a, const digit_t b, const digit_t* c)
+{ // a = a*b + c mod 2^NBITS_ORDER, for a and c of NWORDS_ORDER words
+    digit_t t[NWORDS_ORDER] = {0}, u[2*NWORDS_ORDER];
+
+    t[0] = b;
+    multiply(a, t, u, NWORDS_ORDER);
+    mp_add(u, c, a, NWORDS_ORDER);
+}
+
+
+int dlog_pohlig_hellman(const f2elm_t h, const torsion_t* T, digit_t* x)
+{ // Discrete logarithm x in [0, ell^e - 1] of h in base the generator g of the subgroup of order ell^e of GF(p^2)* (see torsion_t).
+  // h must be in that subgroup, as the reduced Tate pairings of points of E[ell^e] are. Returns 1 if a digit is not found.
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public values.
+    int d[NBITS_ORDER];
+    f2elm_t a;
+    felm_t one = {0};
+    digit_t pos[NWORDS_ORDER] = {0}, neg[NWORDS_ORDER] = {0}, t[NWORDS_ORDER] = {0};
+    int i;
+
+    fpcopy((digit_t*)&Montgomery_one, one);
+    fp2copy(h, a);
+    if (ph_traverse(a, T, 0, T->ndigits, d, one) != 0) {
+        return 1;
+    }
+
+    for (i = (int)T->ndigits - 1; i >= 0; i--) {                          // x = pos - neg, by Horner's rule on the positive and
+        t[0] = (digit_t)((d[i] > 0) ? d[i] : 0);                            // negative digits
+        mul_word_mod(pos, (i == 0) ? T->ellr : T->ellw, t);
+        t[0] = (digit_t)((d[i] < 0) ? -d[i] : 0);
+        mul_word_mod(neg, (i == 0) ? T->ellr : T->ellw, t);
+    }
+    if (mp_sub(pos, neg, x, NWORDS_ORDER) != 0) {
+        mp_add(x, T->order, x, NWORDS_ORDER);
+    }
+    return 0;
+}
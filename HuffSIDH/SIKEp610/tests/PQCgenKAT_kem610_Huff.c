@@ -0,0 +1,97 @@
+/********************************************************************************************
+* Abstract: generate the known answer test vectors of the Huff KEM
+*
+* Writes KAT/PQCkemKAT_Huff_<CRYPTO_SECRETKEYBYTES>.rsp in the format of the NIST PQC KAT generator 
+* (seeds from the AES-256 CTR DRBG), which PQCtestKAT_kem610_Huff.c checks.
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "rng/rng.h"
+#include "../P610/api.h"
+
+
+#define KAT_COUNT           100
+#define KAT_SUCCESS          0
+#define KAT_FILE_OPEN_ERROR -1
+#define KAT_CRYPTO_FAILURE  -4
+
+void    fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L);
+
+int
+main()
+{
+    char                fn_rsp[64];
+    FILE                *fp_rsp;
+    unsigned char       entropy_input[48];
+    unsigned char       seed[KAT_COUNT][48];
+    unsigned char       ct[CRYPTO_CIPHERTEXTBYTES], ss[CRYPTO_BYTES], ss1[CRYPTO_BYTES];
+    unsigned char       pk[CRYPTO_PUBLICKEYBYTES], sk[CRYPTO_SECRETKEYBYTES];
+    int                 i, ret_val;
+
+    sprintf(fn_rsp, "../../../KAT/PQCkemKAT_Huff_%d.rsp", CRYPTO_SECRETKEYBYTES);
+    if ( (fp_rsp = fopen(fn_rsp, "w")) == NULL ) {
+        printf("Couldn't open <%s> for write\n", fn_rsp);
+        return KAT_FILE_OPEN_ERROR;
+    }
+
+    // Same seeds as the NIST PQC KAT generator
+    for (i = 0; i < 48; i++)
+        entropy_input[i] = i;
+    randombytes_init(entropy_input, NULL, 256);
+    for (i = 0; i < KAT_COUNT; i++)
+        randombytes(seed[i], 48);
+
+    fprintf(fp_rsp, "# %s\n\n", CRYPTO_ALGNAME_HUFF);
+    for (i = 0; i < KAT_COUNT; i++) {
+        fprintf(fp_rsp, "count = %d\n", i);
+        fprintBstr(fp_rsp, "seed = ", seed[i], 48);
+        randombytes_init(seed[i], NULL, 256);
+
+        if ( (ret_val = crypto_kem_keypair_Huff(pk, sk)) != 0) {
+            printf("crypto_kem_keypair_Huff returned <%d>\n", ret_val);
+            return KAT_CRYPTO_FAILURE;
+        }
+        fprintBstr(fp_rsp, "pk = ", pk, CRYPTO_PUBLICKEYBYTES);
+        fprintBstr(fp_rsp, "sk = ", sk, CRYPTO_SECRETKEYBYTES);
+
+        if ( (ret_val = crypto_kem_enc_Huff(ct, ss, pk)) != 0) {
+            printf("crypto_kem_enc_Huff returned <%d>\n", ret_val);
+            return KAT_CRYPTO_FAILURE;
+        }
+        fprintBstr(fp_rsp, "ct = ", ct, CRYPTO_CIPHERTEXTBYTES);
+        fprintBstr(fp_rsp, "ss = ", ss, CRYPTO_BYTES);
+        fprintf(fp_rsp, "\n");
+
+        if ( (ret_val = crypto_kem_dec_Huff(ss1, ct, sk)) != 0) {
+            printf("crypto_kem_dec_Huff returned <%d>\n", ret_val);
+            return KAT_CRYPTO_FAILURE;
+        }
+        if ( memcmp(ss, ss1, CRYPTO_BYTES) ) {
+            printf("crypto_kem_dec_Huff returned bad 'ss' value\n");
+            return KAT_CRYPTO_FAILURE;
+        }
+    }
+
+    fclose(fp_rsp);
+    printf("Known answer test vectors written to <%s>\n", fn_rsp);
+
+    return KAT_SUCCESS;
+}
+
+
+void
+fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L)
+{
+    unsigned long long  i;
+
+    fprintf(fp, "%s", S);
+
+    for ( i=0; i<L; i++ )
+        fprintf(fp, "%02X", A[i]);
+
+    if ( L == 0 )
+        fprintf(fp, "00");
+
+    fprintf(fp, "\n");
+}
@@ -0,0 +1,341 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: cost-model-driven generation of optimal strategies for the Huff and twisted Edwards isogeny trees
+*********************************************************************************************/
+
+#include <stdlib.h>
+
+
+// Measurement parameters
+#define STRATEGY_LOOPS     200      // Number of kernel calls per measurement
+#define STRATEGY_REPS      10       // Number of measurements, the minimum is kept
+#define MAX_TABLES         20       // Maximum number of strategy tables
+
+#ifdef STRATEGY_PREORDER
+    #define DEFAULT_PREORDER   1        // Layout of the default tables
+#else
+    #define DEFAULT_PREORDER   0
+#endif
+
+typedef void (*kernel_t)(point_proj_t P, const f2elm_t* coeff);
+
+typedef struct {
+    const char* name;            // Name of the table in the parameter file
+    const char* size;            // Declared size of the table
+    const char* label;           // Operation that uses the table
+    unsigned int nleaves;        // Number of isogeny steps
+    unsigned int maxpts;         // Maximum number of stored points
+    unsigned int party;          // ALICE or BOB
+    unsigned int threads;        // Number of threads sharing the isogeny evaluations
+    unsigned int preorder;       // Layout of the table: traversal order (1) or indexed by the height of the current node (0)
+    unsigned int edwards;        // Costs of the twisted Edwards kernels (1) or of the Huff kernels (0)
+} strategy_t;
+
+
+static uint64_t kernel_cost(kernel_t kernel)
+{ // Measures the cost of one call to "kernel" in cycles on random inputs
+    point_proj_t P;
+    f2elm_t coeff[4];
+    uint64_t cycles, best = (uint64_t)-1;
+    int64_t cycles1;
+    unsigned int i, n;
+
+    fp2random_test((digit_t*)P->X);
+    fp2random_test((digit_t*)P->Z);
+    for (i = 0; i < 4; i++) {
+        fp2random_test((digit_t*)coeff[i]);
+    }
+
+    for (i = 0; i < STRATEGY_REPS; i++)
+    {
+        cycles1 = cpucycles();
+        for (n = 0; n < STRATEGY_LOOPS; n++) {
+            kernel(P, (const f2elm_t*)coeff);
+        }
+        cycles = (uint64_t)(cpucycles() - cycles1) / STRATEGY_LOOPS;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+
+static uint64_t optimal_strategy(const unsigned int nleaves, const unsigned int maxpts, const uint64_t p, const uint64_t q, unsigned int* split)
+{ // Dynamic-programming search of the optimal strategy for a tree with nleaves leaves storing at most maxpts intermediate points.
+  // Input: cost p of a multiplication step and cost q of an isogeny evaluation.
+  // Returns the predicted cost of the traversal.
+  // Output: split[L*(maxpts+1)+k] = number of multiplication steps taken first at a node with L leaves when k points can still be stored.
+  //         At such a node, the left subtree has L-m leaves and k-1 free points, and the right subtree m leaves and k free points.
+    uint64_t *C = calloc((nleaves + 1)*(maxpts + 1), sizeof(uint64_t)), c;
+    unsigned int L, k, m, w = maxpts + 1;
+
+    for (k = 0; k <= maxpts; k++) {
+        C[w+k] = 0;
+    }
+    for (L = 2; L <= nleaves; L++) {
+        C[L*w] = (uint64_t)-1;                      // No strategy without stored points
+        for (k = 1; k <= maxpts; k++) {
+            C[L*w+k] = (uint64_t)-1;
+            for (m = 1; m < L; m++) {
+                if (C[(L-m)*w+k-1] == (uint64_t)-1 || C[m*w+k] == (uint64_t)-1) continue;
+                c = C[(L-m)*w+k-1] + C[m*w+k] + m*p + (L-m)*q;
+                if (c < C[L*w+k]) {
+                    C[L*w+k] = c;
+                    split[L*w+k] = m;
+                }
+            }
+        }
+    }
+    c = C[nleaves*w+maxpts];
+    free(C);
+    return c;
+}
+
+
+static unsigned int strategy_preorder(const unsigned int L, const unsigned int k, const unsigned int maxpts, const unsigned int* split, unsigned int* strat)
+{ // Flattens the strategy into the sequence of multiplication steps in traversal order: [m] + left subtree + right subtree
+    unsigned int m, n;
+
+    if (L < 2) return 0;
+    m = split[L*(maxpts+1)+k];
+    strat[0] = m;
+    n = 1 + strategy_preorder(L - m, k - 1, maxpts, split, strat + 1);
+    return n + strategy_preorder(m, k, maxpts, split, strat + n);
+}
+
+
+static unsigned int strategy_depth(const unsigned int L, const unsigned int* strat)
+{ // Number of points stored by a strategy indexed by the height of the current node, strat[L-1] steps at a node with L leaves
+    unsigned int left, right;
+
+    if (L < 2) return 0;
+    left = 1 + strategy_depth(L - strat[L-1], strat);
+    right = strategy_depth(strat[L-1], strat);
+    return (left > right) ? left : right;
+}
+
+
+static char* strategy_table(const strategy_t* st, const uint64_t p, const uint64_t q, uint64_t* cost)
+{ // Returns the C declaration of the strategy table st->name, or NULL if no strategy fits in st->maxpts stored points.
+  // The predicted cost of the traversal is returned in cost.
+  // st->preorder = 1: table of nleaves-1 entries in traversal order, consumed as strat[ii++].
+  // st->preorder = 0: table of nleaves entries indexed by the height of the current node, consumed as strat[MAX-index-row].
+  //                   Such a table cannot depend on the number of stored points: it is read from the column of maxpts free points,
+  //                   or from the first column below it whose table fits in maxpts stored points (the predicted cost is then a lower bound).
+    const unsigned int nleaves = st->nleaves, maxpts = st->maxpts;
+    unsigned int *split = calloc((nleaves + 1)*(maxpts + 1), sizeof(unsigned int)), *strat = calloc(nleaves, sizeof(unsigned int));
+    unsigned int i, k, len, ok;
+    char *out = NULL, *s;
+
+    *cost = optimal_strategy(nleaves, maxpts, p, q, split);
+    if (st->preorder) {
+        ok = (split[nleaves*(maxpts+1)+maxpts] != 0);
+        len = ok ? strategy_preorder(nleaves, maxpts, maxpts, split, strat) : 0;
+    } else {
+        len = nleaves;
+        for (k = maxpts, ok = 0; k > 0 && !ok; k--) {
+            for (i = 1; i < nleaves; i++) {
+                strat[i] = split[(i+1)*(maxpts+1)+k];
+            }
+            ok = (strategy_depth(nleaves, strat) <= maxpts);
+        }
+    }
+
+    if (ok) {
+        out = malloc(64 + 8*nleaves);
+        s = out;
+        s += sprintf(s, "const unsigned int %s[%s] = { \n", st->name, st->size);
+        for (i = 0; i < len; i++) {
+            s += sprintf(s, "%u%s", strat[i], (i == len-1) ? " };" : ((i % 21) == 20) ? ",\n" : ", ");
+        }
+    }
+    free(split);
+    free(strat);
+    return out;
+}
+
+
+static int replace_table(char** src, const char* name, const char* table)
+{ // Replaces the declaration of table "name" in the source text src
+    char key[64], *start, *end, *out;
+    size_t len;
+
+    sprintf(key, "const unsigned int %s[", name);
+    start = strstr(*src, key);
+    if (start == NULL) return FAILED;
+    end = strstr(start, "};");
+    if (end == NULL) return FAILED;
+    end += 2;
+
+    len = strlen(*src) - (end - start) + strlen(table);
+    out = malloc(len + 1);
+    memcpy(out, *src, start - *src);
+    strcpy(out + (start - *src), table);
+    strcat(out, end);
+    free(*src);
+    *src = out;
+    return PASSED;
+}
+
+
+static char* cost_table(uint64_t costs[HYBRID_NKERNELS][2])
+{ // Returns the C declaration of the kernel cost table hybrid_costs
+    char *out = malloc(128 + 48*HYBRID_NKERNELS), *s = out;
+    unsigned int i;
+
+    s += sprintf(s, "const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { \n");
+    for (i = 0; i < HYBRID_NKERNELS; i++) {
+        s += sprintf(s, "{ %u, %u }%s", (unsigned int)costs[i][MODEL_HUFF], (unsigned int)costs[i][MODEL_MONT], (i == HYBRID_NKERNELS-1) ? " };" : ", ");
+    }
+    return out;
+}
+
+
+static int write_tables(const char* path, const char** names, char** tables, const unsigned int ntables)
+{ // Rewrites the tables "names" in the parameter file at "path"
+    FILE *f;
+    char *src;
+    long len;
+    unsigned int i;
+    int status = PASSED;
+
+    if ((f = fopen(path, "rb")) == NULL) return FAILED;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    src = malloc(len + 1);
+    len = (long)fread(src, 1, len, f);
+    src[len] = 0;
+    fclose(f);
+
+    for (i = 0; i < ntables; i++) {
+        status |= replace_table(&src, names[i], tables[i]);
+    }
+    if (status == PASSED) {
+        if ((f = fopen(path, "wb")) == NULL) {
+            status = FAILED;
+        } else {
+            fputs(src, f);
+            fclose(f);
+        }
+    }
+    free(src);
+    return status;
+}
+
+
+static void print_cost(const char* label, const uint64_t cycles)
+{
+    unsigned int i;
+
+    printf("  %s runs in ", label);
+    for (i = (unsigned int)strlen(label); i < 54; i++) printf(".");
+    printf(" %10lld ", (long long)cycles); print_unit;
+    printf("\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    // Key generation and agreement share one table per party: the images of phiP, phiQ and phiR cost the same number of isogeny
+    // evaluations (one per step) under every strategy, so they do not move the optimum and are left out of the cost model.
+    // With PARALLEL_THREADS threads, the isogeny evaluations of a step are modeled as costing 1/PARALLEL_THREADS on the critical path.
+    // The working-set-bounded tables (strat_*_wsk_Huff, at most k stored points) are also shared, and always stored in traversal order.
+    // The twisted Edwards tables (strat_*_Edwards) are computed with the costs of the Edwards kernels.
+    // The kernel cost table hybrid_costs is written after the strategy tables.
+    const strategy_t st[] = {{ "strat_Alice_Huff",        STRAT_ALICE_SIZE, "Alice's tree", MAX_Alice, MAX_INT_POINTS_ALICE, ALICE, 1, DEFAULT_PREORDER, 0 },
+                             { "strat_Alice_par_Huff",    STRAT_ALICE_SIZE, "Alice's parallel tree", MAX_Alice, MAX_INT_POINTS_ALICE, ALICE, PARALLEL_THREADS, DEFAULT_PREORDER, 0 },
+                             { "strat_Alice_ws4_Huff",    "MAX_Alice-1",    "Alice's tree, 4 stored points", MAX_Alice, 4, ALICE, 1, 1, 0 },
+                             { "strat_Alice_ws6_Huff",    "MAX_Alice-1",    "Alice's tree, 6 stored points", MAX_Alice, 6, ALICE, 1, 1, 0 },
+                             { "strat_Alice_ws8_Huff",    "MAX_Alice-1",    "Alice's tree, 8 stored points", MAX_Alice, 8, ALICE, 1, 1, 0 },
+                             { "strat_Bob_Huff",          STRAT_BOB_SIZE,   "Bob's tree", MAX_Bob, MAX_INT_POINTS_BOB, BOB, 1, DEFAULT_PREORDER, 0 },
+                             { "strat_Bob_par_Huff",      STRAT_BOB_SIZE,   "Bob's parallel tree", MAX_Bob, MAX_INT_POINTS_BOB, BOB, PARALLEL_THREADS, DEFAULT_PREORDER, 0 },
+                             { "strat_Bob_ws4_Huff",      "MAX_Bob-1",      "Bob's tree, 4 stored points", MAX_Bob, 4, BOB, 1, 1, 0 },
+                             { "strat_Bob_ws6_Huff",      "MAX_Bob-1",      "Bob's tree, 6 stored points", MAX_Bob, 6, BOB, 1, 1, 0 },
+                             { "strat_Bob_ws8_Huff",      "MAX_Bob-1",      "Bob's tree, 8 stored points", MAX_Bob, 8, BOB, 1, 1, 0 },
+                             { "strat_Alice_Edwards",     STRAT_ALICE_SIZE, "Alice's Edwards tree", MAX_Alice, MAX_INT_POINTS_ALICE, ALICE, 1, DEFAULT_PREORDER, 1 },
+                             { "strat_Bob_Edwards",       STRAT_BOB_SIZE,   "Bob's Edwards tree", MAX_Bob, MAX_INT_POINTS_BOB, BOB, 1, DEFAULT_PREORDER, 1 },
+                           };
+    const unsigned int ntables = sizeof(st)/sizeof(st[0]);
+    uint64_t pA, qA, pB, qB, pAe, qAe, pBe, qBe, p, q, cost, costs[HYBRID_NKERNELS][2];
+    const char* names[MAX_TABLES];
+    char *tables[MAX_TABLES], label[128];
+    unsigned int i;
+    int status = PASSED;
+
+    printf("\n\nGENERATING OPTIMAL STRATEGIES FOR THE HUFF AND TWISTED EDWARDS ISOGENY TREES OF %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    pA = kernel_cost(mul_Alice);
+    qA = kernel_cost(eval_Alice);
+    pB = kernel_cost(mul_Bob);
+    qB = kernel_cost(eval_Bob);
+
+    print_cost("xDBL_Huff", kernel_cost(dbl_Huff));
+    print_cost("Alice's multiplication step " MUL_ALICE_NAME, pA);
+    print_cost("Alice's isogeny evaluation " EVAL_ALICE_NAME, qA);
+    print_cost("Bob's multiplication step " MUL_BOB_NAME, pB);
+    print_cost("Bob's isogeny evaluation " EVAL_BOB_NAME, qB);
+
+    // Kernel cost table of the hybrid traversals. The Montgomery kernels are measured on Huff points, including the model switch
+    costs[HYBRID_ALICE_MUL][MODEL_HUFF] = pA;
+    costs[HYBRID_ALICE_EVAL][MODEL_HUFF] = qA;
+    costs[HYBRID_BOB_MUL][MODEL_HUFF] = pB;
+    costs[HYBRID_BOB_EVAL][MODEL_HUFF] = qB;
+    costs[HYBRID_ALICE_MUL][MODEL_MONT] = kernel_cost(mul_Alice_Mont);
+    costs[HYBRID_ALICE_EVAL][MODEL_MONT] = kernel_cost(eval_Alice_Mont);
+    costs[HYBRID_BOB_MUL][MODEL_MONT] = kernel_cost(mul_Bob_Mont);
+    costs[HYBRID_BOB_EVAL][MODEL_MONT] = kernel_cost(eval_Bob_Mont);
+    print_cost("Alice's multiplication step " MUL_ALICE_MONT_NAME, costs[HYBRID_ALICE_MUL][MODEL_MONT]);
+    print_cost("Alice's isogeny evaluation " EVAL_ALICE_MONT_NAME, costs[HYBRID_ALICE_EVAL][MODEL_MONT]);
+    print_cost("Bob's multiplication step " MUL_BOB_MONT_NAME, costs[HYBRID_BOB_MUL][MODEL_MONT]);
+    print_cost("Bob's isogeny evaluation " EVAL_BOB_MONT_NAME, costs[HYBRID_BOB_EVAL][MODEL_MONT]);
+
+    pAe = kernel_cost(mul_Alice_Edwards);
+    qAe = kernel_cost(eval_Alice_Edwards);
+    pBe = kernel_cost(mul_Bob_Edwards);
+    qBe = kernel_cost(eval_Bob_Edwards);
+    print_cost("Alice's multiplication step " MUL_ALICE_EDWARDS_NAME, pAe);
+    print_cost("Alice's isogeny evaluation " EVAL_ALICE_EDWARDS_NAME, qAe);
+    print_cost("Bob's multiplication step " MUL_BOB_EDWARDS_NAME, pBe);
+    print_cost("Bob's isogeny evaluation " EVAL_BOB_EDWARDS_NAME, qBe);
+    printf("\n");
+
+    for (i = 0; i < ntables; i++) {
+        if (st[i].edwards) {
+            p = (st[i].party == ALICE) ? pAe : pBe;
+            q = (st[i].party == ALICE) ? qAe : qBe;
+        } else {
+            p = (st[i].party == ALICE) ? pA : pB;
+            q = (st[i].party == ALICE) ? qA : qB;
+        }
+        names[i] = st[i].name;
+        tables[i] = strategy_table(&st[i], p, q/st[i].threads, &cost);
+        if (tables[i] == NULL) {
+            printf("  No strategy for %s fits in %u stored points ... FAILED\n", st[i].name, st[i].maxpts);
+            status = FAILED;
+        } else {
+            sprintf(label, "%s (predicted)", st[i].label);
+            print_cost(label, cost);
+        }
+    }
+    printf("\n");
+    names[ntables] = "hybrid_costs";
+    tables[ntables] = cost_table(costs);
+
+    if (status == PASSED) {
+        if (argc > 1) {
+            status = write_tables(argv[1], names, tables, ntables + 1);
+            printf("  Writing strategy tables to %s ... %s\n", argv[1], (status == PASSED) ? "DONE" : "FAILED");
+        } else {
+            for (i = 0; i <= ntables; i++) {
+                printf("%s\n\n", tables[i]);
+            }
+        }
+    }
+
+    for (i = 0; i <= ntables; i++) {
+        free(tables[i]);
+    }
+    return status;
+}
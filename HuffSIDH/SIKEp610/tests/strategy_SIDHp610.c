@@ -0,0 +1,53 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: optimal strategy generation for the Huff and twisted Edwards isogeny trees of SIDHp610
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610_internal.h"
+#include "../internal.h"
+
+
+#define SCHEME_NAME        "SIDHp610"
+#define fp2random_test     fp2random610_test
+
+// Alice computes 3-isogenies, Bob computes 5-isogenies
+#define MUL_ALICE_NAME     "(xTPL_Huff)"
+#define EVAL_ALICE_NAME    "(eval_3_isog_Huff)"
+#define MUL_BOB_NAME       "(x5P_Huff)"
+#define EVAL_BOB_NAME      "(eval_5_isog_Huff)"
+#define STRAT_ALICE_SIZE   "MAX_Alice"
+#define STRAT_BOB_SIZE     "MAX_Bob"
+
+// Montgomery kernels applied to Huff points, for the hybrid traversals
+#define MUL_ALICE_MONT_NAME     "(xTPL)"
+#define EVAL_ALICE_MONT_NAME    "(eval_3_isog)"
+#define MUL_BOB_MONT_NAME       "(x5P)"
+#define EVAL_BOB_MONT_NAME      "(eval_5_isog)"
+
+// Twisted Edwards kernels, for the strat_*_Edwards tables
+#define MUL_ALICE_EDWARDS_NAME  "(xTPL_Edwards)"
+#define EVAL_ALICE_EDWARDS_NAME "(eval_3_isog_Edwards)"
+#define MUL_BOB_EDWARDS_NAME    "(x5P_Edwards)"
+#define EVAL_BOB_EDWARDS_NAME   "(eval_5_isog_Edwards)"
+
+static void dbl_Huff(point_proj_t P, const f2elm_t* coeff)   { xDBL_Huff(P, P, coeff[0], coeff[1]); }
+static void mul_Alice(point_proj_t P, const f2elm_t* coeff)  { xTPL_Huff(P, P, coeff[0], coeff[1]); }
+static void eval_Alice(point_proj_t P, const f2elm_t* coeff) { eval_3_isog_Huff(P, coeff); }
+static void mul_Bob(point_proj_t P, const f2elm_t* coeff)    { point_proj_t Q; x5P_Huff(P, Q, coeff[0], coeff[1]); }
+static void eval_Bob(point_proj_t P, const f2elm_t* coeff)   { eval_5_isog_Huff(P, coeff); }
+static void mul_Alice_Mont(point_proj_t P, const f2elm_t* coeff)  { map_mont_huff(P, P); xTPL(P, P, coeff[0], coeff[1]); map_mont_huff(P, P); }
+static void eval_Alice_Mont(point_proj_t P, const f2elm_t* coeff) { map_mont_huff(P, P); eval_3_isog(P, coeff); map_mont_huff(P, P); }
+static void mul_Bob_Mont(point_proj_t P, const f2elm_t* coeff)    { f2elm_t A[2]; huff_to_mont_curve(coeff[0], coeff[1], A[0], A[1]); map_mont_huff(P, P); x5P(P, P, A[0], A[1]); map_mont_huff(P, P); }
+static void eval_Bob_Mont(point_proj_t P, const f2elm_t* coeff)   { map_mont_huff(P, P); eval_5_isog(P, (const point_proj*)coeff, (const point_proj*)coeff + 1); map_mont_huff(P, P); }
+static void mul_Alice_Edwards(point_proj_t P, const f2elm_t* coeff)  { xTPL_Edwards(P, P, coeff[0], coeff[1]); }
+static void eval_Alice_Edwards(point_proj_t P, const f2elm_t* coeff) { eval_3_isog_Edwards(P, coeff); }
+static void mul_Bob_Edwards(point_proj_t P, const f2elm_t* coeff)    { point_proj_t Q; x5P_Edwards(P, Q, coeff[0], coeff[1]); }
+static void eval_Bob_Edwards(point_proj_t P, const f2elm_t* coeff)   { eval_5_isog_Edwards(P, (const point_proj*)coeff, (const point_proj*)coeff + 1); }
+
+
+
+#include "strategy.c"
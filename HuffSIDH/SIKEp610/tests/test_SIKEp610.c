@@ -8,6 +8,7 @@
 #include <string.h>
 #include "test_extras.h"
 #include "../P610/api.h"
+#include "../sha3/fips202.h"
 
 
 #define SCHEME_NAME    "SIKEp610"
@@ -0,0 +1,335 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing and benchmarking the primitives of the public key compression
+*********************************************************************************************/
+
+#include "../random/random.h"
+
+
+// Benchmark and test parameters
+#define BENCH_LOOPS        100     // Number of iterations per bench
+#define TEST_LOOPS         100     // Number of iterations per test
+
+
+static void random_order(const torsion_t* T, digit_t* x)
+{ // Random x in [0, 2^(nbits-1) - 1], a subset of [0, ell^e - 1]
+    unsigned int i;
+
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        x[i] = 0;
+    }
+    randombytes((unsigned char*)x, T->nbytes);
+    for (i = T->nbits - 1; i < NWORDS_ORDER*RADIX; i++) {
+        x[i/RADIX] &= ~((digit_t)1 << (i % RADIX));
+    }
+}
+
+
+static void power(const f2elm_t g, const digit_t* x, const unsigned int nbits, f2elm_t h)
+{ // h = g^x by square-and-multiply, for g of norm 1 and x of nbits bits
+    unsigned int started = 0;
+    int i;
+
+    for (i = (int)nbits - 1; i >= 0; i--) {
+        if (started) {
+            fp2sqr_test(h, h);
+        }
+        if ((x[i/RADIX] >> (i % RADIX)) & 1) {
+            if (started) {
+                fp2mul_test(h, g, h);
+            } else {
+                fp2copy_test(g, h);
+                started = 1;
+            }
+        }
+    }
+    if (!started) {                                        // x = 0: h = g*g^(-1) = 1
+        fp2_conj(g, h);
+        fp2mul_test(h, g, h);
+    }
+}
+
+
+static void generator_power(const torsion_t* T, const digit_t* x, f2elm_t h)
+{ // h = g^x, for the generator g of the subgroup of order ell^e (the first entry of T->table0)
+    f2elm_t g;
+
+    copy_words((const digit_t*)T->table0, (digit_t*)g, 2*NWORDS_FIELD);
+    power(g, x, T->nbits, h);
+}
+
+
+static void fp2_small(const unsigned int a, f2elm_t b)
+{ // b = a in Montgomery representation
+    f2elm_t t = {0};
+
+    t[0][0] = (digit_t)a;
+    to_fp2mont(t, b);
+}
+
+
+static void twodim_affine(digit_t* x, const point_t R, const point_t S, const f2elm_t A, const unsigned int nbits, point_t P)
+{ // P = R + [x]S in affine coordinates, for x of nbits bits
+    point_full_proj_t U;
+    f2elm_t A24;
+
+    fp2_small(2, A24);
+    fp2add_test(A, A24, A24);
+    fp2div2_test(A24, A24);
+    fp2div2_test(A24, A24);                                // A24 = (A+2)/4
+    mont_twodim_scalarmult(x, R, S, A, A24, U, nbits);
+    fp2inv_test(U->Z);
+    fp2mul_test(U->X, U->Z, P->x);
+    fp2mul_test(U->Y, U->Z, P->y);
+}
+
+
+int cryptotest_sqr()
+{ // Testing the variable-time square test in GF(p^2) against the exponentiation
+    f2elm_t a, b;
+    felm_t s;
+    unsigned int n;
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed; n++)
+    {
+        fp2random_test((digit_t*)a);
+        to_fp2mont(a, a);
+        fp2sqr_test(a, b);
+        if (is_sqr_fp2_vartime(a) != is_sqr_fp2(a, s) || is_sqr_fp2_vartime(b) != 1) {
+            passed = false;
+        }
+    }
+
+    printf("  Square tests in GF(p^2) ........................................................................ %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? PASSED : FAILED;
+}
+
+
+int cryptotest_dlog(const torsion_t* T)
+{ // Testing the discrete logarithms in the subgroup of order ell^e of GF(p^2)
+    digit_t x[NWORDS_ORDER], y[NWORDS_ORDER];
+    f2elm_t h;
+    unsigned int n, i;
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS + 3 && passed; n++)
+    {
+        if (n < 3) {                                       // x = 0, 1 and ell^e - 1
+            for (i = 0; i < NWORDS_ORDER; i++) {
+                x[i] = 0;
+                y[i] = 0;
+            }
+            x[0] = (n == 0) ? 0 : 1;
+            if (n == 2) {
+                copy_words(x, y, NWORDS_ORDER);
+                mp_sub(T->order, y, x, NWORDS_ORDER);
+            }
+        } else {
+            random_order(T, x);
+        }
+        generator_power(T, x, h);
+        if (dlog_pohlig_hellman(h, T, y) != 0 || compare_words(x, y, NWORDS_ORDER) != 0) {
+            passed = false;
+        }
+    }
+
+    printf("  Discrete logarithms modulo %u^%u tests ..................................................... %s\n", T->ell, T->e, passed ? "PASSED" : "FAILED");
+    return passed ? PASSED : FAILED;
+}
+
+
+int cryptorun_dlog(const torsion_t* T)
+{ // Benchmarking the discrete logarithms in the subgroup of order ell^e of GF(p^2)
+    digit_t x[NWORDS_ORDER], y[NWORDS_ORDER];
+    f2elm_t h;
+    unsigned int n;
+    unsigned long long cycles, cycles1, cycles2;
+
+    random_order(T, x);
+    generator_power(T, x, h);
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        dlog_pohlig_hellman(h, T, y);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Discrete logarithm modulo %u^%u runs in ........................ %10lld ", T->ell, T->e, cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    return PASSED;
+}
+
+
+int cryptotest_pairing(const torsion_t* T)
+{ // Testing the reduced Tate pairings on the basis {R1, R2} of E_6[ell^e] and on S1 = R1 + [x1]R2 and S2 = R2 + [x2]R1:
+  // t(R1, S1) = g^x1, t(R1, S2) = g, t(R2, S1) = g^-1 and t(R2, S2) = g^-x2, where g = t(R1, R2) has order ell^e
+    point_t R[2], S[2];
+    f2elm_t A, g, h, one, t[MAX_PAIRINGS];
+    digit_t x[2][NWORDS_ORDER];
+    unsigned int n;
+    bool passed = true;
+
+    fp2_small(6, A);
+    if (torsion_basis(A, T, R[0], R[1]) != 0) {
+        passed = false;
+    }
+    for (n = 0; n < TEST_LOOPS/10 && passed; n++)
+    {
+        random_order(T, x[0]);
+        random_order(T, x[1]);
+        twodim_affine(x[0], R[0], R[1], A, T->nbits, S[0]);
+        twodim_affine(x[1], R[1], R[0], A, T->nbits, S[1]);
+        if (tate_pairings(R, 1, R + 1, 1, A, T, &g) != 0 || tate_pairings(R, 2, S, 2, A, T, t) != 0) {
+            passed = false;
+            break;
+        }
+        fp2_small(1, one);
+        fp2copy_test(g, h);
+        exp_ell_Fp2_cycl(h, T->ell, T->e - 1, one[0]);
+        if (cmp_f2elm(h, one) == 0) {                      // g^(ell^(e-1)) = 1
+            passed = false;
+        }
+        power(g, x[0], T->nbits, h);
+        if (cmp_f2elm(t[0], h) != 0 || cmp_f2elm(t[1], g) != 0) {
+            passed = false;
+        }
+        fp2_conj(g, h);
+        if (cmp_f2elm(t[2], h) != 0) {
+            passed = false;
+        }
+        power(g, x[1], T->nbits, h);
+        fp2_conj(h, h);
+        if (cmp_f2elm(t[3], h) != 0) {
+            passed = false;
+        }
+    }
+
+    printf("  Tate pairings of order %u^%u tests ........................................................ %s\n", T->ell, T->e, passed ? "PASSED" : "FAILED");
+    return passed ? PASSED : FAILED;
+}
+
+
+int cryptorun_pairing(const torsion_t* T)
+{ // Benchmarking four reduced Tate pairings, one at a time and in one batch of two Miller loops
+    point_t R[2], S[2];
+    f2elm_t A, t[MAX_PAIRINGS];
+    digit_t x[2][NWORDS_ORDER];
+    unsigned int n, i, j;
+    unsigned long long cycles, cycles1, cycles2;
+
+    fp2_small(6, A);
+    torsion_basis(A, T, R[0], R[1]);
+    random_order(T, x[0]);
+    random_order(T, x[1]);
+    twodim_affine(x[0], R[0], R[1], A, T->nbits, S[0]);
+    twodim_affine(x[1], R[1], R[0], A, T->nbits, S[1]);
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/10; n++)
+    {
+        cycles1 = cpucycles();
+        for (i = 0; i < 2; i++) {
+            for (j = 0; j < 2; j++) {
+                tate_pairings(R + i, 1, S + j, 1, A, T, t + 2*i + j);
+            }
+        }
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  4 Tate pairings of order %u^%u, one at a time, run in ........ %10lld ", T->ell, T->e, cycles/(BENCH_LOOPS/10)); print_unit;
+    printf("\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/10; n++)
+    {
+        cycles1 = cpucycles();
+        tate_pairings(R, 2, S, 2, A, T, t);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  4 Tate pairings of order %u^%u, in one batch, run in ......... %10lld ", T->ell, T->e, cycles/(BENCH_LOOPS/10)); print_unit;
+    printf("\n");
+    return PASSED;
+}
+
+
+int cryptorun_basis(const torsion_t* T)
+{ // Benchmarking the torsion bases and the square tests of their candidates
+    point_t R[2];
+    f2elm_t A, a;
+    felm_t s;
+    unsigned int n;
+    unsigned long long cycles, cycles1, cycles2;
+
+    fp2_small(6, A);
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/10; n++)
+    {
+        cycles1 = cpucycles();
+        torsion_basis(A, T, R[0], R[1]);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Torsion basis of E[%u^%u] runs in ............................ %10lld ", T->ell, T->e, cycles/(BENCH_LOOPS/10)); print_unit;
+    printf("\n");
+
+    if (T->ell != torsion_A.ell) {
+        return PASSED;
+    }
+    fp2random_test((digit_t*)a);
+    to_fp2mont(a, a);
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        is_sqr_fp2(a, s);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Square test by exponentiation runs in ........................ %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        is_sqr_fp2_vartime(a);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Square test by Legendre symbol runs in ....................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    return PASSED;
+}
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING THE PUBLIC KEY COMPRESSION PRIMITIVES %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    Status |= cryptotest_sqr();
+    Status |= cryptotest_dlog(&torsion_A);
+    Status |= cryptotest_dlog(&torsion_B);
+    Status |= cryptotest_pairing(&torsion_A);
+    Status |= cryptotest_pairing(&torsion_B);
+
+    printf("\n\nBENCHMARKING THE PUBLIC KEY COMPRESSION PRIMITIVES %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    cryptorun_dlog(&torsion_A);
+    cryptorun_dlog(&torsion_B);
+    cryptorun_pairing(&torsion_A);
+    cryptorun_pairing(&torsion_B);
+    cryptorun_basis(&torsion_A);
+    cryptorun_basis(&torsion_B);
+
+    if (Status != PASSED) {
+        printf("\n\n   Error detected \n\n");
+        return FAILED;
+    }
+    return Status;
+}
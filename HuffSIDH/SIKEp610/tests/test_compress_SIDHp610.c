@@ -0,0 +1,25 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing and benchmarking the primitives of the public key compression of SIDHp610
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610_internal.h"
+#include "../internal.h"
+
+
+#define SCHEME_NAME        "SIDHp610"
+#define fp2copy_test       fp2copy610
+#define fp2sqr_test        fp2sqr610_mont
+#define fp2mul_test        fp2mul610_mont
+#define fp2add_test        fp2add610
+#define fp2div2_test       fp2div2_610
+#define fp2inv_test        fp2inv610_mont_bingcd
+#define fp2random_test     fp2random610_test
+
+
+
+#include "test_compress.c"
@@ -214,6 +214,522 @@ int cryptorun_kex_Huff()
 
 
 
+int cryptotest_kex_Huff_bounded()
+{ // Testing key exchange with working-set-bounded strategies against the default strategies
+    unsigned int i, j;
+    const unsigned int bounds[3] = { 4, 6, 8 };
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char PublicKeyAW[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyBW[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    bool passed = true;
+
+    printf("\n\nTESTING WORKING-SET-BOUNDED HUFF-ISOGENY-BASED KEY EXCHANGE SYSTEM %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS && passed == true; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+        EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+
+        for (j = 0; j < 3; j++) {
+            // The public keys do not depend on the strategy
+            EphemeralKeyGeneration_A_Huff_bounded(PrivateKeyA, PublicKeyAW, bounds[j]);
+            EphemeralKeyGeneration_B_Huff_bounded(PrivateKeyB, PublicKeyBW, bounds[j]);
+            EphemeralSecretAgreement_A_Huff_bounded(PrivateKeyA, PublicKeyB, SharedSecretA, bounds[j]);
+            EphemeralSecretAgreement_B_Huff(PrivateKeyB, PublicKeyAW, SharedSecretB);
+
+            if (memcmp(PublicKeyA, PublicKeyAW, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyBW, SIDH_PUBLICKEYBYTES) != 0 ||
+                memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0) {
+                passed = false;
+                break;
+            }
+        }
+    }
+    if (EphemeralKeyGeneration_A_Huff_bounded(PrivateKeyA, PublicKeyAW, 3) != 1) {   // Bound below the smallest strategy bound
+        passed = false;
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+static void print_bounded(const char* label, const unsigned long long cycles, const long long misses)
+{
+    printf("  %s runs in ", label);
+    printf("%.*s", (int)(53 - strlen(label)), "......................................................");
+    printf(" %10lld ", cycles); print_unit;
+    if (misses >= 0) printf(", %8lld L1d misses", misses);
+    printf("\n");
+}
+
+
+int cryptorun_kex_Huff_bounded()
+{ // Benchmarking key exchange with working-set-bounded strategies. The bound 0 stands for the build default (STRATEGY_MAX_POINTS)
+    unsigned int i, n;
+    const unsigned int bounds[4] = { 0, 8, 6, 4 };
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    unsigned long long cycles[4], cycles1;
+    long long misses[4], m;
+    const char* labels[4] = { "Alice's key generation", "Bob's key generation", "Alice's shared key computation", "Bob's shared key computation" };
+    int counter = cachemisses_open();
+
+    printf("\n\nBENCHMARKING WORKING-SET-BOUNDED KEY EXCHANGE SYSTEM on HUFF curve %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    if (counter < 0) printf("  (L1d miss counter not available)\n\n");
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+    EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+
+    for (i = 0; i < 4; i++)
+    {
+        for (n = 0; n < 4; n++) {
+            cycles[n] = 0;
+            misses[n] = 0;
+        }
+        for (n = 0; n < BENCH_LOOPS; n++)
+        {
+            cachemisses_start(counter);
+            cycles1 = cpucycles();
+            if (bounds[i] == 0) EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+            else EphemeralKeyGeneration_A_Huff_bounded(PrivateKeyA, PublicKeyA, bounds[i]);
+            cycles[0] += cpucycles() - cycles1;
+            m = cachemisses_stop(counter);
+            misses[0] += m;
+
+            cachemisses_start(counter);
+            cycles1 = cpucycles();
+            if (bounds[i] == 0) EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+            else EphemeralKeyGeneration_B_Huff_bounded(PrivateKeyB, PublicKeyB, bounds[i]);
+            cycles[1] += cpucycles() - cycles1;
+            m = cachemisses_stop(counter);
+            misses[1] += m;
+
+            cachemisses_start(counter);
+            cycles1 = cpucycles();
+            if (bounds[i] == 0) EphemeralSecretAgreement_A_Huff(PrivateKeyA, PublicKeyB, SharedSecretA);
+            else EphemeralSecretAgreement_A_Huff_bounded(PrivateKeyA, PublicKeyB, SharedSecretA, bounds[i]);
+            cycles[2] += cpucycles() - cycles1;
+            m = cachemisses_stop(counter);
+            misses[2] += m;
+
+            cachemisses_start(counter);
+            cycles1 = cpucycles();
+            if (bounds[i] == 0) EphemeralSecretAgreement_B_Huff(PrivateKeyB, PublicKeyA, SharedSecretB);
+            else EphemeralSecretAgreement_B_Huff_bounded(PrivateKeyB, PublicKeyA, SharedSecretB, bounds[i]);
+            cycles[3] += cpucycles() - cycles1;
+            m = cachemisses_stop(counter);
+            misses[3] += m;
+        }
+
+        if (bounds[i] == 0) printf("  Default strategies:\n");
+        else printf("  At most %u stored points:\n", bounds[i]);
+        for (n = 0; n < 4; n++) {
+            print_bounded(labels[n], cycles[n]/BENCH_LOOPS, (counter < 0) ? -1 : misses[n]/BENCH_LOOPS);
+        }
+        printf("\n");
+    }
+    cachemisses_close(counter);
+
+    return PASSED;
+}
+
+
+int cryptotest_kex_Huff_pk()
+{ // Testing the shared secret computations with public key handles against the ones with encoded public keys
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretAH[SIDH_BYTES];
+    unsigned char SharedSecretB[SIDH_BYTES], SharedSecretBH[SIDH_BYTES];
+    pk_handle_t HandleA, HandleB;
+    bool passed = true;
+
+    printf("\n\nTESTING HUFF-ISOGENY-BASED KEY EXCHANGE WITH PUBLIC KEY HANDLES %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+    pk_handle_init_B_Huff(&HandleB, PublicKeyB);
+
+    for (i = 0; i < TEST_LOOPS; i++)     // Same handle of Bob's public key in every iteration
+    {
+        random_mod_order_A(PrivateKeyA);
+        EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+        pk_handle_init_A_Huff(&HandleA, PublicKeyA);
+
+        EphemeralSecretAgreement_A_Huff(PrivateKeyA, PublicKeyB, SharedSecretA);
+        EphemeralSecretAgreement_A_Huff_pk(PrivateKeyA, &HandleB, SharedSecretAH);
+        EphemeralSecretAgreement_B_Huff(PrivateKeyB, PublicKeyA, SharedSecretB);
+        EphemeralSecretAgreement_B_Huff_pk(PrivateKeyB, &HandleA, SharedSecretBH);
+
+        if (memcmp(SharedSecretA, SharedSecretAH, SIDH_BYTES) != 0 || memcmp(SharedSecretB, SharedSecretBH, SIDH_BYTES) != 0 ||
+            memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        if (EphemeralSecretAgreement_A_Huff_pk(PrivateKeyA, &HandleA, SharedSecretAH) != 1 ||   // Handles of the wrong party
+            EphemeralSecretAgreement_B_Huff_pk(PrivateKeyB, &HandleB, SharedSecretBH) != 1) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kex_interop()
+{ // Testing the key exchange between the Huff functions and the Montgomery ones, with converted public keys
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char PublicKeyAH[SIDH_PUBLICKEYBYTES], PublicKeyBH[SIDH_PUBLICKEYBYTES], PublicKeyAM[SIDH_PUBLICKEYBYTES], PublicKeyBM[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES], SharedSecretAH[SIDH_BYTES], SharedSecretBH[SIDH_BYTES];
+    bool passed = true;
+
+    printf("\n\nTESTING KEY EXCHANGE BETWEEN HUFF AND MONTGOMERY CURVES %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++)
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);                                 // Montgomery public keys, converted to Huff ones
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyAH);                           // Huff public keys, converted to Montgomery ones
+        EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyBH);
+        if (PublicKeyMontgomeryToHuff(PublicKeyA, PublicKeyA) != 0 || PublicKeyMontgomeryToHuff(PublicKeyB, PublicKeyB) != 0 ||
+            PublicKeyHuffToMontgomery(PublicKeyAH, PublicKeyAM) != 0 || PublicKeyHuffToMontgomery(PublicKeyBH, PublicKeyBM) != 0) {
+            passed = false;
+            break;
+        }
+        EphemeralSecretAgreement_A_Huff(PrivateKeyA, PublicKeyB, SharedSecretAH);          // Huff shared secrets from Montgomery public keys
+        EphemeralSecretAgreement_B_Huff(PrivateKeyB, PublicKeyA, SharedSecretBH);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyBM, SharedSecretA);               // Montgomery shared secrets from Huff public keys
+        EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyAM, SharedSecretB);
+
+        if (memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0 || memcmp(SharedSecretA, SharedSecretAH, SIDH_BYTES) != 0 ||
+            memcmp(SharedSecretA, SharedSecretBH, SIDH_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kex_invalid()
+{ // Testing the rejection of invalid public keys by the shared secret computations
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char InvalidA[SIDH_PUBLICKEYBYTES], InvalidB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    pk_handle_t Handle;
+    bool passed = true;
+
+    printf("\n\nTESTING REJECTION OF INVALID PUBLIC KEYS %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+    EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+    if (pk_handle_init_A_Huff(&Handle, PublicKeyA) != 0 || pk_handle_init_B_Huff(&Handle, PublicKeyB) != 0) {
+        passed = false;
+    }
+
+    for (i = 0; i < 3 && passed == true; i++)
+    {
+        memcpy(InvalidA, PublicKeyA, SIDH_PUBLICKEYBYTES);
+        memcpy(InvalidB, PublicKeyB, SIDH_PUBLICKEYBYTES);
+        if (i == 0) {            // wP = 0, where get_A_Huff() would divide by 0
+            memset(InvalidA, 0, SIDH_PUBLICKEYBYTES/3);
+            memset(InvalidB, 0, SIDH_PUBLICKEYBYTES/3);
+        } else if (i == 1) {     // Real part of wQ encoded above p
+            memset(InvalidA + SIDH_PUBLICKEYBYTES/3, 0xFF, SIDH_PUBLICKEYBYTES/6);
+            memset(InvalidB + SIDH_PUBLICKEYBYTES/3, 0xFF, SIDH_PUBLICKEYBYTES/6);
+        } else {                 // wR = wP
+            memcpy(InvalidA + 2*(SIDH_PUBLICKEYBYTES/3), InvalidA, SIDH_PUBLICKEYBYTES/3);
+            memcpy(InvalidB + 2*(SIDH_PUBLICKEYBYTES/3), InvalidB, SIDH_PUBLICKEYBYTES/3);
+        }
+
+        if (EphemeralSecretAgreement_A_Huff(PrivateKeyA, InvalidB, SharedSecretA) != 1 ||
+            EphemeralSecretAgreement_B_Huff(PrivateKeyB, InvalidA, SharedSecretB) != 1 ||
+            pk_handle_init_A_Huff(&Handle, InvalidA) != 1 || EphemeralSecretAgreement_B_Huff_pk(PrivateKeyB, &Handle, SharedSecretB) != 1 ||
+            pk_handle_init_B_Huff(&Handle, InvalidB) != 1 || EphemeralSecretAgreement_A_Huff_pk(PrivateKeyA, &Handle, SharedSecretA) != 1 ||
+            EphemeralSecretAgreement_A(PrivateKeyA, InvalidB, SharedSecretA) != 1 ||
+            EphemeralSecretAgreement_B(PrivateKeyB, InvalidA, SharedSecretB) != 1 ||
+            EphemeralSecretAgreement_A_Edwards(PrivateKeyA, InvalidB, SharedSecretA) != 1 ||
+            EphemeralSecretAgreement_B_Edwards(PrivateKeyB, InvalidA, SharedSecretB) != 1) {
+            passed = false;
+        }
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+#ifdef COMPRESS
+int cryptotest_kex_Huff_compressed()
+{ // Testing key exchange with compressed public keys
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES_COMPRESSED], PublicKeyB[SIDH_PUBLICKEYBYTES_COMPRESSED];
+    unsigned char PublicKeyA_[SIDH_PUBLICKEYBYTES_COMPRESSED], PublicKeyB_[SIDH_PUBLICKEYBYTES_COMPRESSED];
+    unsigned char FullKeyA[SIDH_PUBLICKEYBYTES], FullKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES], SharedSecretA_[SIDH_BYTES];
+    bool passed = true;
+
+    printf("\n\nTESTING HUFF-ISOGENY-BASED KEY EXCHANGE WITH COMPRESSED PUBLIC KEYS %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A_Huff_compressed(PrivateKeyA, PublicKeyA);                            // Get some value as Alice's secret key and compute Alice's compressed public key
+        EphemeralKeyGeneration_B_Huff_compressed(PrivateKeyB, PublicKeyB);                            // Get some value as Bob's secret key and compute Bob's compressed public key
+        if (EphemeralSecretAgreement_A_Huff_compressed(PrivateKeyA, PublicKeyB, SharedSecretA) != 0 ||  // Alice computes her shared secret using Bob's public key
+            EphemeralSecretAgreement_B_Huff_compressed(PrivateKeyB, PublicKeyA, SharedSecretB) != 0) {  // Bob computes his shared secret using Alice's public key
+            passed = false;
+            break;
+        }
+        // The decompressed public keys give the same shared secrets, and compress back to the same bytes
+        if (PublicKeyDecompression_A_Huff(PublicKeyA, FullKeyA) != 0 || PublicKeyDecompression_B_Huff(PublicKeyB, FullKeyB) != 0 ||
+            PublicKeyCompression_A_Huff(FullKeyA, PublicKeyA_) != 0 || PublicKeyCompression_B_Huff(FullKeyB, PublicKeyB_) != 0) {
+            passed = false;
+            break;
+        }
+        EphemeralSecretAgreement_A_Huff(PrivateKeyA, FullKeyB, SharedSecretA_);
+
+        if (memcmp(SharedSecretA, SharedSecretB, SIDH_BYTES) != 0 || memcmp(SharedSecretA, SharedSecretA_, SIDH_BYTES) != 0 ||
+            memcmp(PublicKeyA, PublicKeyA_, SIDH_PUBLICKEYBYTES_COMPRESSED) != 0 || memcmp(PublicKeyB, PublicKeyB_, SIDH_PUBLICKEYBYTES_COMPRESSED) != 0) {
+            passed = false;
+            break;
+        }
+    }
+    PublicKeyB[SIDH_PUBLICKEYBYTES_COMPRESSED-1] = 2;                                                   // Invalid flag byte
+    if (passed == true && EphemeralSecretAgreement_A_Huff_compressed(PrivateKeyA, PublicKeyB, SharedSecretA) != 1) {
+        passed = false;
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kex_Huff_compressed()
+{ // Benchmarking the compression and decompression of public keys
+    unsigned int n;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char CompressedA[SIDH_PUBLICKEYBYTES_COMPRESSED], CompressedB[SIDH_PUBLICKEYBYTES_COMPRESSED];
+    unsigned long long cycles, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING PUBLIC KEY COMPRESSION on HUFF curve %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    random_mod_order_A(PrivateKeyA);
+    random_mod_order_B(PrivateKeyB);
+    EphemeralKeyGeneration_A_Huff(PrivateKeyA, PublicKeyA);
+    EphemeralKeyGeneration_B_Huff(PrivateKeyB, PublicKeyB);
+
+    // Benchmarking the compression of Alice's public key
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        PublicKeyCompression_A_Huff(PublicKeyA, CompressedA);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Compression of Alice's public key runs in .................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking the decompression of Alice's public key
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        PublicKeyDecompression_A_Huff(CompressedA, PublicKeyA);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Decompression of Alice's public key runs in .................. %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking the compression of Bob's public key
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        PublicKeyCompression_B_Huff(PublicKeyB, CompressedB);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Compression of Bob's public key runs in ...................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking the decompression of Bob's public key
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        PublicKeyDecompression_B_Huff(CompressedB, PublicKeyB);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Decompression of Bob's public key runs in .................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+#endif
+
+
+int cryptotest_kex_Edwards()
+{ // Testing key exchange with twisted Edwards isogenies against the Montgomery one
+    unsigned int i;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char PublicKeyA_E[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB_E[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    unsigned char SharedSecretA_E[SIDH_BYTES], SharedSecretB_E[SIDH_BYTES];
+    bool passed = true;
+
+    printf("\n\nTESTING EPHEMERAL TWISTED-EDWARDS-ISOGENY-BASED KEY EXCHANGE SYSTEM %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        EphemeralKeyGeneration_A_Edwards(PrivateKeyA, PublicKeyA_E);                     // Both models produce the same public keys
+        EphemeralKeyGeneration_B_Edwards(PrivateKeyB, PublicKeyB_E);
+        if (memcmp(PublicKeyA, PublicKeyA_E, SIDH_PUBLICKEYBYTES) != 0 || memcmp(PublicKeyB, PublicKeyB_E, SIDH_PUBLICKEYBYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        EphemeralSecretAgreement_A_Edwards(PrivateKeyA, PublicKeyB, SharedSecretA_E);    // Edwards Alice against Montgomery Bob
+        EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA_E, SharedSecretB);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB_E, SharedSecretA);            // Montgomery Alice against Edwards Bob
+        EphemeralSecretAgreement_B_Edwards(PrivateKeyB, PublicKeyA, SharedSecretB_E);
+        
+        if (memcmp(SharedSecretA_E, SharedSecretB, SIDH_BYTES) != 0 || memcmp(SharedSecretA, SharedSecretB_E, SIDH_BYTES) != 0 ||
+            memcmp(SharedSecretA, SharedSecretA_E, SIDH_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Key exchange tests ........................................... PASSED");
+    else { printf("  Key exchange tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+
+int cryptorun_kex_Edwards()
+{ // Benchmarking key exchange
+    unsigned int n;
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES], PrivateKeyB[SIDH_SECRETKEYBYTES];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES], PublicKeyB[SIDH_PUBLICKEYBYTES];
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    unsigned long long cycles, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING EPHEMERAL ISOGENY-BASED KEY EXCHANGE SYSTEM on TWISTED EDWARDS curve %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    // Benchmarking Alice's key generation
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        EphemeralKeyGeneration_A_Edwards(PrivateKeyA, PublicKeyA);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Alice's key generation runs in ............................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking Bob's key generation
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        EphemeralKeyGeneration_B_Edwards(PrivateKeyB, PublicKeyB);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Bob's key generation runs in ................................. %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking Alice's shared key computation
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        EphemeralSecretAgreement_A_Edwards(PrivateKeyA, PublicKeyB, SharedSecretA); 
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Alice's shared key computation runs in ....................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking Bob's shared key computation
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        EphemeralSecretAgreement_B_Edwards(PrivateKeyB, PublicKeyA, SharedSecretB);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Bob's shared key computation runs in ......................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+
+
 int main()
 {
     int Status = PASSED;
@@ -227,12 +743,50 @@ int main()
   
 
 
+    Status = cryptotest_kex_Huff_bounded();     // Test key exchange with working-set-bounded strategies
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptotest_kex_Huff_pk();          // Test key exchange with public key handles
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptotest_kex_interop();          // Test key exchange between Huff and Montgomery curves
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptotest_kex_invalid();          // Test rejection of invalid public keys
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+#ifdef COMPRESS
+    Status = cryptotest_kex_Huff_compressed();  // Test key exchange with compressed public keys
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+
     Status = cryptotest_kex();             // Test key exchange
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
 
+    Status = cryptotest_kex_Edwards();     // Test key exchange with twisted Edwards isogenies
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
  
     Status = cryptorun_kex();              // Benchmark key exchange
     if (Status != PASSED) {
@@ -246,5 +800,26 @@ int main()
         return FAILED;
     }
 
+    Status = cryptorun_kex_Edwards();           // Benchmark key exchange with twisted Edwards isogenies
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    Status = cryptorun_kex_Huff_bounded();      // Benchmark key exchange with working-set-bounded strategies
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+#ifdef COMPRESS
+
+    Status = cryptorun_kex_Huff_compressed();   // Benchmark public key compression
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+
     return Status;
 }
\ No newline at end of file
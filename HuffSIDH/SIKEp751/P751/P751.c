@@ -33,10 +33,111 @@ const uint64_t p751x16p[2*NWORDS64_FIELD]        = { 0x0000000000000010, 0x00000
                                                      0x826D2F56C0F0EAE2, 0xAD4C9CBD81067123, 0xF62CF3052282F124, 0x53A95F7469B516FE, 0x3DADEC0D08A4732F, 0x58AD934557C11C7E, 
                                                      0x7F731B89B2DA43F2, 0x51AE9F5F5F6AFF3B, 0xD74319A6C9BCA375, 0x5BAB790796CF84D4, 0xA421554FE2E49CA8, 0x20AD617C8DF437CF, 
                                                      0x3AB06E7A12F5FF7B, 0x70A25E037E40347E, 0x51F1D323FB4C1151, 0xAE0D99AA4835FED9, 0xDF5429960D2536B6, 0x000000030E91D466 };
-// Order of Alice's subgroup
+// Order of Alice's subgroup, 2^372
 const uint64_t Alice_order[NWORDS64_ORDER]       = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010000000000000 }; 
-// Order of Bob's subgroup
+// Order of Bob's subgroup, 3^239
 const uint64_t Bob_order[NWORDS64_ORDER]         = { 0xC968549F878A8EEB, 0x59B1A13F7CC76E3E, 0xE9867D6EBE876DA9, 0x2B5045CB25748084, 0x2909F97BADC66856, 0x06FE5D541F71C0E1 };
+#ifdef COMPRESS
+// Montgomery constants for the arithmetic modulo Bob's order: rprime = -order^(-1) mod 2^384 and Rprime = (2^384)^2 mod order
+const uint64_t Montgomery_rprime_B[NWORDS64_ORDER] = { 0x48062A91D3AB563D, 0x6CE572751303C2F5, 0x5D1319F3F160EC9D, 0xE35554E8C2D5623A, 0xCA29300232BC79A5, 0x8AAD843D646D78C5 };
+const uint64_t Montgomery_Rprime_B[NWORDS64_ORDER] = { 0x1A55482318541298, 0x070A6370DFA12A03, 0xCB1658E0E3823A40, 0xB3B7384EB5DEF3F9, 0xCBCA952F7006EA33, 0x00569EF8EC94864C };
+// Elligator 2 candidates v = 1/(1 + u*r^2) for r = 1, ..., TABLE_R_LEN and the non-square u = 4 + i, in Montgomery representation
+const uint64_t basis_table[TABLE_R_LEN][2*NWORDS64_FIELD] = {
+                                                   { 0xD89D89D89D8A493E, 0x9D89D89D89D89D89, 0x89D89D89D89D89D8, 0xD89D89D89D89D89D, 0x9D89D89D89D89D89,
+                                                     0x8B389D89D89D89D8, 0xB4C6B9529F01D8C3, 0x1399AE2626262260, 0xDE85321D9D8185DF, 0x8451DC3FDF91784A,
+                                                     0xFAEFD5E487381389, 0x00006319EE6373CB, 0x3B13B13B13B1248D, 0x13B13B13B13B13B1, 0xB13B13B13B13B13B,
+                                                     0x3B13B13B13B13B13, 0x13B13B13B13B13B1, 0x7A4B13B13B13B13B, 0xA30792A3BBCAECC7, 0x8E3262972F905537,
+                                                     0x6EC1E1420B7BAD51, 0x3369C4F4190692FF, 0x9D6D588BD01A282C, 0x0000028F2E2C80A9 },   // r = 1
+                                                   { 0x673D45AA630B09FB, 0x5673D45AA630AE95, 0x95673D45AA630AE9, 0xE95673D45AA630AE, 0xAE95673D45AA630A,
+                                                     0xD4595673D45AA630, 0x06D7B45385F91ACC, 0x7FDE0F3B044702EF, 0xF1BFC4766FC2E18A, 0xD67138B8790E3167,
+                                                     0x9EF75C6F0552A406, 0x00002C5A25459904, 0xF6C4681424EE5801, 0xAF6C4681424EE5FA, 0xFAF6C4681424EE5F,
+                                                     0x5FAF6C4681424EE5, 0xE5FAF6C4681424EE, 0x7FAFAF6C4681424E, 0x71E7F021FC96E1CF, 0xBD317223E4665091,
+                                                     0x04D1B06EED834E4E, 0xF423F47B02EEF4B8, 0x0A418B4D55C23C88, 0x0000094F95559E31 },   // r = 2
+                                                   { 0xBC8EA75EFC1DB814, 0xDC562840F895B742, 0xEA75EFC1DA922F50, 0x62840F895B742BC8, 0x5EFC1DA922F50DC5,
+                                                     0x1B3895B742BC8EA7, 0x0EF4E35288013377, 0x7034C1EDC7954F9D, 0x404E07FFDCD9C4B4, 0x6C0D3C3112E9FC8B,
+                                                     0xE93593735AD57C40, 0x00005E74FB7D527D, 0x5C835ABF61CF41ED, 0xDF2950278C2E9C12, 0x35ABF61CF458FB68,
+                                                     0x950278C2E9C125C8, 0xBF61CF458FB68DF2, 0x7E9C2E9C125C835A, 0xCA8064284EDAE000, 0xB011CE81CE7860C5,
+                                                     0xF2D3F4033A9B8AE2, 0x2FF7880A1DE06DD0, 0x7182DD9DC3FCB499, 0x00000A4A77D973AB },   // r = 3
+                                                   { 0x8AE21EF6EA938B09, 0x37966C6ED5186501, 0x69DCB18F74253FB3, 0x3188241B31A56443, 0x09156C7D752C811D,
+                                                     0x9CFAE79AFE751DE1, 0x8BF44341193A82F9, 0x34DAFBE7EE16D274, 0x0272F0852BA272D8, 0xA0F247E8810D0FE5,
+                                                     0x48E124BE4CC4D188, 0x00004FDE2C9A5389, 0x44369DCB18F7403C, 0x11D3188241B31A56, 0xDE109156C7D752C8,
+                                                     0x993912AE79AFE751, 0x34E708BDAC04CC86, 0x8C7E4CE5A9BBC962, 0xF269836E4C98DDD3, 0x045188E7965A38A0,
+                                                     0xDAB83EB832EB62A0, 0xCCEFE1931E93559A, 0x775966B73B29F6D5, 0x000045DBC312B900 },   // r = 4
+                                                   { 0x0B71EE1F7F5C9327, 0x8A5569830CE94076, 0x12961C17A5932157, 0xDD79C7E8EBB6086B, 0x2BEF8AB644F43951,
+                                                     0x37277CB68D98CE33, 0xDE633F0A815B7506, 0x61740E19C3F2EFA4, 0x61B1E49FB5E4EABE, 0xA015247782FF386E,
+                                                     0xE25E2C7B9F068D08, 0x00005A5611C2C7A3, 0xD213F53791E68D00, 0x2EDE2F635D1EFA2E, 0xDA72EC5F8871204D,
+                                                     0xDAEBFEACFFF3E491, 0x5F948C8E72BBF1CF, 0x4A440214B6EE743F, 0xD224FC96C70931D9, 0xEA00C3F488138831,
+                                                     0x9D46231784C01FDC, 0xB12AA781AEC3B474, 0xE312A59BD123CE5A, 0x00001FED35710EB4 },   // r = 5
+                                                   { 0x72F7284A69378371, 0x03D4A5A89547E058, 0xB12975E3DAE2E152, 0x599E71CBADA705F9, 0x4ACD0B0B6F42CE9A,
+                                                     0xE5285A0245577966, 0x6C038D909BB02FA1, 0x124374A6F770AF89, 0x99103DFE37CA79AF, 0x147E8A248FDBCAAE,
+                                                     0xEB9B0A578010CFB9, 0x000037F0B3678B6F, 0x5D470CF2D274DD99, 0xC8516258CB0C2B2B, 0xB43C53B94E11D2A6,
+                                                     0x5ABE2DE626199F2D, 0x029D6C7C473EDC98, 0xE0376A892583E1DC, 0xC0CAA571F277C6A0, 0xD4F6AD7F88406328,
+                                                     0xC9A2779B2F2431FD, 0xD7757D28491C9C9C, 0x3710D688A0ED993D, 0x00004ADB9FE768DE },   // r = 6
+                                                   { 0x81F1C30C09FD33FC, 0xDBF51DCE3A9149C9, 0xE9CF78A0524C35B8, 0xC02099DC646FDE01, 0xB0594156B5517D78,
+                                                     0xCDF2CD6BD4510E26, 0xA62E43C6D4ABA685, 0x06282F81A9AB8658, 0xD6D76B986C3AFC2D, 0x82003479185AC489,
+                                                     0x68A227ED5A5D8D62, 0x00004CB44C725522, 0x248D49A3572E2D8B, 0xD7958CBA82F9C02A, 0x8CAA9BD2ECD45A98,
+                                                     0xD568F26B9E3F23BE, 0x6C2D5F812C90C433, 0xF1565E72D2FCBB81, 0x27E816D21960503D, 0xC557356BF112F986,
+                                                     0x4C0F35DCE29E0B8B, 0xB5D66BBE22866AEA, 0xA93F73DFFDAB2E0A, 0x0000615CF5C957D3 },   // r = 7
+                                                   { 0x516EE2A1BE021E2A, 0xF602D6E151658AD7, 0x26B24FB3189298B0, 0x0D965FAF4CE85C95, 0xEFEF3DB9B3A4B775,
+                                                     0xD851DD3FA8E08D31, 0x2DA32E186C78CE68, 0x143617DD482EE422, 0x667237E94436FC75, 0x1AC3465D96DCFDBB,
+                                                     0x56D74ABF63E8D5D3, 0x00005D7C60C0D2E4, 0xA30146117F0077FD, 0x9BE366E0CADBC188, 0xEF64080B2EACAD26,
+                                                     0x0A8FD83BF0D513C6, 0x877CB3DDB56170B2, 0xB35C3C73A225B6FC, 0xBF79CBB465569B88, 0x498384E224080C8B,
+                                                     0xB2F0B94988649443, 0xB3DCD435A017EB4F, 0xE9941938991157FB, 0x000021C1C22E5E5B },   // r = 8
+                                                   { 0x0D40E007BD838CEA, 0xA6EFBD2F6C46FEC8, 0xDC1072B787D7CD36, 0x7204C616DD691C29, 0xF3C600AA941422BD,
+                                                     0xB810967F5BD8F3A2, 0x53CCFBAE4D3DD147, 0xCC071945DE01CFF7, 0x6DD53CCD52E214A3, 0xB2C2FB56192E2E38,
+                                                     0xD2B99B61C093CFD5, 0x000051BE0034F0EA, 0x8107763EA961F872, 0x74B86F2CE50392D0, 0xDB4527F030D9F82D,
+                                                     0xEC3F66A797FB122F, 0xF4DE67CF2F609807, 0xEFC422F586A5B1F2, 0xB765C11D7152D2E1, 0xB0A5BFC4FD2AC62B,
+                                                     0x589DF808D4BB351A, 0x1165BA9E7035FA93, 0xE9B487C366AEC785, 0x0000586D2918F33C },   // r = 9
+                                                   { 0x6E3302C6FE0C0C01, 0xDFAC66DC6CEDA28C, 0xDED64C5EF280083F, 0x8B39B4C197F785CD, 0x11B93A8C64FD9206,
+                                                     0x9AC84CC06813FCFF, 0xCF85682DC9D9B864, 0xC23496D96970C301, 0x5194BE86F6E26D90, 0x4DB579722DE163E0,
+                                                     0x66DAEB4660E533AE, 0x000015B525F2A541, 0x7C758374FFD93EC3, 0x2C7354CAF23E0942, 0xBD93A801DBC916D7,
+                                                     0x47E4D764786D5DAC, 0x0712497FC82C0471, 0x87311F4B3AF3FE32, 0xEFAEC8155C91650E, 0xE2169C5AD02053FE,
+                                                     0xC96489E29375ADEB, 0x5E7D1381050F03CE, 0xB88C1A56DDD05F31, 0x000006070D9E2F41 },   // r = 10
+                                                   { 0x9ED7073D4D892D5E, 0x7A8ACF5D59CC31D7, 0x149DB0BEB6B3A2E1, 0xC059D51CC46D3357, 0xEE43544B33B041DD,
+                                                     0x5CC5EB8BC024538F, 0x4B759EA5B9EAB631, 0xA335C8BC0AEEAFBC, 0xB03F67E326524765, 0x2C790108FA72A4B0,
+                                                     0x789B5DA805C4192F, 0x000064DEC5C9AB82, 0x36DAB776C6A6E1AD, 0x70788D740F12BB16, 0x0678109B1BC9AEB8,
+                                                     0x6CC747669CD9ABEF, 0xCBF25E90DDFDB9BA, 0x9186ABE61B8B423E, 0x29E06834AA38279D, 0x45176543D221EEC1,
+                                                     0x761F084D3249B19E, 0xB968904364D0E464, 0x5DB85DA70B052289, 0x0000521E2DDB50A5 },   // r = 11
+                                                   { 0x395783F790D29774, 0x112CEC9A5FB0FD8E, 0x2286B13D7C636B50, 0x3BB1C1FAABC848AE, 0xCEBD9A801EAB03DC,
+                                                     0xD0D0F3042DC47BD3, 0xBA7CC91C76FBFC6F, 0x7E4B81D9BC252CC4, 0x791DA3C97B45B52E, 0x76E4B2A8663A7CDB,
+                                                     0xB18F9D7CDF16DE77, 0x00006738B89E9A90, 0xC5C400C8DEF67ACF, 0x7DB5C96374C369C2, 0x4DE65F1497C0251B,
+                                                     0x3D6A0B0AA5A7DC1D, 0xCFF42CDA41FF0694, 0x13585BF9A20DF747, 0x29F5EA2387657EA2, 0x85F982D144BC9D02,
+                                                     0x70BA26172B51F920, 0x7CDC5B7AD3069E68, 0xDA452B30229CE4DE, 0x00005308C36EA06B },   // r = 12
+                                                   { 0xAC4F402D28A1B7D9, 0x1F9692D5D204DA19, 0x7B09C49F36556C65, 0x74E03DD0CC93BAA4, 0x2857AF2E2C697F78,
+                                                     0xB5B97969D9A74314, 0x9B0B4C1B8B9C5804, 0x012FE23955636F0E, 0xB8E8FEC4456834F9, 0xF6E7C5B893C1F2AC,
+                                                     0x05A45A12C0CF9B64, 0x00004242B7D98CD1, 0x895BC47E5E99FE58, 0x00CFD306BF78ED7A, 0x43394EBA61FCD38C,
+                                                     0x83E94C74E7C77585, 0x9E944616E2627346, 0x9BA6856CF3432676, 0x2185C6AFF5533077, 0x67F7CB233436A703,
+                                                     0x52D795D168AD54FF, 0xBB7BF59763DC0670, 0x79561A9B5335EFFB, 0x00006F8E14E2EA1D },   // r = 13
+                                                   { 0x52170E4682673A4B, 0x0AD4577028668C00, 0x105830C4E5B35043, 0x0E44B518DCE2097C, 0x1DC57628AFA086C9,
+                                                     0x7017D10868A9652D, 0xF52DAC7D308B4DED, 0xE5F8D6B44798B8A4, 0x860E5513916A8B0B, 0x0EF1A2AE69403037,
+                                                     0xFD7E1676F8DB8D34, 0x00001DA40260AF34, 0x438DF92CAED981E9, 0xE0EC927187AF9BD2, 0x02C47A2EB752165A,
+                                                     0x10A814019E74674B, 0x0AD43DCF5C2393FE, 0x9EF40A6C20918C14, 0x827A35EE6A2A622C, 0xC5367CAADECCABBA,
+                                                     0xDEC9E5F60CC017A0, 0x89393E2776CC5F44, 0x7AD261CF40C946E0, 0x000069EC298FC2C5 },   // r = 14
+                                                   { 0xE370D28A643127FE, 0x6484E527E4F15551, 0x3F59642BD5A34627, 0x85A03E71ECC4BDC1, 0x7B2E731CBACBC6B9,
+                                                     0x70F5FDBD8FDA90B6, 0x24E12F3C9683795B, 0x35FAA7C6879A3C7C, 0xFF53C1E88A24C6E7, 0xE5DD61BDDC562FD5,
+                                                     0xE68B1C39660B3261, 0x00006259E2A86D74, 0x2982F0136CCDEF7A, 0x8848824CB25EDE31, 0x7BF8BC5D9CE7B4CD,
+                                                     0x5A3A0205A555D497, 0x9240434A161CAB24, 0xFDB3CBB75FE9869F, 0xC97131D9A60D18C9, 0x9DB915412B8CB0B8,
+                                                     0x5B7E4834AD58F24F, 0xDF6E9178CA871824, 0xF1259454624AC092, 0x00001327C8999EB4 },   // r = 15
+                                                   { 0x666280546751F204, 0x3124828432952042, 0x628126D710FA6B0A, 0x1D3B96F1B28EB258, 0xA3E698E6B79C0621,
+                                                     0x5CFD4588D9A09890, 0x43A7B8C256D49EBA, 0xE2F94301C0032B74, 0x8953956AC6CA7C77, 0x7F8015DC765F106C,
+                                                     0x82E4DDDD36ED8083, 0x0000133AE4EA2F71, 0xDBF063D1F1AF17B9, 0xCEC32E934E871629, 0xE2671C831AFAA693,
+                                                     0x960B975DBBED5813, 0x203E4A33C527B48A, 0x423CD368EF5C02DB, 0x361633B23B9CEB74, 0x5F11CA4E0B5ECBDD,
+                                                     0xAD9328EC4662A397, 0xEA2509539AEEDDBA, 0x15BB2346F14D8146, 0x000002F2B9A05EEE },   // r = 16
+                                                   { 0x795D912BDEF015D7, 0x65E6C0F35599987E, 0x8BE785422F397093, 0xCD93F70F07BAA7DB, 0xF1A8945586B3C277,
+                                                     0x26353E447C9BF58B, 0x4CD879A487B985CA, 0x9E680A1F08FF3F3F, 0xEA67CD5F51356E12, 0x501DDEE09936B7D1,
+                                                     0x559A868F99683C3A, 0x000023FA0B67D681, 0xEDDAB05F06B5A605, 0xC6E7FE44E0E20ACE, 0xDA2D7FCAF5C0C0EB,
+                                                     0x7507BC508BE5F429, 0x7516F14BC559D8F0, 0x55DB0692A07CC717, 0x12F7611288A3B08B, 0x34ED3DD86C14B639,
+                                                     0x2BCFE7EA6234CAAA, 0xA20E37F49CD7B313, 0xED785E90CA869C5F, 0x0000524FB4A9B68D }   // r = 17
+                                                   };
+// Tables of the Pohlig-Hellman discrete logarithms, generated by dloggen.py
+#include "P751_dlog_tables.h"
+// Torsion subgroups E[2^372], carried by Bob's public keys, and E[3^239], carried by Alice's public keys
+// 2^372 has OALICE_BITS+1 bits, and the arithmetic modulo 2^372 needs no Montgomery constants (see mul_mod_order())
+const torsion_t torsion_A = { 2, EXPON_2, OALICE_BITS + 1, ORDER_A_ENCODED_BYTES, (const digit_t*)Alice_order, NULL, NULL,
+                              W_2, DLEN_2, ELL2_W, ELL2_EMODW, (const uint64_t*)ph2_table, (const uint64_t*)ph2_table0, ph2_path };
+const torsion_t torsion_B = { 3, EXPON_3, OBOB_BITS, ORDER_B_ENCODED_BYTES, (const digit_t*)Bob_order, (const digit_t*)Montgomery_rprime_B, (const digit_t*)Montgomery_Rprime_B,
+                              W_3, DLEN_3, ELL3_W, ELL3_EMODW, (const uint64_t*)ph3_table, (const uint64_t*)ph3_table0, ph3_path };
+#endif
 // Alice's generator values {XPA0 + XPA1*i, XQA0 + xQA1*i, XRA0 + XRA1*i} in GF(p751^2), expressed in Montgomery representation
 const uint64_t A_gen[6 * NWORDS64_FIELD]         = { 0x884F46B74000BAA8, 0xBA52630F939DEC20, 0xC16FB97BA714A04D, 0x082536745B1AB3DB, 0x1117157F446F9E82, 0xD2F27D621A018490,
                                                      0x6B24AB523D544BCD, 0x9307D6AA2EA85C94, 0xE1A096729528F20F, 0x896446F868F3255C, 0x2401D996B1BFF8A5, 0x00000EF8786A5C0A,   // XPA0
@@ -102,6 +203,10 @@ const uint64_t B_gen_Huff[6 * NWORDS64_FIELD]    = { 0x2b2d3fedbf1b4d99, 0x1f251
                                                      0xfe35e8eb3689477b, 0xdeba505ca0bdedec, 0x0ef6e111b98ac83a, 0x3608488a33aa31ea, 0x2335bd9ee1fa7851, 0x00000e97149c6337,   // XRB0
                                                      0x467e98aaaf0da207, 0xaa9f9fcb39f10f78, 0x4a073a14848e2a54, 0xa28c9a7ee8fb7d49, 0x5bc91d9683f524cf, 0x3dbf950cba1b7788,
                                                      0x9db4c268b16820a3, 0xd9256fb51d886c83, 0xab76763c6e4bc390, 0xce072d82215dd71f, 0xcc551fb7476543e0, 0x0000139099eecc84 }; // XRB1
+#ifdef FIXED_BASE
+// Fixed-base tables of the Huff key generation, generated by fixedgen.py from A_gen_Huff and B_gen_Huff
+#include "P751_fixed_base_tables.h"
+#endif
 
 
 
@@ -134,6 +239,167 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
+// Strategies for the Huff isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Huff[MAX_Alice-1] = { 
+74, 48, 28, 16, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2,
+1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1,
+1, 1, 20, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 28, 18, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 7, 4, 3, 2, 1, 1,
+1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Alice_par_Huff[MAX_Alice-1] = { 
+62, 46, 32, 20, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3,
+2, 1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 14, 12, 8, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1,
+1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 22, 14,
+9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1,
+1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2,
+1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_Huff[MAX_Bob-1] = { 
+89, 55, 34, 22, 14, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 21, 13, 8, 5, 3, 2, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1,
+2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+1, 1, 1, 34, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 13, 8, 5, 3, 2,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1,
+1, 1, 1, 2, 1, 1, 1 };
+
+const unsigned int strat_Bob_par_Huff[MAX_Bob-1] = { 
+68, 55, 40, 27, 18, 12, 8, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2,
+1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1,
+4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 15, 13, 9, 6, 4, 3, 2, 1, 1,
+1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3,
+2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 20, 14, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 4, 3, 2, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 1 };
+
+// Strategies for the twisted Edwards isogeny trees (regenerated with "make strategies")
+const unsigned int strat_Alice_Edwards[MAX_Alice-1] = { 
+80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4,
+2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4,
+2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1,
+1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 32, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4,
+2, 1, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1,
+2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_Edwards[MAX_Bob-1] = { 
+89, 55, 34, 22, 14, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 21, 13, 8, 5, 3, 2, 1, 1, 1,
+1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1,
+2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+1, 1, 1, 34, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2,
+1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 13, 8, 5, 3, 2,
+1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1,
+1, 1, 1, 2, 1, 1, 1 };
+
+// Working-set-bounded strategies for the Huff trees, storing at most strat_bounds[i] points and listed in traversal order
+const unsigned int strat_bounds[STRAT_NBOUNDS] = { 4, 6, 8 };
+
+const unsigned int strat_Alice_ws4_Huff[MAX_Alice-1] = { 
+101, 57, 21, 6, 5, 4, 3, 2, 1, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6,
+3, 2, 1, 3, 2, 1, 1, 1, 36, 15, 5, 4, 3, 2, 1, 10, 4, 3, 2, 1, 6,
+3, 2, 1, 3, 2, 1, 1, 1, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1,
+1, 1, 11, 6, 3, 2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1,
+1, 57, 26, 12, 5, 4, 3, 2, 1, 7, 4, 3, 2, 1, 4, 2, 1, 2, 1, 1, 15,
+7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1,
+2, 1, 1, 31, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1,
+1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2,
+1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Alice_ws6_Huff[MAX_Alice-1] = { 
+85, 47, 28, 15, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 8, 4, 2, 1, 2, 1, 1,
+4, 2, 1, 1, 2, 1, 1, 13, 8, 4, 2, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1,
+1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 2, 1,
+1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 38, 21, 12, 7,
+4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1,
+1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Alice_ws8_Huff[MAX_Alice-1] = { 
+80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4,
+2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1,
+3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4,
+2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1,
+1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1,
+1, 32, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4,
+2, 1, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1,
+2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws4_Huff[MAX_Bob-1] = { 
+147, 63, 22, 6, 5, 4, 3, 2, 1, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1, 7,
+3, 2, 1, 4, 2, 1, 2, 1, 1, 41, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1,
+7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4,
+2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2,
+1, 1, 3, 2, 1, 1, 1, 1, 84, 41, 16, 5, 4, 3, 2, 1, 11, 4, 3, 2, 1,
+7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4,
+2, 1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2,
+1, 1, 3, 2, 1, 1, 1, 1, 43, 25, 11, 4, 3, 2, 1, 7, 3, 2, 1, 4, 2,
+1, 2, 1, 1, 14, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 7, 4, 2, 1, 2, 1,
+1, 3, 2, 1, 1, 1, 1, 20, 12, 7, 3, 2, 1, 4, 2, 1, 2, 1, 1, 5, 4,
+2, 1, 2, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 4,
+2, 1, 1, 1, 2, 1, 1 };
+
+const unsigned int strat_Bob_ws6_Huff[MAX_Bob-1] = { 
+104, 59, 40, 21, 10, 4, 3, 2, 1, 6, 3, 2, 1, 3, 2, 1, 1, 1, 11, 6, 3,
+2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 19, 11, 6, 3,
+2, 1, 3, 2, 1, 1, 1, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2,
+1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 27, 15, 8, 5, 3, 2, 1,
+2, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2,
+1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 47, 27, 15, 8, 4, 2, 1, 2, 1, 1, 4, 2,
+1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7,
+4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2,
+1, 1, 1, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3,
+2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+3, 2, 1, 1, 1, 1, 1 };
+
+const unsigned int strat_Bob_ws8_Huff[MAX_Bob-1] = { 
+93, 62, 37, 21, 12, 7, 4, 2, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2,
+1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4,
+2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4,
+2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1,
+1, 25, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2,
+1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 9, 7, 4, 2,
+1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 38,
+22, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 1,
+2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 1,
+1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1,
+1, 3, 2, 1, 1, 1, 1 };
+
+// Measured costs of the kernels of the Huff trees in the Huff and Montgomery models (columns MODEL_HUFF, MODEL_MONT),
+// the hybrid traversals (HYBRID_MODELS) run each kernel in the cheaper model
+const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { 
+{ 77855, 78386 }, { 49980, 53473 }, { 72433, 74962 }, { 40045, 39053 } };
+
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy751
 #define fpzero                        fpzero751
@@ -169,5 +435,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 
 #include "../fpx.c"
 #include "../ec_isogeny.c"
+#ifdef COMPRESS
+#include "../pairing.c"
+#include "../dlog.c"
+#include "../torsion_basis.c"
+#endif
+#include "../parallel.c"
+#include "../traverse.c"
 #include "../sidh.c"
 #include "../sike.c"
\ No newline at end of file
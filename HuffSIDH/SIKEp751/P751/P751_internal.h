@@ -44,53 +44,44 @@
 #define MAX_INT_POINTS_BOB      10 
 #define MAX_Alice               186
 #define MAX_Bob                 239
+#define STRAT_NBOUNDS           3       // Number of working-set-bounded Huff strategies per tree, see strat_bounds
+#define STRATEGY_PREORDER                   // Strategies list the multiplication steps in traversal order
 #define MSG_BYTES               32
 #define SECRETKEY_A_BYTES       ((OALICE_BITS + 7) / 8)
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
 
 #ifdef COMPRESS
-    #define MASK2_BOB               0x00  
-    #define MASK3_BOB               0xFF
-    #define ORDER_A_ENCODED_BYTES   SECRETKEY_A_BYTES
-    #define ORDER_B_ENCODED_BYTES   SECRETKEY_B_BYTES
-    #define PARTIALLY_COMPRESSED_CHUNK_CT     (4*ORDER_A_ENCODED_BYTES + FP2_ENCODED_BYTES + 2)
-    #define COMPRESSED_CHUNK_CT     (3*ORDER_A_ENCODED_BYTES + FP2_ENCODED_BYTES + 2)
-    #define UNCOMPRESSEDPK_BYTES    564
-    // Table sizes used by the Entangled basis generation
+    #define EXPON_2                 372     // p = 2^372*3^239 - 1
+    #define EXPON_3                 239
+    #define EXPON_5                 0
+    #define ORDER_A_ENCODED_BYTES   ((OBOB_BITS + 7) / 8)             // Bytes of an element of Z_(2^372), padded to the size of Z_(3^239)
+    #define ORDER_B_ENCODED_BYTES   ((OBOB_BITS + 7) / 8)             // Bytes of an element of Z_(3^239)
+    #define MAX_BASIS_TRIES         256     // Bound on the candidate abscissas for the torsion bases (see torsion_basis.c)
+    // Compressed public keys: the Montgomery coefficient A, three coordinates of the points over a torsion basis and one flag byte
+    #define COMPRESSEDPK_A_BYTES    (FP2_ENCODED_BYTES + 3*ORDER_B_ENCODED_BYTES + 1)
+    #define COMPRESSEDPK_B_BYTES    (FP2_ENCODED_BYTES + 3*ORDER_A_ENCODED_BYTES + 1)
+    // Table sizes of the torsion basis generation: TABLE_R_LEN Elligator 2 candidates (see torsion_basis.c), TABLE_V_LEN and
+    // TABLE_V3_LEN are reserved for entangled bases
     #define TABLE_R_LEN 17
     #define TABLE_V_LEN 34
     #define TABLE_V3_LEN 20
-    // Parameters for discrete log computations
-    // Binary Pohlig-Hellman reduced to smaller logs of order ell^W
+    // Windowed Pohlig-Hellman discrete logarithms (see dlog.c): signed digits in windows of W_ell base-ell digits, the lowest
+    // window holding the r = e - W_ell*(DLEN_ell-1) remaining digits. dloggen.py generates the tables for every W_ell
     #define W_2 4
     #define W_3 3
-    // ell^w    
-    #define ELL2_W (1 << W_2)    
+    // ell^w
+    #define ELL2_W (1 << W_2)
     #define ELL3_W 27
-    // ell^(e mod w) 
-    #define ELL2_EMODW (1 << (OALICE_BITS % W_2))    
+    // ell^r
+    #define ELL2_EMODW 16
     #define ELL3_EMODW 9
-    // # of digits in the discrete log    
-    #define DLEN_2 ((OALICE_BITS + W_2 - 1) / W_2) // ceil(eA/W_2)
-    #define DLEN_3 ((OBOB_EXPON + W_3 - 1) / W_3) // ceil(eB/W_3)
-    // Use compressed tables: FULL_SIGNED
-    #define COMPRESSED_TABLES
-    #define ELL2_FULL_SIGNED    // Uses signed digits to reduce table size by half
-    #define ELL3_FULL_SIGNED    // Uses signed digits to reduce table size by half
-    // Length of the optimal strategy path for Pohlig-Hellman
-    #ifdef COMPRESSED_TABLES
-        #ifdef ELL2_FULL_SIGNED
-            #if W_2 == 4
-                #define PLEN_2 94
-            #endif
-        #endif
-        #ifdef ELL3_FULL_SIGNED
-            #if W_3 == 3
-                #define PLEN_3 81
-            #endif
-        #endif
-    #endif
+    // # of windows in the discrete log, ceil(e/w)
+    #define DLEN_2 ((EXPON_2 + W_2 - 1) / W_2)
+    #define DLEN_3 ((EXPON_3 + W_3 - 1) / W_3)
+    // Length of the optimal traversal paths of the Pohlig-Hellman trees
+    #define PLEN_2 (DLEN_2 + 1)
+    #define PLEN_3 (DLEN_3 + 1)
 #endif
 
 
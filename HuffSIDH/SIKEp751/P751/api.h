@@ -1,7 +1,7 @@
 /********************************************************************************************
 * Supersingular Isogeny Key Encapsulation Library
 *
-* Abstract: API header file for P751
+* Abstract: API header file for P751 (NIST security level 5)
 *********************************************************************************************/  
 
 #ifndef P751_API_H
@@ -17,6 +17,7 @@
 
 // Algorithm name
 #define CRYPTO_ALGNAME "SIKEp751"  
+#define CRYPTO_ALGNAME_HUFF "SIKEp751-Huff"
 
 // SIKE's key generation
 // It produces a private key sk and computes the public key pk.
@@ -36,6 +37,28 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
 // Outputs: shared secret ss      (CRYPTO_BYTES = 32 bytes)
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// SIKE on Huff curves: same KEM with the Huff key exchange functions (EphemeralKeyGeneration_*_Huff and
+// EphemeralSecretAgreement_*_Huff), and the same key and ciphertext sizes. Huff public keys and ciphertexts are not
+// Montgomery ones, so these functions only interoperate with each other and have their own known answer tests.
+int crypto_kem_keypair_Huff(unsigned char *pk, unsigned char *sk);
+int crypto_kem_enc_Huff(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int crypto_kem_dec_Huff(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+// A ciphertext whose public key is rejected by the shared secret computation (see below) fails the verification of
+// crypto_kem_dec and crypto_kem_dec_Huff right away, with the implicit rejection output. crypto_kem_enc_Huff returns 1 for such a pk.
+
+#ifdef COMPRESS
+// SIKE on Huff curves with compressed public keys and ciphertexts (built with "make COMPRESS=TRUE"), using the compressed
+// key exchange functions below. Keys and ciphertexts are about 60% of the size of the uncompressed ones.
+#define CRYPTO_SECRETKEYBYTES_COMPRESSED     413    // MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES_COMPRESSED bytes
+#define CRYPTO_PUBLICKEYBYTES_COMPRESSED     333
+#define CRYPTO_CIPHERTEXTBYTES_COMPRESSED    365    // CRYPTO_PUBLICKEYBYTES_COMPRESSED + MSG_BYTES bytes
+
+int crypto_kem_keypair_Huff_compressed(unsigned char *pk, unsigned char *sk);
+// crypto_kem_enc_Huff_compressed returns 1 if pk does not decompress to a valid public key
+int crypto_kem_enc_Huff_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int crypto_kem_dec_Huff_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+#endif
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp751" (wire format):
 // ----------------------------------------------------------------------
@@ -74,12 +97,16 @@ void random_mod_order_B(unsigned char* random_digits);
 // Output: the public key PublicKeyA consisting of 3 GF(p751^2) elements encoded in 564 bytes.
 int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
 int EphemeralKeyGeneration_A_Huff(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
+int EphemeralKeyGeneration_A_Edwards(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
+int EphemeralKeyGeneration_A_Huff_bounded(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned int max_points);
 // Bob's ephemeral key-pair generation
 // It produces a private key PrivateKeyB and computes the public key PublicKeyB.
 // The private key is an integer in the range [0, 2^Floor(Log(2,3^239)) - 1], stored in 48 bytes.  
 // The public key consists of 3 GF(p751^2) elements encoded in 564 bytes.
 int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB);
 int EphemeralKeyGeneration_B_Huff(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB);
+int EphemeralKeyGeneration_B_Edwards(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB);
+int EphemeralKeyGeneration_B_Huff_bounded(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, const unsigned int max_points);
 
 // Alice's ephemeral shared secret computation
 // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
@@ -88,6 +115,8 @@ int EphemeralKeyGeneration_B_Huff(const unsigned char* PrivateKeyB, unsigned cha
 // Output: a shared secret SharedSecretA that consists of one element in GF(p751^2) encoded in 188 bytes.
 int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
 int EphemeralSecretAgreement_A_Huff(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
+int EphemeralSecretAgreement_A_Edwards(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
+int EphemeralSecretAgreement_A_Huff_bounded(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA, const unsigned int max_points);
 
 // Bob's ephemeral shared secret computation
 // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
@@ -96,7 +125,63 @@ int EphemeralSecretAgreement_A_Huff(const unsigned char* PrivateKeyA, const unsi
 // Output: a shared secret SharedSecretB that consists of one element in GF(p751^2) encoded in 188 bytes. 
 int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 int EphemeralSecretAgreement_B_Huff(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
-
+int EphemeralSecretAgreement_B_Edwards(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
+int EphemeralSecretAgreement_B_Huff_bounded(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, const unsigned int max_points);
+
+
+// The shared secret computations return 1 before any isogeny computation if the public key is not valid: a coordinate
+// encoded above p, a zero coordinate, two equal coordinates or, for the *_Huff functions, a singular curve.
+
+// Working-set-bounded variants (*_Huff_bounded): the Huff isogeny tree traversal stores at most max_points points, trading
+// a few extra point multiplications for a smaller working set. The best precomputed strategy that fits the bound is used.
+// These functions return 1 if max_points is below 4. The *_Huff functions use the bound set at build time with "make MAXPTS=k".
+
+// Public key handles, for repeated shared secret computations with the same Huff public key (e.g., encapsulations to the same server).
+// A handle stores the public key, its decoded form and the coefficients of its curve, which do not depend on the private key.
+// pk_handle_init_A_Huff takes Alice's public key, for Bob's functions, and pk_handle_init_B_Huff takes Bob's public key, for Alice's.
+// The *_Huff_pk functions are the *_Huff functions above with the public key given by its handle. They return 1 if the handle
+// is not one of the other party's public key. pk_handle_init_*_Huff return 1 if the public key is not valid.
+// A handle is a convenience for callers that keep a decoded public key: it only saves the decoding of the public key and one
+// field inversion per call, which does not measurably speed up a shared secret computation or an encapsulation.
+typedef struct {
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+    unsigned int owner;
+    unsigned long long precomp[96];
+} pk_handle_t;
+
+int pk_handle_init_A_Huff(pk_handle_t* handle, const unsigned char* PublicKeyA);
+int pk_handle_init_B_Huff(pk_handle_t* handle, const unsigned char* PublicKeyB);
+int EphemeralSecretAgreement_A_Huff_pk(const unsigned char* PrivateKeyA, const pk_handle_t* PublicKeyB, unsigned char* SharedSecretA);
+int EphemeralSecretAgreement_B_Huff_pk(const unsigned char* PrivateKeyB, const pk_handle_t* PublicKeyA, unsigned char* SharedSecretB);
+// SIKE's encapsulation using Huff curves, with the handle of the public key pk made by pk_handle_init_B_Huff
+int crypto_kem_enc_Huff_pk(unsigned char *ct, unsigned char *ss, const pk_handle_t *pk);
+
+// Conversion of public keys between the Montgomery functions and the *_Huff functions, for either party: the Huff shared secret
+// computations then accept the public keys of the Montgomery ones and of standard SIKE implementations, and the Huff public keys
+// can be published in Montgomery form, with the same shared secrets. The conversions invert the three coordinates of a public key
+// with one field inversion, and return 1 if their input is not a valid public key (see above).
+int PublicKeyMontgomeryToHuff(const unsigned char* PublicKey, unsigned char* PublicKeyHuff);
+int PublicKeyHuffToMontgomery(const unsigned char* PublicKeyHuff, unsigned char* PublicKey);
+
+#ifdef COMPRESS
+#define SIDH_PUBLICKEYBYTES_COMPRESSED  333
+
+// Compressed Huff public keys (built with "make COMPRESS=TRUE"), encoded in 333 bytes: the coefficient A of the Montgomery
+// model of the public curve in GF(p751^2), the coordinates of two of the public points on a deterministic basis of the
+// 2^372-torsion (Bob's public keys) or of the 3^239-torsion (Alice's public keys), each in 48 bytes, and one byte that says
+// which coordinate was normalized to one. A decompressed public key is the original one up to a common multiple of its points,
+// which gives the same shared secrets.
+// The compression and decompression functions return 1 if their input is not a valid (compressed) public key.
+int PublicKeyCompression_A_Huff(const unsigned char* PublicKeyA, unsigned char* CompressedPKA);
+int PublicKeyCompression_B_Huff(const unsigned char* PublicKeyB, unsigned char* CompressedPKB);
+int PublicKeyDecompression_A_Huff(const unsigned char* CompressedPKA, unsigned char* PublicKeyA);
+int PublicKeyDecompression_B_Huff(const unsigned char* CompressedPKB, unsigned char* PublicKeyB);
+// Key generation and shared secret computation with compressed public keys
+int EphemeralKeyGeneration_A_Huff_compressed(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA);
+int EphemeralKeyGeneration_B_Huff_compressed(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB);
+int EphemeralSecretAgreement_A_Huff_compressed(const unsigned char* PrivateKeyA, const unsigned char* CompressedPKB, unsigned char* SharedSecretA);
+int EphemeralSecretAgreement_B_Huff_compressed(const unsigned char* PrivateKeyB, const unsigned char* CompressedPKA, unsigned char* SharedSecretB);
+#endif
 
 // Encoding of keys for KEX-based isogeny system "SIDHp751" (wire format):
 // ----------------------------------------------------------------------
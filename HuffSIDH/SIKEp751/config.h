@@ -97,6 +97,15 @@
 #endif
 
 
+// Number of threads used by the parallel isogeny tree traversal (PARALLEL_TRAVERSAL)
+
+#if !defined(PARALLEL_THREADS)
+    #define PARALLEL_THREADS    2
+#elif (PARALLEL_THREADS < 2) || (PARALLEL_THREADS > 4)
+    #error -- "Unsupported number of PARALLEL_THREADS"
+#endif
+
+
 // Extended datatype support
 
 #if defined(GENERIC_IMPLEMENTATION)                       
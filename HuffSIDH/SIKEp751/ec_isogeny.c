@@ -26,24 +26,20 @@ void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2e
 // CmDsq = (C-D)^2
 // CD4 = 4CD
 void xDBL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4)
-{ // Doubling of a Huff point in projective coordinates (X:Z).
-  // Input: projective Huff w-coordinates P = (X1:Z1), where w1=X1/Z1 and Huff curve constants (C-D)^2 and 4CD.
-  // Output: projective Huff w-coordinates Q = 2*P = (X2:Z2).
-    f2elm_t t0, t1, t2;
-
-
-    mp2_add(P->X, P->Z, t0);                         // t0 = X1+Z1
-    fp2sqr_mont(t0, t0);                                // t0 = (X1+Z1)^2
-    mp2_sub_p2(P->X, P->Z, t1);                         // t1 = X1-Z1
-    fp2sqr_mont(t1, t1);                                // t1 = (X1-Z1)^2
-    fp2mul_mont(CD4, t0, t2);                           // t2 = 4CD(X1+Z1)^2
-    fp2mul_mont(t2, t1, Q->Z);                          // Z2 = 4CD(X1+Z1)^2(X1-Z1)^2
-
-    mp2_sub_p2(t0, t1, t0);                             // t0 = 4X1Z1
-    fp2mul_mont(t0, CmDsq, Q->X);                        // X2 = 4X1Z1(C-D)^2
-    mp2_add(Q->X, t2, Q->X);
-    fp2mul_mont(Q->X, t0, Q->X);
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1;
 
+    mp2_add(P->X, P->Z, t0);                        // t0 = P->X + P->Z
+    fp2sqr_mont(t0, t0);                            // sp = (P->X+P->Z)^2
+    mp2_sub_p2(P->X, P->Z, Q->Z);                   // Q->Z = P->X - P->Z
+    fp2sqr_mont(Q->Z, Q->Z);                        // sm = (P->X-P->Z)^2
+    fp2mul_mont(t0, CD4, Q->X);                     // t = sp*CD4
+    mp2_sub_p2(t0, Q->Z, t0);                       // xz4 = sp - sm
+    fp2mul_mont(Q->Z, Q->X, Q->Z);                  // Q->Z = sm*t
+    fp2mul_mont(t0, CmDsq, t1);                     // t1 = xz4*CmDsq
+    mp2_add(Q->X, t1, Q->X);                        // Q->X = t + xz4*CmDsq
+    fp2mul_mont(t0, Q->X, Q->X);                    // Q->X = xz4*(t+xz4*CmDsq)
 }
 
 
@@ -65,17 +61,27 @@ void xDBLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2
 
 // CmDsq = (C-D)^2
 // CD4 = 4CD
-void xDBLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4, const int e)
-{ // Computes [2^e](X:Z) on Huff curve with projective constant via e repeated doublings.
+void xDBLe_inplace_Huff(point_proj_t P, const f2elm_t CmDsq, const f2elm_t CD4, const int e)
+{ // Computes [2^e](X:Z) on Huff curve with projective constant via e repeated doublings, in place.
   // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants (C-D)^2 and 4CD.
-  // Output: projective Huff w-coordinates Q <- (2^e)*P.
+  // Output: projective Huff w-coordinates P <- (2^e)*P.
     int i;
-    
-    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
 
     for (i = 0; i < e; i++) {
-        xDBL_Huff(Q, Q, CmDsq, CD4);
+        xDBL_Huff(P, P, CmDsq, CD4);
+    }
+}
+
+void xDBLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t CmDsq, const f2elm_t CD4, const int e)
+{ // Computes [2^e](X:Z) on Huff curve with projective constant via e repeated doublings.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants (C-D)^2 and 4CD.
+  // Output: projective Huff w-coordinates Q <- (2^e)*P. The first doubling reads P and writes Q, so P is only copied when e = 0.
+    if (e == 0) {
+        copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+        return;
     }
+    xDBL_Huff(P, Q, CmDsq, CD4);
+    xDBLe_inplace_Huff(Q, CmDsq, CD4, e-1);
 }
 
 
@@ -98,25 +104,22 @@ void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t* coe
 
 
 void get_4_isog_Huff(const point_proj_t P, f2elm_t CmDsq, f2elm_t CD4, f2elm_t* coeff)
-{ // Computes the corresponding 4-isogeny of a projective Huff point (X4:Z4) of order 4.
-  // Input:  projective point of order four P = (X4:Z4).
-  // Output: the 4-isogenous Huff curve with projective coefficients (C-D)^2)/4CD and the 3 coefficients 
-  //         that are used to evaluate the isogeny at a point in eval_4_isog().
-    
-    mp2_sub_p2(P->X, P->Z, coeff[1]);               // coeff[1] = X4-Z4
-    mp2_add(P->X, P->Z, coeff[2]);                  // coeff[2] = X4+Z4
-    fp2sqr_mont(P->Z, coeff[0]);                    // coeff[0] = Z4^2
-    mp2_add(coeff[0], coeff[0], coeff[0]);          // coeff[0] = 2*Z4^2
-    fp2sqr_mont(coeff[0], CmDsq);                     // CmDsq = 4*Z4^4
-    mp2_add(coeff[0], coeff[0], coeff[0]);          // coeff[0] = 4*Z4^2
-    fp2sqr_mont(P->X, CD4);                     // CD4 = X4^2
-    mp2_add(CD4, CD4, CD4);             // CD4 = 2*X4^2
-    fp2sqr_mont(CD4, CD4);                  // CD4 = 4*X4^4
-    mp2_sub_p2(CmDsq, CD4, CmDsq);          // CmDsq = 4*Z4^4-4*X4^4
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    fp2sqr_mont(P->X, coeff[1]);                    // coeff[1] = P->X^2
+    mp2_add(coeff[1], coeff[1], coeff[1]);          // coeff[1] = 2*P->X^2
+    fp2sqr_mont(coeff[1], CD4);                     // x4 = (2*P->X^2)^2
+    fp2sub(P->X, P->Z, coeff[1]);                   // coeff[1] = P->X - P->Z
+    fp2add(P->X, P->Z, coeff[2]);                   // coeff[2] = P->X + P->Z
+    fp2sqr_mont(P->Z, coeff[0]);                    // coeff[0] = P->Z^2
+    fp2add(coeff[0], coeff[0], CmDsq);              // CmDsq = 2*P->Z^2
+    fp2add(CmDsq, CmDsq, coeff[0]);                 // coeff[0] = 4*P->Z^2
+    fp2sqr_mont(CmDsq, CmDsq);                      // CmDsq = (2*P->Z^2)^2
+    fp2sub(CmDsq, CD4, CmDsq);                      // CmDsq = (2*P->Z^2)^2 - x4
 }
 
 
-void eval_4_isog(point_proj_t P, f2elm_t* coeff)
+void eval_4_isog(point_proj_t P, const f2elm_t* coeff)
 { // Evaluates the isogeny at the point (X:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
   // by the 3 coefficients in coeff (computed in the function get_4_isog()).
   // Inputs: the coefficients defining the isogeny, and the projective point P = (X:Z).
@@ -142,32 +145,25 @@ void eval_4_isog(point_proj_t P, f2elm_t* coeff)
 
 
 
-void eval_4_isog_Huff(point_proj_t P, f2elm_t* coeff)
-{ // Evaluates the isogeny at the point (X:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
-  // by the 3 coefficients in coeff (computed in the function get_4_isog()).
-  // Inputs: the coefficients defining the isogeny, and the projective point P = (X:Z).
-  // Output: the projective point P = phi(P) = (X:Z) in the codomain. 
+void eval_4_isog_Huff(point_proj_t P, const f2elm_t* coeff)
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
     f2elm_t t0, t1;
-    
-    mp2_add(P->X, P->Z, t0);                        // t0 = X+Z
-    mp2_sub_p2(P->X, P->Z, t1);                     // t1 = X-Z
-    fp2mul_mont(t0, coeff[1], P->Z);                // Z = (X+Z)*coeff[1] = (X+Z)(X4-Z4)
-    fp2mul_mont(t1, coeff[2], P->X);                // X = (X-Z)*coeff[2] = (X-Z)(X4+Z4)
-    fp2mul_mont(t0, t1, t0);                        // t0 = (X+Z)*(X-Z)
-    fp2mul_mont(coeff[0], t0, t0);                  // t0 = coeff[0]*(X+Z)*(X-Z) = 4*Z4^2(X^2-Z^2)
-    mp2_add(P->Z, P->X, t1);                        // t1 = (X+Z)(X4-Z4) + (X-Z)(X4+Z4) = 2(XX4-ZZ4)
-
-    mp2_sub_p2(P->Z, P->X, P->X);                   // X = (X+Z)(X4-Z4) - (X-Z)(X4+Z4) =2(-XZ4+ZX4)
 
-    fp2sqr_mont(t1, t1);                            // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2 = 4(XX4-ZZ4)^2 (for z)
-    fp2sqr_mont(P->X, P->X);                        // X = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 =4(XZ4-ZX4)^2
-    
-    mp2_add(t1, t0, P->Z);                          // Z = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2 //zx 4*(x*x4^2 - 2*x4*z*z4 + x*z4^2)*x
-    mp2_sub_p2(P->X, t0, t0);                       // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z) //4*(x4^2*z - 2*x*x4*z4 + z*z4^2)*z
-
-    fp2mul_mont(P->Z, P->X, P->X);                    // Zfinal
-    fp2mul_mont(t1, t0, P->Z);                    // Xfinal
-    
+    mp2_add(P->X, P->Z, t0);                        // s = P->X + P->Z
+    mp2_sub_p2(P->X, P->Z, P->X);                   // d = P->X - P->Z
+    fp2mul_mont(t0, coeff[1], P->Z);                // a = s*coeff[1]
+    fp2mul_mont(t0, P->X, t0);                      // t0 = s*d
+    fp2mul_mont(P->X, coeff[2], P->X);              // b = d*coeff[2]
+    fp2mul_mont(coeff[0], t0, t0);                  // e = coeff[0]*s*d
+    mp2_add(P->Z, P->X, t1);                        // t1 = a + b
+    mp2_sub_p2(P->Z, P->X, P->X);                   // P->X = a - b
+    fp2sqr_mont(t1, P->Z);                          // u = (a+b)^2
+    fp2sqr_mont(P->X, t1);                          // v = (a-b)^2
+    mp2_add(t0, P->Z, P->X);                        // P->X = e + u
+    fp2mul_mont(t1, P->X, P->X);                    // P->X = v*(e+u)
+    mp2_sub_p2(t1, t0, t0);                         // t0 = v - e
+    fp2mul_mont(P->Z, t0, P->Z);                    // P->Z = u*(v-e)
 }
 
 //
@@ -204,33 +200,32 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
 // A24minus = (C-D)^2
 //  A24plus = (C+D)^2
 void xTPL_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)              
-{ // Tripling of a Huff point in projective coordinates (X:Z).
-  // Input: projective Huff w-coordinates P = (X:Z), where w=X/Z and Huff curve constants A24plus = (C+D)^2 and A24minus = (C-D)^2.
-  // Output: projective Huff w-coordinates Q = 3*P = (X3:Z3).
-    f2elm_t t0, t1, t2, t3, t4, t5, t6;
-                                    
-    mp2_sub_p2(P->X, P->Z, t0);                     // t0 = X-Z 
-    fp2sqr_mont(t0, t2);                            // t2 = (X-Z)^2           
-    mp2_add(P->X, P->Z, t1);                        // t1 = X+Z 
-    fp2sqr_mont(t1, t3);                            // t3 = (X+Z)^2
-    mp2_add(P->X, P->X, t4);                        // t4 = 2*X
-    mp2_add(P->Z, P->Z, t0);                        // t0 = 2*Z 
-    fp2sqr_mont(t4, t1);                            // t1 = 4*X^2
-    mp2_sub_p2(t1, t3, t1);                         // t1 = 4*X^2 - (X+Z)^2 
-    mp2_sub_p2(t1, t2, t1);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
-    fp2mul_mont(A24plus, t3, t5);                   // t5 = A24plus*(X+Z)^2 
-    fp2mul_mont(t3, t5, t3);                        // t3 = A24plus*(X+Z)^4
-    fp2mul_mont(A24minus, t2, t6);                  // t6 = A24minus*(X-Z)^2
-    fp2mul_mont(t2, t6, t2);                        // t2 = A24minus*(X-Z)^4
-    mp2_sub_p2(t2, t3, t3);                         // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
-    mp2_sub_p2(t5, t6, t2);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
-    fp2mul_mont(t1, t2, t1);                        // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
-    fp2add(t3, t1, t2);                             // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
-    fp2sqr_mont(t2, t2);                            // t2 = t2^2
-    fp2mul_mont(t4, t2, Q->X);                      // X3 = 2*X*t2
-    fp2sub(t3, t1, t1);                             // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
-    fp2sqr_mont(t1, t1);                            // t1 = t1^2
-    fp2mul_mont(t0, t1, Q->Z);                      // Z3 = 2*Z*t1
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1, t2, t3, t4;
+
+    mp2_sub_p2(P->X, P->Z, t0);                     // t0 = P->X - P->Z
+    fp2sqr_mont(t0, t0);                            // sm = (P->X-P->Z)^2
+    mp2_add(P->X, P->Z, t1);                        // t1 = P->X + P->Z
+    fp2sqr_mont(t1, t1);                            // sp = (P->X+P->Z)^2
+    mp2_add(P->X, P->X, Q->X);                      // x2 = 2*P->X
+    fp2sqr_mont(Q->X, t2);                          // t2 = x2^2
+    fp2sub(t2, t1, t2);                             // t2 = x2^2 - sp
+    mp2_sub_p2(t2, t0, t2);                         // u = x2^2-sp - sm
+    fp2mul_mont(t1, A24plus, t3);                   // ap = sp*A24plus
+    fp2mul_mont(t1, t3, t1);                        // t1 = sp*ap
+    fp2mul_mont(t0, A24minus, t4);                  // am = sm*A24minus
+    fp2mul_mont(t0, t4, t0);                        // t0 = sm*am
+    fp2sub(t0, t1, t0);                             // v = sm*am - sp*ap
+    mp2_sub_p2(t3, t4, t1);                         // t1 = ap - am
+    fp2mul_mont(t2, t1, t1);                        // w = u*(ap-am)
+    mp2_add(t0, t1, t2);                            // t2 = v + w
+    mp2_sub_p2(t0, t1, t0);                         // t0 = v - w
+    fp2sqr_mont(t2, t1);                            // t1 = (v+w)^2
+    fp2mul_mont(Q->X, t1, Q->X);                    // Q->X = x2*(v+w)^2
+    fp2sqr_mont(t0, t0);                            // t0 = (v-w)^2
+    mp2_add(P->Z, P->Z, Q->Z);                      // Q->Z = 2*P->Z
+    fp2mul_mont(Q->Z, t0, Q->Z);                    // Q->Z = 2*P->Z*(v-w)^2
 }
 
 
@@ -250,17 +245,27 @@ void xTPLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f
 
 // A24minus = (C-D)^2
 //  A24plus = (C+D)^2
-void xTPLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
-{ // Computes [3^e](X:Z) on Huff curve with projective constant via e repeated triplings.
+void xTPLe_inplace_Huff(point_proj_t P, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
+{ // Computes [3^e](X:Z) on Huff curve with projective constant via e repeated triplings, in place.
   // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants A24plus = (C+D)^2 and A24minus = (C-D)^2.
-  // Output: projective Huff x-coordinates Q <- (3^e)*P.
+  // Output: projective Huff w-coordinates P <- (3^e)*P.
     int i;
-        
-    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
 
     for (i = 0; i < e; i++) {
-        xTPL_Huff(Q, Q, A24minus, A24plus);
+        xTPL_Huff(P, P, A24minus, A24plus);
+    }
+}
+
+void xTPLe_Huff(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
+{ // Computes [3^e](X:Z) on Huff curve with projective constant via e repeated triplings.
+  // Input: projective Huff w-coordinates P = (XP:ZP), such that wP=XP/ZP and Huff curve constants A24plus = (C+D)^2 and A24minus = (C-D)^2.
+  // Output: projective Huff x-coordinates Q <- (3^e)*P. The first tripling reads P and writes Q, so P is only copied when e = 0.
+    if (e == 0) {
+        copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+        return;
     }
+    xTPL_Huff(P, Q, A24minus, A24plus);
+    xTPLe_inplace_Huff(Q, A24minus, A24plus, e-1);
 }
 
 
@@ -292,27 +297,26 @@ void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t
 // A24minus = (C-D)^2
 //  A24plus = (C+D)^2
 void get_3_isog_Huff(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff)
-{ // Computes the corresponding 3-isogeny of a projective Huff point (X3:Z3) of order 3.
-  // Input:  projective point of order three P = (X3:Z3).
-  // Output: the 3-isogenous Huff curve with projective coefficient C/D. 
-    f2elm_t t0, t1, t2, t3, t4;
-    
-    mp2_sub_p2(P->X, P->Z, coeff[0]);               // coeff0 = X-Z
-    fp2sqr_mont(coeff[0], t0);                      // t0 = (X-Z)^2
-    mp2_add(P->X, P->Z, coeff[1]);                  // coeff1 = X+Z
-    fp2sqr_mont(coeff[1], t1);                      // t1 = (X+Z)^2
-    mp2_add(P->Z, P->Z, t3);                        // t3 = 2*Z
-    fp2sqr_mont(t3, t3);                            // t3 = 4*Z^2 
-    fp2sub(t3, t0, t2);                             // t2 = 4*Z^2 - (X-Z)^2 
-    fp2sub(t3, t1, t3);                             // t3 = 4*Z^2 - (X+Z)^2
-    mp2_add(t0, t3, t4);                            // t4 = 4*Z^2 - (X+Z)^2 + (X-Z)^2 
-    mp2_add(t4, t4, t4);                            // t4 = 2(4*Z^2 - (X+Z)^2 + (X-Z)^2) 
-    mp2_add(t1, t4, t4);                            // t4 = 8*Z^2 - (X+Z)^2 + 2*(X-Z)^2
-    fp2mul_mont(t2, t4, A24minus);                  // A24minus = [4*Z^2 - (X-Z)^2]*[8*Z^2 - (X+Z)^2 + 2*(X-Z)^2] //(C=D)
-    mp2_add(t1, t2, t4);                            // t4 = 4*Z^2 + (X+Z)^2 - (X-Z)^2
-    mp2_add(t4, t4, t4);                            // t4 = 2(4*Z^2 + (X+Z)^2 - (X-Z)^2) 
-    mp2_add(t0, t4, t4);                            // t4 = 8*Z^2 + 2*(X+Z)^2 - (X-Z)^2
-    fp2mul_mont(t3, t4, A24plus);                   // A24plus = [4*Z^2 - (X+Z)^2]*[8*Z^2 + 2*(X+Z)^2 - (X-Z)^2] //(C+D)^2
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
+    f2elm_t t0, t1, t2;
+
+    fp2sub(P->X, P->Z, coeff[0]);                   // c0 = P->X - P->Z
+    fp2add(P->X, P->Z, coeff[1]);                   // c1 = P->X + P->Z
+    fp2sqr_mont(coeff[0], A24plus);                 // sm = c0^2
+    fp2sqr_mont(coeff[1], t0);                      // sp = c1^2
+    mp2_add(P->Z, P->Z, A24minus);                  // A24minus = 2*P->Z
+    fp2sqr_mont(A24minus, A24minus);                // z4 = (2*P->Z)^2
+    fp2sub(A24minus, A24plus, t1);                  // u = z4 - sm
+    fp2sub(A24minus, t0, t2);                       // v = z4 - sp
+    fp2add(A24plus, t2, A24minus);                  // A24minus = sm + v
+    fp2add(A24minus, A24minus, A24minus);           // A24minus = 2*(sm+v)
+    mp2_add(t0, A24minus, A24minus);                // A24minus = sp + 2*(sm+v)
+    fp2mul_mont(t1, A24minus, A24minus);            // A24minus = u*(sp+2*(sm+v))
+    fp2add(t0, t1, t0);                             // t0 = sp + u
+    fp2add(t0, t0, t0);                             // t0 = 2*(sp+u)
+    mp2_add(A24plus, t0, A24plus);                  // A24plus = sm + 2*(sp+u)
+    fp2mul_mont(t2, A24plus, A24plus);              // A24plus = v*(sm+2*(sp+u))
 }  
 
 void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
@@ -336,26 +340,235 @@ void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
 
 
 void eval_3_isog_Huff(point_proj_t Q, const f2elm_t* coeff)
-{ // Computes the 3-isogeny R=phi(X:Z), given projective point (X3:Z3) of order 3 on a Huff curve and 
-  // a point P with 2 coefficients in coeff (computed in the function get_3_isog()).
-  // Inputs: projective points P = (X3:Z3) and Q = (X:Z).
-  // Output: the projective point Q <- phi(Q) = (X3:Z3). 
+{
+    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there
     f2elm_t t0, t1, t2;
 
-    mp2_add(Q->X, Q->Z, t0);                      // t0 = X+Z
-    mp2_sub_p2(Q->X, Q->Z, t1);                   // t1 = X-Z
-    fp2mul_mont(coeff[0], t0, t0);                // t0 = coeff0*(X+Z)
-    fp2mul_mont(coeff[1], t1, t1);                // t1 = coeff1*(X-Z)
-    mp2_sub_p2(t1, t0, t2);                       // t2 = coeff1*(X-Z) - coeff0*(X+Z) // for W'
-    mp2_add(t0, t1, t0);                          // t0 = coeff0*(X+Z) + coeff1*(X-Z) // for Z'
+    mp2_add(Q->X, Q->Z, t0);                        // t0 = Q->X + Q->Z
+    fp2mul_mont(coeff[0], t0, t0);                  // a = coeff[0]*(Q->X+Q->Z)
+    mp2_sub_p2(Q->X, Q->Z, t1);                     // t1 = Q->X - Q->Z
+    fp2mul_mont(coeff[1], t1, t1);                  // b = coeff[1]*(Q->X-Q->Z)
+    mp2_sub_p2(t1, t0, t2);                         // t2 = b - a
+    mp2_add(t0, t1, t0);                            // t0 = a + b
+    fp2sqr_mont(t2, t1);                            // t1 = (b-a)^2
+    fp2mul_mont(Q->X, t1, Q->X);                    // Q->X = Q->X*(b-a)^2
+    fp2sqr_mont(t0, t0);                            // t0 = (a+b)^2
+    fp2mul_mont(Q->Z, t0, Q->Z);                    // Q->Z = Q->Z*(a+b)^2
+}
 
-    fp2sqr_mont(t2, t2);                          // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2 // for W'
-    fp2sqr_mont(t0, t0);                          // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2 // for Z'
-    fp2mul_mont(Q->X, t2, Q->X);                  // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2       
-    fp2mul_mont(Q->Z, t0, Q->Z);                  // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+
+
+void map_mont_huff(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective point between Montgomery x-coordinates and Huff w-coordinates, where w = 1/x (see monttohuff.sage).
+  // The map is an involution, Q = (Z:X) for P = (X:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2copy(P->X, t);
+    fp2copy(P->Z, Q->X);
+    fp2copy(t, Q->Z);
+}
+
+
+void huff_to_mont_curve(const f2elm_t CmDsq, const f2elm_t CD4, f2elm_t A24plus, f2elm_t C24)
+{ // Montgomery curve constants of the Huff curve with constants CmDsq = (C-D)^2 and CD4 = 4CD: A24plus = (C+D)^2 and C24 = 4CD.
+  // The Montgomery curve is y^2 = x^3 + (C^2+D^2)/(CD)*x^2 + x, on which w = 1/x.
+    fp2add(CmDsq, CD4, A24plus);
+    fp2copy(CD4, C24);
+}
+
+
+void map_mont_edwards(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective Montgomery x-coordinate to a twisted Edwards y-coordinate, where y = (x-1)/(x+1).
+  // Edwards points (Y:Z) are stored in the X and Z fields of a point_proj_t. Q = (X-Z:X+Z) for P = (X:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2sub(P->X, P->Z, t);
+    fp2add(P->X, P->Z, Q->Z);
+    fp2copy(t, Q->X);
+}
+
+
+void map_edwards_mont(const point_proj_t P, point_proj_t Q)
+{ // Maps a projective twisted Edwards y-coordinate to a Montgomery x-coordinate, where x = (1+y)/(1-y).
+  // Q = (Z+Y:Z-Y) for P = (Y:Z). P and Q can be the same point.
+    f2elm_t t;
+
+    fp2add(P->Z, P->X, t);
+    fp2sub(P->Z, P->X, Q->Z);
+    fp2copy(t, Q->X);
+}
+
+
+// The twisted Edwards curve a*x^2 + y^2 = 1 + d*x^2*y^2 is birationally equivalent to the Montgomery curve with A = 2(a+d)/(a-d),
+// so its projective constants are those of the Montgomery kernels: A24plus = a, C24 = a-d and A24minus = d (up to a common factor).
+// The Edwards kernels are the Montgomery kernels with X-Z and X+Z replaced by Y and Z; their outputs are mapped back with Y = X-Z, Z = X+Z.
+
+void xDBL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd)
+{ // Doubling of a twisted Edwards point in projective y-coordinates (Y:Z).
+  // Input: projective Edwards y-coordinates P = (Y1:Z1), where y1=Y1/Z1 and Edwards curve constants a and a-d.
+  // Output: projective Edwards y-coordinates Q = 2*P = (Y2:Z2).
+    f2elm_t t0, t1, t2;
+    
+    fp2sqr_mont(P->X, t0);                          // t0 = Y1^2 
+    fp2sqr_mont(P->Z, t1);                          // t1 = Z1^2 
+    fp2mul_mont(amd, t0, t2);                       // t2 = (a-d)*Y1^2   
+    fp2mul_mont(t1, t2, Q->X);                      // X2 = (a-d)*Y1^2*Z1^2
+    mp2_sub_p2(t1, t0, t1);                         // t1 = Z1^2-Y1^2 
+    fp2mul_mont(a, t1, t0);                         // t0 = a*(Z1^2-Y1^2)
+    mp2_add(t2, t0, t2);                            // t2 = a*(Z1^2-Y1^2) + (a-d)*Y1^2
+    fp2mul_mont(t2, t1, t2);                        // Z2 = [a*(Z1^2-Y1^2) + (a-d)*Y1^2]*(Z1^2-Y1^2)
+    fp2add(Q->X, t2, Q->Z);                         // Zfinal = X2+Z2
+    fp2sub(Q->X, t2, Q->X);                         // Yfinal = X2-Z2
+}
+
+
+void xDBLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t a, const f2elm_t amd, const int e)
+{ // Computes [2^e](Y:Z) on twisted Edwards curve with projective constants via e repeated doublings.
+  // Input: projective Edwards y-coordinates P = (YP:ZP), such that yP=YP/ZP and Edwards curve constants a and a-d.
+  // Output: projective Edwards y-coordinates Q <- (2^e)*P.
+    int i;
+    
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xDBL_Edwards(Q, Q, a, amd);
+    }
+}
+
+
+void get_4_isog_Edwards(const point_proj_t P, f2elm_t a, f2elm_t amd, f2elm_t* coeff)
+{ // Computes the corresponding 4-isogeny of a projective twisted Edwards point (Y4:Z4) of order 4.
+  // Input:  projective point of order four P = (Y4:Z4).
+  // Output: the 4-isogenous Edwards curve with projective constants a and a-d and the 3 coefficients 
+  //         that are used to evaluate the isogeny at a point in eval_4_isog_Edwards().
+    
+    fp2copy(P->X, coeff[1]);                        // coeff[1] = Y4
+    fp2copy(P->Z, coeff[2]);                        // coeff[2] = Z4
+    mp2_sub_p2(P->Z, P->X, coeff[0]);               // coeff[0] = Z4-Y4
+    fp2sqr_mont(coeff[0], coeff[0]);                // coeff[0] = (Z4-Y4)^2
+    fp2sqr_mont(coeff[0], amd);                     // amd = (Z4-Y4)^4
+    mp2_add(P->Z, P->X, a);                         // a = Z4+Y4
+    fp2sqr_mont(a, a);                              // a = (Z4+Y4)^2
+    fp2sqr_mont(a, a);                              // a = (Z4+Y4)^4
+}
+
+
+void eval_4_isog_Edwards(point_proj_t P, const f2elm_t* coeff)
+{ // Evaluates the isogeny at the point (Y:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
+  // by the 3 coefficients in coeff (computed in the function get_4_isog_Edwards()).
+  // Inputs: the coefficients defining the isogeny, and the projective point P = (Y:Z).
+  // Output: the projective point P = phi(P) = (Y:Z) in the codomain. 
+    f2elm_t t0, t1, t2;
+    
+    fp2mul_mont(P->Z, coeff[1], t2);                // t2 = Z*coeff[1]
+    fp2mul_mont(P->X, coeff[2], t1);                // t1 = Y*coeff[2]
+    fp2mul_mont(P->Z, P->X, t0);                    // t0 = Z*Y
+    fp2mul_mont(coeff[0], t0, t0);                  // t0 = coeff[0]*Z*Y
+    mp2_add(t2, t1, P->X);                          // X = Y*coeff[2] + Z*coeff[1]
+    mp2_sub_p2(t1, t2, P->Z);                       // Z = Y*coeff[2] - Z*coeff[1]
+    fp2sqr_mont(P->X, t1);                          // t1 = [Y*coeff[2] + Z*coeff[1]]^2
+    fp2sqr_mont(P->Z, P->Z);                        // Z = [Y*coeff[2] - Z*coeff[1]]^2
+    mp2_add(t1, t0, P->X);                          // X = coeff[0]*Z*Y + [Y*coeff[2] + Z*coeff[1]]^2
+    mp2_sub_p2(P->Z, t0, t0);                       // t0 = [Y*coeff[2] - Z*coeff[1]]^2 - coeff[0]*Z*Y
+    fp2mul_mont(P->X, t1, t2);                      // X = X*t1
+    fp2mul_mont(P->Z, t0, t0);                      // Z = Z*t0
+    fp2add(t2, t0, P->Z);                           // Zfinal = X+Z
+    fp2sub(t2, t0, P->X);                           // Yfinal = X-Z
+}
+
+
+void xTPL_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a)              
+{ // Tripling of a twisted Edwards point in projective y-coordinates (Y:Z).
+  // Input: projective Edwards y-coordinates P = (Y:Z), where y=Y/Z and Edwards curve constants d and a.
+  // Output: projective Edwards y-coordinates Q = 3*P = (Y3:Z3).
+    f2elm_t t0, t1, t2, t3, t4, t5, t6;
+                                    
+    fp2sqr_mont(P->X, t2);                          // t2 = Y^2           
+    fp2sqr_mont(P->Z, t3);                          // t3 = Z^2
+    mp2_add(P->Z, P->X, t4);                        // t4 = Z+Y
+    mp2_sub_p2(P->Z, P->X, t0);                     // t0 = Z-Y 
+    fp2sqr_mont(t4, t1);                            // t1 = (Z+Y)^2
+    mp2_sub_p2(t1, t3, t1);                         // t1 = (Z+Y)^2 - Z^2 
+    mp2_sub_p2(t1, t2, t1);                         // t1 = (Z+Y)^2 - Z^2 - Y^2
+    fp2mul_mont(a, t3, t5);                         // t5 = a*Z^2 
+    fp2mul_mont(t3, t5, t3);                        // t3 = a*Z^4
+    fp2mul_mont(d, t2, t6);                         // t6 = d*Y^2
+    fp2mul_mont(t2, t6, t2);                        // t2 = d*Y^4
+    mp2_sub_p2(t2, t3, t3);                         // t3 = d*Y^4 - a*Z^4
+    mp2_sub_p2(t5, t6, t2);                         // t2 = a*Z^2 - d*Y^2
+    fp2mul_mont(t1, t2, t1);                        // t1 = 2*Y*Z*[a*Z^2 - d*Y^2]
+    fp2add(t3, t1, t2);                             // t2 = 2*Y*Z*[a*Z^2 - d*Y^2] + d*Y^4 - a*Z^4
+    fp2sqr_mont(t2, t2);                            // t2 = t2^2
+    fp2mul_mont(t4, t2, t2);                        // X3 = (Z+Y)*t2
+    fp2sub(t3, t1, t1);                             // t1 = d*Y^4 - a*Z^4 - 2*Y*Z*[a*Z^2 - d*Y^2]
+    fp2sqr_mont(t1, t1);                            // t1 = t1^2
+    fp2mul_mont(t0, t1, t1);                        // Z3 = (Z-Y)*t1
+    fp2add(t2, t1, Q->Z);                           // Zfinal = X3+Z3
+    fp2sub(t2, t1, Q->X);                           // Yfinal = X3-Z3
 }
 
 
+void xTPLe_Edwards(const point_proj_t P, point_proj_t Q, const f2elm_t d, const f2elm_t a, const int e)
+{ // Computes [3^e](Y:Z) on twisted Edwards curve with projective constants via e repeated triplings.
+  // Input: projective Edwards y-coordinates P = (YP:ZP), such that yP=YP/ZP and Edwards curve constants d and a.
+  // Output: projective Edwards y-coordinates Q <- (3^e)*P.
+    int i;
+        
+    copy_words((digit_t*)P, (digit_t*)Q, 2*2*NWORDS_FIELD);
+
+    for (i = 0; i < e; i++) {
+        xTPL_Edwards(Q, Q, d, a);
+    }
+}
+
+
+void get_3_isog_Edwards(const point_proj_t P, f2elm_t d, f2elm_t a, f2elm_t* coeff)
+{ // Computes the corresponding 3-isogeny of a projective twisted Edwards point (Y3:Z3) of order 3.
+  // Input:  projective point of order three P = (Y3:Z3).
+  // Output: the 3-isogenous Edwards curve with projective constants d and a, and the 2 coefficients
+  //         that are used to evaluate the isogeny at a point in eval_3_isog_Edwards(). 
+    f2elm_t t0, t1, t2, t3, t4;
+    
+    fp2copy(P->X, coeff[0]);                        // coeff0 = Y
+    fp2sqr_mont(P->X, t0);                          // t0 = Y^2
+    fp2copy(P->Z, coeff[1]);                        // coeff1 = Z
+    fp2sqr_mont(P->Z, t1);                          // t1 = Z^2
+    mp2_add(P->Z, P->X, t3);                        // t3 = Z+Y
+    fp2sqr_mont(t3, t3);                            // t3 = (Z+Y)^2 
+    fp2sub(t3, t0, t2);                             // t2 = (Z+Y)^2 - Y^2 
+    fp2sub(t3, t1, t3);                             // t3 = (Z+Y)^2 - Z^2
+    mp2_add(t0, t3, t4);                            // t4 = (Z+Y)^2 - Z^2 + Y^2 
+    mp2_add(t4, t4, t4);                            // t4 = 2((Z+Y)^2 - Z^2 + Y^2) 
+    mp2_add(t1, t4, t4);                            // t4 = 2*(Z+Y)^2 - Z^2 + 2*Y^2
+    fp2mul_mont(t2, t4, d);                         // d = [(Z+Y)^2 - Y^2]*[2*(Z+Y)^2 - Z^2 + 2*Y^2]
+    mp2_add(t1, t2, t4);                            // t4 = (Z+Y)^2 + Z^2 - Y^2
+    mp2_add(t4, t4, t4);                            // t4 = 2((Z+Y)^2 + Z^2 - Y^2) 
+    mp2_add(t0, t4, t4);                            // t4 = 2*(Z+Y)^2 + 2*Z^2 - Y^2
+    fp2mul_mont(t3, t4, a);                         // a = [(Z+Y)^2 - Z^2]*[2*(Z+Y)^2 + 2*Z^2 - Y^2]
+}  
+
+
+void eval_3_isog_Edwards(point_proj_t Q, const f2elm_t* coeff)
+{ // Computes the 3-isogeny R=phi(Y:Z), given projective point (Y3:Z3) of order 3 on a twisted Edwards curve and 
+  // a point P with 2 coefficients in coeff (computed in the function get_3_isog_Edwards()).
+  // Inputs: projective points P = (Y3:Z3) and Q = (Y:Z).
+  // Output: the projective point Q <- phi(Q) = (Y3:Z3). 
+    f2elm_t t0, t1, t2, t3;
+
+    fp2mul_mont(coeff[0], Q->Z, t0);              // t0 = coeff0*Z
+    fp2mul_mont(coeff[1], Q->X, t1);              // t1 = coeff1*Y
+    mp2_add(t0, t1, t2);                          // t2 = coeff0*Z + coeff1*Y
+    mp2_sub_p2(t1, t0, t0);                       // t0 = coeff1*Y - coeff0*Z
+    fp2sqr_mont(t2, t2);                          // t2 = [coeff0*Z + coeff1*Y]^2
+    fp2sqr_mont(t0, t0);                          // t0 = [coeff1*Y - coeff0*Z]^2
+    mp2_add(Q->Z, Q->X, t1);                      // t1 = Z+Y
+    mp2_sub_p2(Q->Z, Q->X, t3);                   // t3 = Z-Y
+    fp2mul_mont(t1, t2, t2);                      // X3 = (Z+Y)*[coeff0*Z + coeff1*Y]^2        
+    fp2mul_mont(t3, t0, t0);                      // Z3 = (Z-Y)*[coeff1*Y - coeff0*Z]^2
+    fp2add(t2, t0, Q->Z);                         // Zfinal = X3+Z3
+    fp2sub(t2, t0, Q->X);                         // Yfinal = X3-Z3
+}
+
 
 void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3)
 { // 3-way simultaneous inversion
@@ -397,31 +610,42 @@ void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
 }
 
 
-void get_A_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
-{ // Given the w-coordinates of P, Q, and R, returns the value A=c+1/c-2 corresponding to the Huff curve E_c: cx(y^2-1)=y(x^2-1) such that R=Q-P on E_c.
+void get_A_Huff_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A, f2elm_t C)
+{ // Given the w-coordinates of P, Q, and R, returns the value A/C=c+1/c-2 corresponding to the Huff curve E_c: cx(y^2-1)=y(x^2-1) such that R=Q-P on E_c.
   // Input:  the w-coordinates xP, xQ, and xR of the points P, Q and R.
-  // Output: the value A=c+1/c-2 corresponding to the curve E_c: cx(y^2-1)=y(x^2-1).
-    f2elm_t t0, t1, t2;
+  // Output: the projective value A/C=c+1/c-2 corresponding to the curve E_c: cx(y^2-1)=y(x^2-1), with C = 4wR*wP*wQ.
+    f2elm_t t0;
 
     fp2mul_mont(xR, xP, t0);                     // t0 = wR*wP
-    fp2mul_mont(t0, xQ, t1);                     // t1 = wR*wP*wQ
+    fp2mul_mont(t0, xQ, C);                      // C = wR*wP*wQ
 
     fp2sub(xP, xQ, A);                           // A = wP-wQ 
-    fp2sub(A, t1, A);                            // A = wP-wQ-wR*wP*wQ
+    fp2sub(A, C, A);                             // A = wP-wQ-wR*wP*wQ
     fp2add(A, xR, A);                            // A = wP-wQ-wR*wP*wQ+wR   
     fp2sqr_mont(A, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2
 
-    fp2add(t1, t1, t1);                          // t1 = 2wR*wP*wQ
-    fp2add(t1, t1, t1);                          // t1 = 4wR*wP*wQ
+    fp2add(C, C, C);                             // C = 2wR*wP*wQ
+    fp2add(C, C, C);                             // C = 4wR*wP*wQ
 
     fp2add(t0, t0, t0);                         // t0 = 2wR*wP
-    fp2add(t0, t1, t0);                         // t0 = 4wR*wP*wQ + 2wR*wP
+    fp2add(t0, C, t0);                          // t0 = 4wR*wP*wQ + 2wR*wP
     fp2add(t0, t0, t0);                         // t0 = 8wR*wP*wQ + 4wR*wP
     fp2sub(A, t0, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP
 
-    fp2inv_mont(t1);                            // t1 = 1/4wR*wP*wQ
-    fp2mul_mont(A, t1, A);                      // A = ((wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP)/4wR*wP*wQ
-    fp2sub(A, xQ, A);                           // A = ((wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP)/4wR*wP*wQ-wQ
+    fp2mul_mont(xQ, C, t0);                     // t0 = 4wR*wP*wQ^2
+    fp2sub(A, t0, A);                           // A = (wP-wQ-wR*wP*wQ+wR)^2- 8wR*wP*wQ - 4wR*wP - 4wR*wP*wQ^2
+}
+
+
+void get_A_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
+{ // Given the w-coordinates of P, Q, and R, returns the value A=c+1/c-2 corresponding to the Huff curve E_c: cx(y^2-1)=y(x^2-1) such that R=Q-P on E_c.
+  // Input:  the w-coordinates xP, xQ, and xR of the points P, Q and R.
+  // Output: the value A=c+1/c-2 corresponding to the curve E_c: cx(y^2-1)=y(x^2-1).
+    f2elm_t C;
+
+    get_A_Huff_proj(xP, xQ, xR, A, C);
+    fp2inv_mont_bingcd(C);                      // C = 1/4wR*wP*wQ, not in constant time: the w-coordinates are public
+    fp2mul_mont(A, C, A);
 }
 
 
@@ -604,10 +828,11 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
 
 
 
-static void LADDER3PT_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A)
-{
+static void LADDER3PT_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A, const f2elm_t C)
+{ // Huff three-point ladder R = P+[m]Q on the curve A/C = c+1/c-2, from the w-coordinates xP, xQ and xPQ of P, Q and P-Q.
+  // C = NULL stands for C = 1. Otherwise the curve comes from a public key and A/C is normalized with one variable-time inversion.
     point_proj_t R0 = {0}, R2 = {0};
-    f2elm_t A24 = {0}, t0={0};
+    f2elm_t A24 = {0};
     digit_t mask;
     int i, nbits, bit, swap, prevbit = 0;
 
@@ -617,11 +842,16 @@ static void LADDER3PT_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ
         nbits = OBOB_BITS - 1;
     }
 
-    // Initializing constant
-
-    fp2copy(A, A24);               // t0 =C
-    fp2div2(A24, A24);  
-    fp2div2(A24, A24);  // A24 = (A+2)/4
+    // Initializing constant: A24 = A/(4C)
+    if (C == NULL) {
+        fp2div2(A, A24);
+        fp2div2(A24, A24);
+    } else {
+        fp2add(C, C, A24);
+        fp2add(A24, A24, A24);
+        fp2inv_mont_bingcd(A24);                // The curve is public: the binary GCD is much faster than fp2inv_mont()
+        fp2mul_mont(A, A24, A24);
+    }
 
     // Initializing points
     fp2copy(xQ, R0->X);
@@ -649,6 +879,72 @@ static void LADDER3PT_Huff(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ
 }
 
 
+#ifdef FIXED_BASE
+// The fixed-base tables fixed_base_A and fixed_base_B of the key generation kernel computation are generated by fixedgen.py.
+// Entry i holds {X_i+Z_i, X_i-Z_i}, where (X_i:Z_i) are the projective w-coordinates of [2^i]Q for the public generator Q of
+// Alice (resp. Bob) on the starting Huff curve.
+
+
+static void xADD_fixed_Huff(point_proj_t Q, const f2elm_t* T, const point_proj_t PQ)
+{ // Differential addition of a precomputed Huff point.
+  // Input: projective Huff point Q=(XQ:ZQ), table entry T = {XT+ZT, XT-ZT} of a point T and projective difference PQ=(XPQ:ZPQ) of Q and T.
+  // Output: projective Huff point Q <- Q+T = (XQT:ZQT).
+    f2elm_t t0, t1;
+
+    mp2_sub_p2(Q->X, Q->Z, t0);                     // t0 = XQ-ZQ
+    mp2_add(Q->X, Q->Z, t1);                        // t1 = XQ+ZQ
+    fp2mul_mont(T[0], t0, t0);                      // t0 = (XT+ZT)*(XQ-ZQ)
+    fp2mul_mont(T[1], t1, t1);                      // t1 = (XT-ZT)*(XQ+ZQ)
+    mp2_sub_p2(t0, t1, Q->X);                       // XQ = (XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)
+    mp2_add(t0, t1, Q->Z);                          // ZQ = (XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)
+    fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)]^2
+    fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)]^2
+    fp2mul_mont(Q->X, PQ->Z, Q->X);                 // XQ = ZPQ*[(XT+ZT)*(XQ-ZQ)-(XT-ZT)*(XQ+ZQ)]^2
+    fp2mul_mont(Q->Z, PQ->X, Q->Z);                 // ZQ = XPQ*[(XT+ZT)*(XQ-ZQ)+(XT-ZT)*(XQ+ZQ)]^2
+}
+
+
+static void LADDER3PT_fixed_Huff(const f2elm_t xP, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R)
+{ // Fixed-base version of LADDER3PT_Huff for the public basis on the starting curve. Computes R = P+[m]Q.
+  // The multiples [2^i]Q are read from a precomputed table. The table index only depends on the loop counter,
+  // so memory accesses are independent of the secret scalar m, and each step costs a single differential addition.
+    point_proj_t R2 = {0};
+    const f2elm_t (*table)[2];
+    digit_t mask;
+    int i, nbits, bit, swap, prevbit = 0;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+        table = (const f2elm_t (*)[2])fixed_base_A;
+    } else {
+        nbits = OBOB_BITS - 1;
+        table = (const f2elm_t (*)[2])fixed_base_B;
+    }
+
+    // Initializing points
+    fp2copy(xPQ, R2->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
+    fp2copy(xP, R->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
+    fpzero((digit_t*)(R->Z)[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R, R2, mask);
+        xADD_fixed_Huff(R2, table[i], R);
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R, R2, mask);
+}
+#endif
+
+
 
 
 #ifdef COMPRESS
@@ -680,7 +976,7 @@ void CompleteMPoint(const f2elm_t A, point_proj_t P, point_full_proj_t R)
     f2elm_t zero = {0}, one = {0}, xz, yz, s2, r2, invz, temp0, temp1;
 
     fpcopy((digit_t*)&Montgomery_one, one[0]);    
-    if (memcmp(P->Z[0], zero,NBITS_TO_NBYTES(NBITS_FIELD)) != 0 || memcmp(P->Z[1], zero, NBITS_TO_NBYTES(NBITS_FIELD)) != 0) {
+    if (!is_fp2_zero(P->Z)) {
         fp2mul_mont(P->X, P->Z, xz);       // xz = x*z;
         fpsub(P->X[0], P->Z[1], temp0[0]);
         fpadd(P->X[1], P->Z[0], temp0[1]);
@@ -859,15 +1155,22 @@ void Mont_ladder(const f2elm_t x, const digit_t* m, point_proj_t P, point_proj_t
 }
 
 
+void mont_scalarmult_full(const digit_t* a, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits)
+{ // Computes P = [a]S in full projective coordinates, with the ladder and the Okeya-Sakurai y-coordinate recovery
+    point_proj_t P0 = {0}, P1 = {0};
+
+    Mont_ladder(S->x, a, P0, P1, A24, order_bits, MAXBITS_ORDER);    
+    recover_os(P0->X, P0->Z, P1->X, P1->Z, S->x, S->y, A, P->X, P->Y, P->Z);     
+}
+
+
 void mont_twodim_scalarmult(digit_t* a, const point_t R, const point_t S, const f2elm_t A, const f2elm_t A24, point_full_proj_t P, const unsigned int order_bits)
 { // Computes P = R + [a]S  
-    point_proj_t P0 = {0}, P1 = {0};
     point_full_proj_t P2 = {0};
     f2elm_t one = {0};    
 
     fpcopy((digit_t*)&Montgomery_one, one[0]);
-    Mont_ladder(S->x, a, P0, P1, A24, order_bits, MAXBITS_ORDER);    
-    recover_os(P0->X, P0->Z, P1->X, P1->Z, S->x, S->y, A, P2->X, P2->Y, P2->Z);     
+    mont_scalarmult_full(a, S, A, A24, P2, order_bits);
     ADD(P2, R->x, R->y, one, A, P);       
 }
 
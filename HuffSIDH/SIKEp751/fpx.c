@@ -751,6 +751,25 @@ void fpinv_chain_mont(felm_t a)
         fpmul_mont(t[26], tt, tt);
     }
     fpcopy(tt, a);  
+#else
+    // Generic chain for primes without a tailored one: 4-bit fixed-window exponentiation by (p-3)/4 = p >> 2.
+    // The exponent is public, so zero windows are skipped.
+    felm_t t[15], tt;
+    digit_t e[NWORDS_FIELD];
+    unsigned int w;
+
+    fpcopy(a, t[0]);                                 // t[i] = a^(i+1)
+    for (i = 1; i < 15; i++) fpmul_mont(t[i-1], a, t[i]);
+    fpcopy((digit_t*)&PRIME, e);
+    mp_shiftr1(e, NWORDS_FIELD);
+    mp_shiftr1(e, NWORDS_FIELD);
+    fpcopy((digit_t*)&Montgomery_one, tt);
+    for (j = (NBITS_FIELD+3)/4; j > 0; j--) {
+        for (i = 0; i < 4; i++) fpsqr_mont(tt, tt);
+        w = (unsigned int)(e[(4*(j-1))/RADIX] >> ((4*(j-1)) % RADIX)) & 0xF;
+        if (w != 0) fpmul_mont(t[w-1], tt, tt);
+    }
+    fpcopy(tt, a);
 #endif
 }
 
@@ -829,8 +848,6 @@ void mp_shiftl1(digit_t* x, const unsigned int nwords)
     x[0] <<= 1;
 }
 
-#ifdef COMPRESS
-
 static __inline unsigned int is_felm_zero(const felm_t x)
 { // Is x = 0? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
   // SECURITY NOTE: This function does not run in constant-time.
@@ -842,6 +859,152 @@ static __inline unsigned int is_felm_zero(const felm_t x)
     return 1;
 }
 
+
+static unsigned int is_fp2_zero(const f2elm_t a)
+{ // Is a = 0? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
+    f2elm_t t;
+
+    fp2copy(a, t);
+    fp2correction(t);
+    return is_felm_zero(t[0]) & is_felm_zero(t[1]);
+}
+
+
+static __inline void power2_setup(digit_t* x, int mark, const unsigned int nwords)
+{ // Set up the value 2^mark.
+    unsigned int i;
+
+    for (i = 0; i < nwords; i++) x[i] = 0;
+
+    i = 0;
+    while (mark >= 0) {
+        if (mark < RADIX) {
+            x[i] = (digit_t)1 << mark;
+        }
+        mark -= RADIX;
+        i += 1;
+    }    
+}
+
+
+static __inline unsigned int is_felm_even(const felm_t x)
+{ // Is x even? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
+    return (unsigned int)((x[0] & 1) ^ 1);
+}
+
+
+static __inline unsigned int is_felm_lt(const felm_t x, const felm_t y)
+{ // Is x < y? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
+  // SECURITY NOTE: This function does not run in constant-time.
+
+    for (int i = NWORDS_FIELD-1; i >= 0; i--) {
+        if (x[i] < y[i]) { 
+            return true;
+        } else if (x[i] > y[i]) {
+            return false;
+        }
+    }
+    return false;
+}
+
+
+static __inline void fpinv_mont_bingcd_partial(const felm_t a, felm_t x1, unsigned int* k)
+{ // Partial Montgomery inversion via the binary GCD algorithm.
+    felm_t u, v, x2;
+    unsigned int cwords;  // Number of words necessary for x1, x2
+
+    fpcopy(a, u);
+    fpcopy((digit_t*)PRIME, v);
+    fpzero(x1); x1[0] = 1;
+    fpzero(x2);
+    *k = 0;
+
+    while (!is_felm_zero(v)) {
+        cwords = ((*k + 1) / RADIX) + 1;
+        if ((cwords < NWORDS_FIELD)) {
+            if (is_felm_even(v)) {
+                mp_shiftr1(v, NWORDS_FIELD);
+                mp_shiftl1(x1, cwords);
+            } else if (is_felm_even(u)) {
+                mp_shiftr1(u, NWORDS_FIELD);
+                mp_shiftl1(x2, cwords);
+            } else if (!is_felm_lt(v, u)) {
+                mp_sub(v, u, v, NWORDS_FIELD);
+                mp_shiftr1(v, NWORDS_FIELD);
+                mp_add(x1, x2, x2, cwords);
+                mp_shiftl1(x1, cwords);
+            } else {
+                mp_sub(u, v, u, NWORDS_FIELD);
+                mp_shiftr1(u, NWORDS_FIELD);
+                mp_add(x1, x2, x1, cwords);
+                mp_shiftl1(x2, cwords);
+            }
+        } else {
+            if (is_felm_even(v)) {
+                mp_shiftr1(v, NWORDS_FIELD);
+                mp_shiftl1(x1, NWORDS_FIELD);
+            } else if (is_felm_even(u)) {
+                mp_shiftr1(u, NWORDS_FIELD);
+                mp_shiftl1(x2, NWORDS_FIELD);
+            } else if (!is_felm_lt(v, u)) {
+                mp_sub(v, u, v, NWORDS_FIELD);
+                mp_shiftr1(v, NWORDS_FIELD);
+                mp_add(x1, x2, x2, NWORDS_FIELD);
+                mp_shiftl1(x1, NWORDS_FIELD);
+            } else {
+                mp_sub(u, v, u, NWORDS_FIELD);
+                mp_shiftr1(u, NWORDS_FIELD);
+                mp_add(x1, x2, x1, NWORDS_FIELD);
+                mp_shiftl1(x2, NWORDS_FIELD);
+            }
+        }
+        *k += 1;
+    }
+
+    if (is_felm_lt((digit_t*)PRIME, x1)) {
+        mp_sub(x1, (digit_t*)PRIME, x1, NWORDS_FIELD);
+    }
+}
+
+
+void fpinv_mont_bingcd(felm_t a)
+{ // Field inversion via the binary GCD using Montgomery arithmetic, a = a^-1*r' mod p.
+  // SECURITY NOTE: This function does not run in constant-time and is therefore only suitable for 
+  //                operations not involving any secret data.
+    felm_t x, t;
+    unsigned int k;
+
+    if (is_felm_zero(a) == true)
+        return;
+
+    fpinv_mont_bingcd_partial(a, x, &k);
+    if (k <= MAXBITS_FIELD) { 
+        fpmul_mont(x, (digit_t*)&Montgomery_R2, x);
+        k += MAXBITS_FIELD;
+    }
+    fpmul_mont(x, (digit_t*)&Montgomery_R2, x);
+    power2_setup(t, 2*MAXBITS_FIELD - k, NWORDS_FIELD);
+    fpmul_mont(x, t, a);
+}
+
+
+void fp2inv_mont_bingcd(f2elm_t a)
+{// GF(p^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2)
+ // This uses the binary GCD for inversion in fp and is NOT constant time!!!
+    f2elm_t t1;
+
+    fpsqr_mont(a[0], t1[0]);             // t10 = a0^2
+    fpsqr_mont(a[1], t1[1]);             // t11 = a1^2
+    fpadd(t1[0], t1[1], t1[0]);          // t10 = a0^2+a1^2
+    fpinv_mont_bingcd(t1[0]);            // t10 = (a0^2+a1^2)^-1
+    fpneg(a[1]);                         // a = a0-i*a1
+    fpmul_mont(a[0], t1[0], a[0]);
+    fpmul_mont(a[1], t1[0], a[1]);       // a = (a0-i*a1)*(a0^2+a1^2)^-1
+}
+
+
+#ifdef COMPRESS
+
 static __inline unsigned int is_felm_one(const felm_t x)
 { // Is x = 0? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
   // SECURITY NOTE: This function does not run in constant-time.
@@ -930,6 +1093,33 @@ void cube_Fp2_cycl(f2elm_t a, const felm_t one)
 }
 
 
+void pow5_Fp2_cycl(f2elm_t a, const felm_t one)
+{ // Cyclotomic fifth power on elements of norm 1, a = (a^2)^2*a.
+     f2elm_t t0;
+
+     fp2copy(a, t0);
+     sqr_Fp2_cycl(a, one);
+     sqr_Fp2_cycl(a, one);
+     fp2mul_mont(a, t0, a);
+}
+
+
+void exp_ell_Fp2_cycl(f2elm_t a, const unsigned int ell, const unsigned int e, const felm_t one)
+{ // Computes a = a^(ell^e) on elements of norm 1, for ell = 2, 3 or 5.
+     unsigned int i;
+
+     for (i = 0; i < e; i++) {
+         if (ell == 2) {
+             sqr_Fp2_cycl(a, one);
+         } else if (ell == 3) {
+             cube_Fp2_cycl(a, one);
+         } else {
+             pow5_Fp2_cycl(a, one);
+         }
+     }
+}
+
+
 
 
 
@@ -976,6 +1166,52 @@ unsigned char is_sqr_fp2(const f2elm_t a, felm_t s)
 }
 
 
+static int jacobi_fp(const felm_t a)
+{ // Legendre symbol (a/p) in {0, 1, -1} of a in [0, p-1] in standard representation, by the binary Jacobi symbol algorithm.
+  // SECURITY NOTE: This function does not run in constant time.
+    felm_t u, v;
+    digit_t *x = u, *y = v, *t, r;
+    int s = 1;
+
+    if (is_felm_zero(a)) {
+        return 0;
+    }
+    fpcopy(a, u);
+    fpcopy((digit_t*)PRIME, v);
+    while (!is_felm_zero(x)) {            // Invariant: (a/p) = s*(x/y), with y odd
+        while (is_felm_even(x)) {
+            mp_shiftr1(x, NWORDS_FIELD);
+            r = y[0] & 7;
+            if (r == 3 || r == 5) {       // (2/y) = -1 iff y = 3, 5 mod 8
+                s = -s;
+            }
+        }
+        if (is_felm_lt(x, y)) {           // Quadratic reciprocity
+            t = x; x = y; y = t;
+            if ((x[0] & 3) == 3 && (y[0] & 3) == 3) {
+                s = -s;
+            }
+        }
+        mp_sub(x, y, x, NWORDS_FIELD);
+    }
+    return s;                             // y = gcd(a, p) = 1
+}
+
+
+unsigned char is_sqr_fp2_vartime(const f2elm_t a)
+{ // Test if a is a square in GF(p^2) and return 1 if true, 0 otherwise, from the Legendre symbol of its norm. Much faster
+  // than is_sqr_fp2(), which exponentiates the norm, but does not give a partial square root.
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public values.
+    felm_t a0, a1, z;
+
+    fpsqr_mont(a[0], a0);
+    fpsqr_mont(a[1], a1);
+    fpadd(a0, a1, z);
+    from_mont(z, z);
+    return (unsigned char)(jacobi_fp(z) >= 0);
+}
+
+
 void sqrt_Fp2(const f2elm_t u, f2elm_t y)
 { // Computes square roots of elements in (Fp2)^2 using Hamburg's trick. 
     felm_t t0, t1, t2, t3;
@@ -1015,28 +1251,11 @@ void sqrt_Fp2(const f2elm_t u, f2elm_t y)
 }
 
 
-static __inline void power2_setup(digit_t* x, int mark, const unsigned int nwords)
-{ // Set up the value 2^mark.
-    unsigned int i;
-
-    for (i = 0; i < nwords; i++) x[i] = 0;
-
-    i = 0;
-    while (mark >= 0) {
-        if (mark < RADIX) {
-            x[i] = (digit_t)1 << mark;
-        }
-        mark -= RADIX;
-        i += 1;
-    }    
-}
-
-
 int8_t cmp_f2elm(const f2elm_t x, const f2elm_t y)
 { // Comparison of two GF(p^2) elements in constant time. 
   // Is x != y? return -1 if condition is true, 0 otherwise.
     f2elm_t a, b;      
-    uint8_t r = 0;
+    digit_t r = 0;
     
     fp2copy(x, a);
     fp2copy(y, b);
@@ -1046,28 +1265,7 @@ int8_t cmp_f2elm(const f2elm_t x, const f2elm_t y)
     for (int i = NWORDS_FIELD-1; i >= 0; i--)
         r |= (a[0][i] ^ b[0][i]) | (a[1][i] ^ b[1][i]);
 
-    return (-(int8_t)r) >> (8*sizeof(uint8_t)-1);
-}
-
-
-static __inline unsigned int is_felm_even(const felm_t x)
-{ // Is x even? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
-    return (unsigned int)((x[0] & 1) ^ 1);
-}
-
-
-static __inline unsigned int is_felm_lt(const felm_t x, const felm_t y)
-{ // Is x < y? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
-  // SECURITY NOTE: This function does not run in constant-time.
-
-    for (int i = NWORDS_FIELD-1; i >= 0; i--) {
-        if (x[i] < y[i]) { 
-            return true;
-        } else if (x[i] > y[i]) {
-            return false;
-        }
-    }
-    return false;
+    return (int8_t)(0 - (int8_t)((r | (0 - r)) >> (RADIX-1)));
 }
 
 
@@ -1086,101 +1284,6 @@ static __inline unsigned int is_orderelm_lt(const digit_t *x, const digit_t *y)
 }
 
 
-static __inline void fpinv_mont_bingcd_partial(const felm_t a, felm_t x1, unsigned int* k)
-{ // Partial Montgomery inversion via the binary GCD algorithm.
-    felm_t u, v, x2;
-    unsigned int cwords;  // Number of words necessary for x1, x2
-
-    fpcopy(a, u);
-    fpcopy((digit_t*)PRIME, v);
-    fpzero(x1); x1[0] = 1;
-    fpzero(x2);
-    *k = 0;
-
-    while (!is_felm_zero(v)) {
-        cwords = ((*k + 1) / RADIX) + 1;
-        if ((cwords < NWORDS_FIELD)) {
-            if (is_felm_even(v)) {
-                mp_shiftr1(v, NWORDS_FIELD);
-                mp_shiftl1(x1, cwords);
-            } else if (is_felm_even(u)) {
-                mp_shiftr1(u, NWORDS_FIELD);
-                mp_shiftl1(x2, cwords);
-            } else if (!is_felm_lt(v, u)) {
-                mp_sub(v, u, v, NWORDS_FIELD);
-                mp_shiftr1(v, NWORDS_FIELD);
-                mp_add(x1, x2, x2, cwords);
-                mp_shiftl1(x1, cwords);
-            } else {
-                mp_sub(u, v, u, NWORDS_FIELD);
-                mp_shiftr1(u, NWORDS_FIELD);
-                mp_add(x1, x2, x1, cwords);
-                mp_shiftl1(x2, cwords);
-            }
-        } else {
-            if (is_felm_even(v)) {
-                mp_shiftr1(v, NWORDS_FIELD);
-                mp_shiftl1(x1, NWORDS_FIELD);
-            } else if (is_felm_even(u)) {
-                mp_shiftr1(u, NWORDS_FIELD);
-                mp_shiftl1(x2, NWORDS_FIELD);
-            } else if (!is_felm_lt(v, u)) {
-                mp_sub(v, u, v, NWORDS_FIELD);
-                mp_shiftr1(v, NWORDS_FIELD);
-                mp_add(x1, x2, x2, NWORDS_FIELD);
-                mp_shiftl1(x1, NWORDS_FIELD);
-            } else {
-                mp_sub(u, v, u, NWORDS_FIELD);
-                mp_shiftr1(u, NWORDS_FIELD);
-                mp_add(x1, x2, x1, NWORDS_FIELD);
-                mp_shiftl1(x2, NWORDS_FIELD);
-            }
-        }
-        *k += 1;
-    }
-
-    if (is_felm_lt((digit_t*)PRIME, x1)) {
-        mp_sub(x1, (digit_t*)PRIME, x1, NWORDS_FIELD);
-    }
-}
-
-
-void fpinv_mont_bingcd(felm_t a)
-{ // Field inversion via the binary GCD using Montgomery arithmetic, a = a^-1*r' mod p.
-  // SECURITY NOTE: This function does not run in constant-time and is therefore only suitable for 
-  //                operations not involving any secret data.
-    felm_t x, t;
-    unsigned int k;
-
-    if (is_felm_zero(a) == true)
-        return;
-
-    fpinv_mont_bingcd_partial(a, x, &k);
-    if (k <= MAXBITS_FIELD) { 
-        fpmul_mont(x, (digit_t*)&Montgomery_R2, x);
-        k += MAXBITS_FIELD;
-    }
-    fpmul_mont(x, (digit_t*)&Montgomery_R2, x);
-    power2_setup(t, 2*MAXBITS_FIELD - k, NWORDS_FIELD);
-    fpmul_mont(x, t, a);
-}
-
-
-void fp2inv_mont_bingcd(f2elm_t a)
-{// GF(p^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2)
- // This uses the binary GCD for inversion in fp and is NOT constant time!!!
-    f2elm_t t1;
-
-    fpsqr_mont(a[0], t1[0]);             // t10 = a0^2
-    fpsqr_mont(a[1], t1[1]);             // t11 = a1^2
-    fpadd(t1[0], t1[1], t1[0]);          // t10 = a0^2+a1^2
-    fpinv_mont_bingcd(t1[0]);            // t10 = (a0^2+a1^2)^-1
-    fpneg(a[1]);                         // a = a0-i*a1
-    fpmul_mont(a[0], t1[0], a[0]);
-    fpmul_mont(a[1], t1[0], a[1]);       // a = (a0-i*a1)*(a0^2+a1^2)^-1
-}
-
-
 void mont_n_way_inv(const f2elm_t* vec, const int n, f2elm_t* out)
 { // n-way simultaneous inversion using Montgomery's trick.
   // SECURITY NOTE: This function does not run in constant time.
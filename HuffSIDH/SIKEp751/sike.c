@@ -27,11 +27,64 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
 }
 
 
+typedef int (*keygen_t)(const unsigned char* PrivateKey, unsigned char* PublicKey);
+// Shared key computation of an encapsulation, peer is Bob's public key in the form that the function takes (encoded key or handle)
+typedef int (*agreement_t)(const unsigned char* PrivateKey, const void* peer, unsigned char* SharedSecret);
+
+#ifdef PARALLEL_ENCAPSULATION
+typedef struct {
+    keygen_t keygen;
+    const unsigned char* sk;
+    unsigned char* pk;
+    int status;                  // Return value of keygen, read by the caller after task_pool_join()
+} keygen_task_t;
+
+static void keygen_task(void* arg)
+{
+    keygen_task_t* t = (keygen_task_t*)arg;
+    t->status = t->keygen(t->sk, t->pk);
+}
+#endif
+
+
+static int encrypt_A(keygen_t keygen, agreement_t agreement, const unsigned char* ephemeralsk, const void* peer, unsigned char* ct, unsigned char* jinvariant)
+{ // Computes Alice's public key ct from ephemeralsk and the shared j-invariant with Bob's public key peer, passed as is to agreement.
+  // Both only depend on ephemeralsk: with "make PARALLEL_ENCAPS=TRUE", the public key is computed by the worker thread of the task pool
+  // (see parallel.c) while the calling thread computes the j-invariant.
+  // Returns 0 on success, or 1 if keygen or agreement fails (e.g., peer is rejected), in which case ct and jinvariant must not be used.
+#ifdef PARALLEL_ENCAPSULATION
+    keygen_task_t task = { keygen, ephemeralsk, ct, 1 };
+    unsigned long ticket;
+    int status;
+
+    if (task_pool_submit(keygen_task, &task, &ticket) == 0) {
+        status = agreement(ephemeralsk, peer, jinvariant);
+        task_pool_join(ticket);
+        return (status != 0 || task.status != 0);
+    }
+#endif
+    // The agreement goes first, so that a rejected public key costs no key generation
+    if (agreement(ephemeralsk, peer, jinvariant) != 0) {
+        return 1;
+    }
+    return (keygen(ephemeralsk, ct) != 0);
+}
+
+
+static int agreement_A(const unsigned char* PrivateKeyA, const void* peer, unsigned char* SharedSecretA)
+{ // EphemeralSecretAgreement_A() as an agreement_t, peer is Bob's encoded public key
+    const unsigned char* PublicKeyB = peer;
+
+    return EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+}
+
+
 int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
 { // SIKE's encapsulation
   // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
   //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+  // Returns 1 if pk is rejected by the public key validation of EphemeralSecretAgreement_A(), in which case ct and ss are not set.
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
     unsigned char h[MSG_BYTES];
@@ -44,8 +97,9 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Encrypt
-    EphemeralKeyGeneration_A(ephemeralsk, ct);
-    EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
+    if (encrypt_A(EphemeralKeyGeneration_A, agreement_A, ephemeralsk, pk, ct, jinvariant) != 0) {
+        return 1;
+    }
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
         ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
@@ -70,25 +124,254 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
     unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
 
-    // Decrypt
-    EphemeralSecretAgreement_B(sk + MSG_BYTES, ct, jinvariant_);
-    shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+    // Decrypt. A ciphertext rejected by the public key validation of EphemeralSecretAgreement_B() fails the verification
+    // right away, without any isogeny computation: the ciphertext is public, only its validity is revealed by the timing
+    int8_t selector = -1;
+    if (EphemeralSecretAgreement_B(sk + MSG_BYTES, ct, jinvariant_) == 0) {
+        shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+        for (int i = 0; i < MSG_BYTES; i++) {
+            temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        }
+
+        // Generate ephemeralsk_ <- G(m||pk) mod oA
+        memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+        shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+        ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+        // Verify ct: re-encrypt m
+        EphemeralKeyGeneration_A(ephemeralsk_, c0_);
+        selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
+    }
+
+    // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+    ct_cmov(temp, sk, MSG_BYTES, selector);
+    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+
+    return 0;
+}
+
+// HUFF SIKE
+// Same KEM as above on top of the Huff key exchange functions. Public keys and ciphertexts are Huff public keys, so
+// the *_Huff functions only interoperate with each other.
+
+int crypto_kem_keypair_Huff(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation using Huff curves
+  // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+
+    // Generate lower portion of secret key sk <- s||SK
+    randombytes(sk, MSG_BYTES);
+    random_mod_order_B(sk + MSG_BYTES);
+
+    // Generate public key pk
+    EphemeralKeyGeneration_B_Huff(sk + MSG_BYTES, pk);
+
+    // Append public key pk to secret key sk
+    memcpy(&sk[MSG_BYTES + SECRETKEY_B_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
+
+    return 0;
+}
+
+
+static int agreement_A_Huff_pk(const unsigned char* PrivateKeyA, const void* peer, unsigned char* SharedSecretA)
+{ // EphemeralSecretAgreement_A_Huff_pk() as an agreement_t, peer is the pk_handle_t of Bob's public key
+    const pk_handle_t* handle = peer;
+
+    return EphemeralSecretAgreement_A_Huff_pk(PrivateKeyA, handle, SharedSecretA);
+}
+
+
+int crypto_kem_enc_Huff_pk(unsigned char *ct, unsigned char *ss, const pk_handle_t *pk)
+{ // SIKE's encapsulation using Huff curves, with the handle of the public key
+  // Input:   handle of the public key pk (see pk_handle_init_B_Huff())
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+  // Returns 1 if the ephemeral key generation or the shared key computation fails.
+    unsigned char ephemeralsk[SECRETKEY_A_BYTES];
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    unsigned char h[MSG_BYTES];
+    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+
+    // Generate ephemeralsk <- G(m||pk) mod oA 
+    randombytes(temp, MSG_BYTES);
+    memcpy(&temp[MSG_BYTES], pk->pk, CRYPTO_PUBLICKEYBYTES);
+    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+    // Encrypt
+    if (encrypt_A(EphemeralKeyGeneration_A_Huff, agreement_A_Huff_pk, ephemeralsk, pk, ct, jinvariant) != 0) {
+        return 1;
+    }
+    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+
+    return 0;
+}
+
+
+int crypto_kem_enc_Huff(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using Huff curves
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+  // Returns 1 if pk is rejected by pk_handle_init_B_Huff().
+    pk_handle_t handle;
+
+    if (pk_handle_init_B_Huff(&handle, pk) != 0) {
+        return 1;
+    }
+    return crypto_kem_enc_Huff_pk(ct, ss, &handle);
+}
+
+
+int crypto_kem_dec_Huff(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation using Huff curves
+  // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes) 
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[FP2_ENCODED_BYTES];
+    unsigned char h_[MSG_BYTES];
+    unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
+    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+
+    // Decrypt. A ciphertext rejected by the public key validation of EphemeralSecretAgreement_B_Huff() fails the verification
+    // right away, without any isogeny computation: the ciphertext is public, only its validity is revealed by the timing
+    int8_t selector = -1;
+    if (EphemeralSecretAgreement_B_Huff(sk + MSG_BYTES, ct, jinvariant_) == 0) {
+        shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+        for (int i = 0; i < MSG_BYTES; i++) {
+            temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        }
+
+        // Generate ephemeralsk_ <- G(m||pk) mod oA
+        memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+        shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+        ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+        // Verify ct: re-encrypt m
+        EphemeralKeyGeneration_A_Huff(ephemeralsk_, c0_);
+        selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
     }
 
-    // Generate ephemeralsk_ <- G(m||pk) mod oA
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
-    ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
-    
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
-    EphemeralKeyGeneration_A(ephemeralsk_, c0_);
     // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
-    int8_t selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
     ct_cmov(temp, sk, MSG_BYTES, selector);
     memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
     shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
 
     return 0;
-}
\ No newline at end of file
+}
+
+
+#ifdef COMPRESS
+// SIKE on Huff curves with compressed public keys and ciphertexts ("make COMPRESS=TRUE"). The hashes G and H and the
+// re-encryption check of the decapsulation are computed on the compressed public key and ciphertext.
+
+int crypto_kem_keypair_Huff_compressed(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation using Huff curves, with the public key compressed
+  // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES_COMPRESSED = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES_COMPRESSED bytes)
+  //          public key pk (CRYPTO_PUBLICKEYBYTES_COMPRESSED bytes) 
+
+    // Generate lower portion of secret key sk <- s||SK
+    randombytes(sk, MSG_BYTES);
+    random_mod_order_B(sk + MSG_BYTES);
+
+    // Generate public key pk
+    EphemeralKeyGeneration_B_Huff_compressed(sk + MSG_BYTES, pk);
+
+    // Append public key pk to secret key sk
+    memcpy(&sk[MSG_BYTES + SECRETKEY_B_BYTES], pk, CRYPTO_PUBLICKEYBYTES_COMPRESSED);
+
+    return 0;
+}
+
+
+int crypto_kem_enc_Huff_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using Huff curves, with the public key and the ciphertext compressed
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES_COMPRESSED bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES_COMPRESSED = CRYPTO_PUBLICKEYBYTES_COMPRESSED + MSG_BYTES bytes)
+  // Returns 1 if pk does not decompress to a valid public key.
+    pk_handle_t handle;
+    unsigned char pkB[CRYPTO_PUBLICKEYBYTES];
+    unsigned char c0[CRYPTO_PUBLICKEYBYTES];
+    unsigned char ephemeralsk[SECRETKEY_A_BYTES];
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    unsigned char h[MSG_BYTES];
+    unsigned char temp[CRYPTO_CIPHERTEXTBYTES_COMPRESSED+MSG_BYTES];
+
+    if (PublicKeyDecompression_B_Huff(pk, pkB) != 0 || pk_handle_init_B_Huff(&handle, pkB) != 0) {
+        return 1;
+    }
+
+    // Generate ephemeralsk <- G(m||pk) mod oA 
+    randombytes(temp, MSG_BYTES);
+    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES_COMPRESSED);
+    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES_COMPRESSED+MSG_BYTES);
+    ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+    // Encrypt
+    if (encrypt_A(EphemeralKeyGeneration_A_Huff, agreement_A_Huff_pk, ephemeralsk, &handle, c0, jinvariant) != 0) {
+        return 1;
+    }
+    PublicKeyCompression_A_Huff(c0, ct);
+    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
+    for (int i = 0; i < MSG_BYTES; i++) {
+        ct[i + CRYPTO_PUBLICKEYBYTES_COMPRESSED] = temp[i] ^ h[i];
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES_COMPRESSED);
+    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES_COMPRESSED+MSG_BYTES);
+
+    return 0;
+}
+
+
+int crypto_kem_dec_Huff_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation using Huff curves, with the public key and the ciphertext compressed
+  // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES_COMPRESSED = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES_COMPRESSED bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES_COMPRESSED = CRYPTO_PUBLICKEYBYTES_COMPRESSED + MSG_BYTES bytes) 
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[FP2_ENCODED_BYTES];
+    unsigned char h_[MSG_BYTES];
+    unsigned char c0[CRYPTO_PUBLICKEYBYTES];
+    unsigned char c0_[CRYPTO_PUBLICKEYBYTES_COMPRESSED];
+    unsigned char temp[CRYPTO_CIPHERTEXTBYTES_COMPRESSED+MSG_BYTES];
+
+    // Decrypt. A ciphertext that does not decompress to a valid public key fails the verification right away (see crypto_kem_dec_Huff())
+    int8_t selector = -1;
+    if (PublicKeyDecompression_A_Huff(ct, c0) == 0 && EphemeralSecretAgreement_B_Huff(sk + MSG_BYTES, c0, jinvariant_) == 0) {
+        shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+        for (int i = 0; i < MSG_BYTES; i++) {
+            temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES_COMPRESSED] ^ h_[i];
+        }
+
+        // Generate ephemeralsk_ <- G(m||pk) mod oA
+        memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES_COMPRESSED);
+        shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES_COMPRESSED+MSG_BYTES);
+        ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+        // Verify ct: re-encrypt m, and compress
+        EphemeralKeyGeneration_A_Huff_compressed(ephemeralsk_, c0_);
+        selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES_COMPRESSED);
+    }
+
+    // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    ct_cmov(temp, sk, MSG_BYTES, selector);
+    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES_COMPRESSED);
+    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES_COMPRESSED+MSG_BYTES);
+
+    return 0;
+}
+#endif
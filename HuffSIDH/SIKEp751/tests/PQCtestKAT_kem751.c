@@ -20,6 +20,11 @@
 #define KAT_DATA_ERROR      -3
 #define KAT_CRYPTO_FAILURE  -4
 
+#ifndef KAT_NAME                      // Response file and scheme name, set by PQCtestKAT_kem751_Huff.c
+    #define KAT_NAME    "PQCkemKAT"
+    #define KAT_ALGNAME CRYPTO_ALGNAME
+#endif
+
 int     FindMarker(FILE *infile, const char *marker);
 int     ReadHex(FILE *infile, unsigned char *A, int Length, char *str);
 void    fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L);
@@ -36,13 +41,13 @@ main()
     unsigned char       pk[CRYPTO_PUBLICKEYBYTES], sk[CRYPTO_SECRETKEYBYTES], pk_rsp[CRYPTO_PUBLICKEYBYTES], sk_rsp[CRYPTO_SECRETKEYBYTES];
     int                 ret_val;
     
-    sprintf(fn_rsp, "../../../KAT/PQCkemKAT_%d.rsp", CRYPTO_SECRETKEYBYTES);
+    sprintf(fn_rsp, "../../../KAT/%s_%d.rsp", KAT_NAME, CRYPTO_SECRETKEYBYTES);
     if ( (fp_rsp = fopen(fn_rsp, "r")) == NULL ) {
         printf("Couldn't open <%s> for read\n", fn_rsp);
         return KAT_FILE_OPEN_ERROR;
     }
     
-    printf("# %s\n\n", CRYPTO_ALGNAME);
+    printf("# %s\n\n", KAT_ALGNAME);
     done = 0;
     do {
         if ( FindMarker(fp_rsp, "count = ") ) {
@@ -8,6 +8,7 @@
 #include <string.h>
 #include "test_extras.h"
 #include "../P751/api.h"
+#include "../sha3/fips202.h"
 
 
 #define SCHEME_NAME    "SIKEp751"
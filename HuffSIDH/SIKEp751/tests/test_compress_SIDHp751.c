@@ -0,0 +1,25 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing and benchmarking the primitives of the public key compression of SIDHp751
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P751/P751_internal.h"
+#include "../internal.h"
+
+
+#define SCHEME_NAME        "SIDHp751"
+#define fp2copy_test       fp2copy751
+#define fp2sqr_test        fp2sqr751_mont
+#define fp2mul_test        fp2mul751_mont
+#define fp2add_test        fp2add751
+#define fp2div2_test       fp2div2_751
+#define fp2inv_test        fp2inv751_mont_bingcd
+#define fp2random_test     fp2random751_test
+
+
+
+#include "test_compress.c"
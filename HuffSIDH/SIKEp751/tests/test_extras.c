@@ -11,6 +11,13 @@
 #if (OS_TARGET == OS_NIX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
     #include <time.h>
 #endif
+#if (OS_TARGET == OS_NIX) && defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <string.h>
+#endif
 #include <stdlib.h>
 
 
@@ -51,6 +58,63 @@ int64_t cpucycles(void)
 }
 
 
+int cachemisses_open(void)
+{ // Opens a counter of the L1 data cache read misses of the calling thread. Returns -1 if the counter is not available
+#if (OS_TARGET == OS_NIX) && defined(__linux__)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+
+void cachemisses_start(int counter)
+{ // Resets and starts the counter
+#if (OS_TARGET == OS_NIX) && defined(__linux__)
+    if (counter < 0) return;
+    ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+#else
+    (void)counter;
+#endif
+}
+
+
+int64_t cachemisses_stop(int counter)
+{ // Stops the counter and returns the number of misses since cachemisses_start(), or -1 if the counter is not available
+#if (OS_TARGET == OS_NIX) && defined(__linux__)
+    int64_t count;
+
+    if (counter < 0) return -1;
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(counter, &count, sizeof(count)) != sizeof(count)) return -1;
+    return count;
+#else
+    (void)counter;
+    return -1;
+#endif
+}
+
+
+void cachemisses_close(int counter)
+{
+#if (OS_TARGET == OS_NIX) && defined(__linux__)
+    if (counter >= 0) close(counter);
+#else
+    (void)counter;
+#endif
+}
+
+
 int compare_words(digit_t* a, digit_t* b, unsigned int nwords)
 { // Comparing "nword" elements, a=b? : (1) a>b, (0) a=b, (-1) a<b
   // SECURITY NOTE: this function does not have constant-time execution. TO BE USED FOR TESTING ONLY.
@@ -23,6 +23,13 @@
 // Access system counter for benchmarking
 int64_t cpucycles(void);
 
+// Counting L1 data cache misses for benchmarking (Linux perf events). The functions are no-ops and cachemisses_stop() returns -1
+// when the counter is not available
+int cachemisses_open(void);
+void cachemisses_start(int counter);
+int64_t cachemisses_stop(int counter);
+void cachemisses_close(int counter);
+
 // Comparing "nword" elements, a=b? : (1) a!=b, (0) a=b
 int compare_words(digit_t* a, digit_t* b, unsigned int nwords);
 
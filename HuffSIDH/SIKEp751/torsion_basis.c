@@ -0,0 +1,140 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: deterministic torsion bases of Montgomery curves for the compression of public keys
+*********************************************************************************************/
+
+
+static void mul_ell_e(point_proj_t P, const unsigned int ell, const int e, const f2elm_t A24plus, const f2elm_t C24, const f2elm_t A24minus)
+{ // P = [ell^e]P on the Montgomery curve with constants A24plus = A+2C, C24 = 4C and A24minus = A-2C, for ell = 2, 3 or 5
+    if (e == 0) {
+        return;
+    } else if (ell == 2) {
+        xDBLe(P, P, A24plus, C24, e);
+    } else if (ell == 3) {
+        xTPLe(P, P, A24minus, A24plus, e);
+    } else {
+#if (EXPON_5 > 0)
+        x5Pe(P, P, A24plus, C24, e);
+#endif
+    }
+}
+
+
+static void curve_rhs(const f2elm_t A, const f2elm_t x, f2elm_t y2)
+{ // y2 = x^3 + A*x^2 + x, the right-hand side of E_A at x
+    f2elm_t t0, one = {0};
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2add(x, A, t0);
+    fp2mul_mont(t0, x, t0);
+    fp2add(t0, one, t0);
+    fp2mul_mont(t0, x, y2);
+}
+
+
+static unsigned int basis_candidate(const f2elm_t A, const unsigned int k, f2elm_t x)
+{ // k-th candidate abscissa x of a point of E_A. The first TABLE_R_LEN candidates come from the Elligator 2 map: for x = -A*v with
+  // v = 1/(1 + u*r^2) in basis_table, x^3 + A*x^2 + x and the right-hand side at -A - x = u*r^2*x differ by the non-square factor
+  // u*r^2, so that exactly one of them is a square and every candidate is on E_A. The next ones, and all of them if A = 0, are
+  // x = k' + i for k' = 1, 2, ..., which are on E_A about half of the time. Returns 1 if x is on E_A.
+    f2elm_t t0 = {0};
+
+    if (k < TABLE_R_LEN && !is_fp2_zero(A)) {
+        copy_words((const digit_t*)basis_table[k], (digit_t*)x, 2*NWORDS_FIELD);
+        fp2mul_mont(A, x, x);
+        fp2neg(x);                        // x = -A*v
+        curve_rhs(A, x, t0);
+        if (!is_sqr_fp2_vartime(t0)) {
+            fp2add(x, A, x);
+            fp2neg(x);                    // x = -A - x
+        }
+        return 1;
+    }
+    t0[0][0] = (digit_t)(k + 1 - (is_fp2_zero(A) ? 0 : TABLE_R_LEN));
+    t0[1][0] = 1;
+    to_fp2mont(t0, x);                    // x = k' + i
+    curve_rhs(A, x, t0);
+    return (unsigned int)is_sqr_fp2_vartime(t0);
+}
+
+
+static unsigned int is_equal_x(const point_proj_t P, const point_proj_t Q)
+{ // Is x(P) = x(Q)? return 1 (TRUE) if condition is true, 0 (FALSE) otherwise.
+    f2elm_t t0, t1;
+
+    fp2mul_mont(P->X, Q->Z, t0);
+    fp2mul_mont(Q->X, P->Z, t1);
+    fp2sub(t0, t1, t0);
+    return is_fp2_zero(t0);
+}
+
+
+int torsion_basis(const f2elm_t A, const torsion_t* T, point_t R1, point_t R2)
+{ // Deterministic basis {R1, R2} of E_A[ell^e] in affine coordinates, for the Montgomery curve E_A: y^2 = x^3 + A*x^2 + x.
+  // R1 and R2 are the first two points [(p+1)/ell^e](x, y) of full order, with R2 independent from R1, for the candidate abscissas
+  // x of basis_candidate(), and the y-coordinates computed by CompleteMPoint(). Both sides of a compressed public key thus get the
+  // same basis. For ell = 2, the point R of full order above the 2-torsion point [2^(e-1)]R has a square x-coordinate x if and
+  // only if [2^(e-1)]R is O or (0,0), on the curves with E_A(GF(p^2)) = (Z/(p+1)Z)^2 of the public keys. Then R1 is the first
+  // point with a non-square x, which has full order, and R2 the first one with a square x and [2^(e-1)]R2 = (0,0), which is
+  // independent from R1, so that only R2 needs the doublings by 2^(e-1).
+  // Returns 1 if there is no such basis for the first MAX_BASIS_TRIES values of x, which only happens if A is not a
+  // supersingular curve with full rational ell^e-torsion.
+  // SECURITY NOTE: This function does not run in constant time. It is only used on public values.
+    point_proj_t R[2], K[2], K2;
+    point_full_proj_t S;
+    f2elm_t x, t0, one = {0}, A24plus, C24, A24minus;
+    unsigned int found = 0, k;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2add(one, one, t0);
+    fp2add(A, t0, A24plus);               // A24plus = A+2
+    fp2sub(A, t0, A24minus);              // A24minus = A-2
+    fp2add(t0, t0, C24);                  // C24 = 4
+
+    for (k = 0; k < MAX_BASIS_TRIES && found < 2; k++) {
+        if (!basis_candidate(A, k, x)) {
+            continue;
+        }
+        if (T->ell == 2 && is_sqr_fp2_vartime(x) != found) {
+            continue;
+        }
+        fp2copy(x, R[found]->X);
+        fp2copy(one, R[found]->Z);
+        mul_ell_e(R[found], 2, (T->ell == 2) ? 0 : EXPON_2, A24plus, C24, A24minus);
+        mul_ell_e(R[found], 3, (T->ell == 3) ? 0 : EXPON_3, A24plus, C24, A24minus);
+        mul_ell_e(R[found], 5, (T->ell == 5) ? 0 : EXPON_5, A24plus, C24, A24minus);
+        if (T->ell == 2 && found == 0) {
+            found++;
+            continue;
+        }
+        copy_words((digit_t*)R[found], (digit_t*)K[found], 2*2*NWORDS_FIELD);
+        mul_ell_e(K[found], T->ell, T->e - 1, A24plus, C24, A24minus);   // K = [ell^(e-1)]R has order ell iff R has order ell^e
+        if (is_fp2_zero(K[found]->Z)) {
+            continue;
+        }
+        if (found == 1 && T->ell != 2) {  // R2 is independent from R1 iff K[1] is not in <K[0]> = {O, +-K[0], +-2K[0]}
+            if (is_equal_x(K[0], K[1])) {
+                continue;
+            }
+            if (T->ell == 5) {
+                xDBL(K[0], K2, A24plus, C24);
+                if (is_equal_x(K2, K[1])) {
+                    continue;
+                }
+            }
+        }
+        found++;
+    }
+    if (found < 2) {
+        return 1;
+    }
+
+    CompleteMPoint(A, R[0], S);
+    fp2copy(S->X, R1->x);
+    fp2copy(S->Y, R1->y);
+    CompleteMPoint(A, R[1], S);
+    fp2copy(S->X, R2->x);
+    fp2copy(S->Y, R2->y);
+    return 0;
+}
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Table generator for the windowed Pohlig-Hellman discrete logarithms of dlog.c.
+
+For every torsion subgroup E[ell^e] carried by the public keys (one "#define W_<ell> <w>" per ell in the internal
+header of the parameter set), the discrete logarithms are taken in the subgroup of order ell^e of GF(p^2)*, in base a
+fixed generator g of that subgroup: the first (k + i)^((p^2-1)/ell^e), k = 1, 2, ..., of order ell^e. The logarithms
+are written with n = ceil(e/w) signed digits: x = d_0 + ell^r*(d_1 + d_2*ell^w + ... + d_(n-1)*ell^(w*(n-2))), with
+r = e - w*(n-1) in [1, w], |d_0| <= ell^r/2 and |d_k| <= ell^w/2 otherwise. The generator writes, for each ell:
+  ph<ell>_table[i][j-1]  = g^(j*ell^(r+w*i)), for i = 0, ..., n-2 and j = 1, ..., ell^w/2,
+  ph<ell>_table0[j-1]    = g^j, for j = 1, ..., ell^r/2,
+  ph<ell>_path[z]        = number of leaves of the left subtree of a subtree with z leaves in the optimal traversal,
+in Montgomery representation, where the inverse of a table entry is its conjugate (the entries have norm 1). The
+traversal minimizes the cost of its exponentiations by ell^w ("down" steps, in field multiplications COST_EXP[ell]
+per exponentiation by ell) and of its table multiplications ("right" steps, COST_MUL per digit).
+
+Usage, from a SIKEp<N> tree (run by its makefile):
+  python3 ../dloggen.py P610/P610_internal.h P610/P610_dlog_tables.h
+"""
+
+import re
+import sys
+
+
+COST_EXP = {2: 2, 3: 3, 5: 7}  # Field multiplications of sqr_Fp2_cycl, cube_Fp2_cycl and pow5_Fp2_cycl
+COST_MUL = 3                    # Field multiplications of fp2mul_mont
+WORDS_PER_LINE = 6              # 64-bit words per line of the generated tables
+
+
+def read_params(header):
+    text = open(header).read()
+    defines = dict(re.findall(r'^\s*#define\s+(\w+)\s+(\d+)\b', text, re.M))
+    expon = {ell: int(defines.get('EXPON_%d' % ell, 0)) for ell in (2, 3, 5)}
+    windows = {int(ell): int(w) for ell, w in re.findall(r'^\s*#define\s+W_(\d+)\s+(\d+)\b', text, re.M)}
+    name = re.search(r'^\s*#define\s+PRIME\s+(\w+)', text, re.M).group(1)
+    return name, expon, windows
+
+
+class Fp2:
+    """GF(p^2) = GF(p)[i]/(i^2 + 1)"""
+    def __init__(self, p):
+        self.p = p
+
+    def mul(self, a, b):
+        p = self.p
+        return ((a[0]*b[0] - a[1]*b[1]) % p, (a[0]*b[1] + a[1]*b[0]) % p)
+
+    def conj(self, a):
+        return (a[0], (-a[1]) % self.p)
+
+    def inv(self, a):
+        p = self.p
+        n = pow(a[0]*a[0] + a[1]*a[1], p - 2, p)
+        return (a[0]*n % p, (-a[1]*n) % p)
+
+    def pow(self, a, k):
+        r = (1, 0)
+        for bit in bin(k)[2:]:
+            r = self.mul(r, r)
+            if bit == '1':
+                r = self.mul(r, a)
+        return r
+
+
+def generator(F, p, ell, e):
+    """First (k + i)^((p^2-1)/ell^e), k = 1, 2, ..., of order ell^e"""
+    k = 1
+    while True:
+        a = (k, 1)
+        z = F.mul(F.conj(a), F.inv(a))                  # z = a^(p-1), of norm 1
+        g = F.pow(z, (p + 1) // ell**e)
+        if F.pow(g, ell**(e - 1)) != (1, 0):
+            return g
+        k += 1
+
+
+def optimal_path(n, p, q):
+    """path[z] = leaves of the left subtree of a subtree with z leaves, minimizing the cost with p per down step and q per right step"""
+    cost = [0]*(n + 1)
+    path = [0]*(n + 1)
+    for z in range(2, n + 1):
+        best = None
+        for t in range(1, z):
+            c = cost[t] + cost[z - t] + (z - t)*p + t*q
+            if best is None or c < best:
+                best, path[z] = c, t
+        cost[z] = best
+    return path
+
+
+def words(x, n):
+    return ['0x%016X' % ((x >> (64*i)) & 0xFFFFFFFFFFFFFFFF) for i in range(n)]
+
+
+def emit_elements(out, name, size, elements, p, nwords):
+    R = 1 << (64*nwords)
+    out.append('static const uint64_t %s[%s][2*NWORDS64_FIELD] = {' % (name, size))
+    for idx, a in enumerate(elements):
+        w = words(a[0]*R % p, nwords) + words(a[1]*R % p, nwords)
+        lines = [', '.join(w[i:i + WORDS_PER_LINE]) for i in range(0, len(w), WORDS_PER_LINE)]
+        out.append('    { ' + ',\n      '.join(lines) + ' }' + (',' if idx < len(elements) - 1 else ''))
+    out.append('};')
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    name, expon, windows = read_params(sys.argv[1])
+    p = 2**expon[2] * 3**expon[3] * 5**expon[5] - 1
+    nwords = (p.bit_length() + 63) // 64
+    F = Fp2(p)
+
+    out = ['/********************************************************************************************',
+           '* Supersingular Isogeny Key Encapsulation Library',
+           '*',
+           '* Abstract: tables of the Pohlig-Hellman discrete logarithms for %s, generated by dloggen.py (do not edit)' % name.upper(),
+           '*********************************************************************************************/',
+           '']
+    for ell in sorted(windows):
+        w, e = windows[ell], expon[ell]
+        n = (e + w - 1) // w
+        r = e - w*(n - 1)
+        g = generator(F, p, ell, e)
+        half, half0 = ell**w // 2, ell**r // 2
+
+        table = []
+        for i in range(n - 1):
+            b = F.pow(g, ell**(r + w*i))
+            t = (1, 0)
+            for j in range(half):
+                t = F.mul(t, b)
+                table.append(t)
+        table0 = []
+        t = (1, 0)
+        for j in range(half0):
+            t = F.mul(t, g)
+            table0.append(t)
+        path = optimal_path(n, w*COST_EXP[ell], COST_MUL)
+
+        out.append('')
+        out.append('// Subgroup of order %d^%d: %d windows of W_%d = %d digits, the lowest one of %d digits' % (ell, e, n, ell, w, r))
+        out.append('#if (DLEN_%d != %d) || (ELL%d_W != %d) || (ELL%d_EMODW != %d)' % (ell, n, ell, ell**w, ell, ell**r))
+        out.append('    #error -- "the tables do not match the parameters of the discrete logarithms, regenerate them with dloggen.py"')
+        out.append('#endif')
+        emit_elements(out, 'ph%d_table' % ell, '(DLEN_%d-1)*(ELL%d_W/2)' % (ell, ell), table, p, nwords)
+        out.append('')
+        emit_elements(out, 'ph%d_table0' % ell, 'ELL%d_EMODW/2' % ell, table0, p, nwords)
+        out.append('')
+        out.append('static const unsigned int ph%d_path[PLEN_%d] = {' % (ell, ell))
+        for i in range(0, n + 1, 20):
+            out.append('    ' + ', '.join(str(x) for x in path[i:i + 20]) + (',' if i + 20 < n + 1 else ''))
+        out.append('};')
+
+    with open(sys.argv[2], 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
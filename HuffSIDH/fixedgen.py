@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Table generator for the fixed-base kernel computation of the Huff key generation (LADDER3PT_fixed_Huff in ec_isogeny.c).
+
+For the public generator Q of Alice (resp. Bob) on the starting Huff curve, with w-coordinate xQ read from A_gen_Huff
+(resp. B_gen_Huff) in the source of the parameter set, the generator writes
+  fixed_base_A[i] = {x_i+1, x_i-1}, for i = 0, ..., OALICE_BITS-1,
+  fixed_base_B[i] = {x_i+1, x_i-1}, for i = 0, ..., OBOB_BITS-2,
+in Montgomery representation, where x_i is the w-coordinate of [2^i]Q. The doublings follow xDBL_Huff with A24 = 1,
+i.e., (C-D)^2 = 4CD = 4. The differential additions only use the entries up to a common factor, so a multiple of order 2
+at infinity, (X_i:0), is written as {1, 1}.
+
+Usage, from a SIKEp<N> tree (run by its makefile):
+  python3 ../fixedgen.py P751/P751_internal.h P751/P751.c P751/P751_fixed_base_tables.h
+"""
+
+import re
+import sys
+
+
+WORDS_PER_LINE = 6              # 64-bit words per line of the generated tables
+
+
+def read_params(header):
+    text = open(header).read()
+    defines = dict(re.findall(r'^\s*#define\s+(\w+)\s+(\d+)\b', text, re.M))
+    name = re.search(r'^\s*#define\s+PRIME\s+(\w+)', text, re.M).group(1)
+    return name, int(defines['OALICE_BITS']), int(defines['OBOB_BITS'])
+
+
+def read_array(source, name):
+    """Value of the array of 64-bit words "const uint64_t name[...] = { ... };" of source"""
+    text = re.sub(r'//[^\n]*', '', source)
+    body = re.search(r'\bconst\s+uint64_t\s+%s\s*\[[^]]*\]\s*=\s*\{([^}]*)\}' % name, text).group(1)
+    return [int(w, 16) for w in re.findall(r'0x[0-9A-Fa-f]+', body)]
+
+
+def value(words):
+    return sum(w << (64*i) for i, w in enumerate(words))
+
+
+def double(P, p):
+    """xDBL_Huff with (C-D)^2 = 4CD = 4, on projective w-coordinates over GF(p^2) = GF(p)[i]/(i^2 + 1)"""
+    def add(a, b): return ((a[0] + b[0]) % p, (a[1] + b[1]) % p)
+    def sub(a, b): return ((a[0] - b[0]) % p, (a[1] - b[1]) % p)
+    def mul(a, b): return ((a[0]*b[0] - a[1]*b[1]) % p, (a[0]*b[1] + a[1]*b[0]) % p)
+    four = (4, 0)
+    X, Z = P
+    sp = mul(add(X, Z), add(X, Z))
+    sm = mul(sub(X, Z), sub(X, Z))
+    t = mul(sp, four)
+    xz4 = sub(sp, sm)
+    return (mul(xz4, add(t, mul(xz4, four))), mul(sm, t))
+
+
+def table(xQ, nbits, p):
+    entries = []
+    P = (xQ, (1, 0))
+    for i in range(nbits):
+        X, Z = P
+        if Z == (0, 0):
+            entries.append(((1, 0), (1, 0)))
+        else:
+            n = pow(Z[0]*Z[0] + Z[1]*Z[1], p - 2, p)
+            x = ((X[0]*Z[0] + X[1]*Z[1])*n % p, (X[1]*Z[0] - X[0]*Z[1])*n % p)
+            entries.append((((x[0] + 1) % p, x[1]), ((x[0] - 1) % p, x[1])))
+        P = double(P, p)
+    return entries
+
+
+def words(x, n):
+    return ['0x%016X' % ((x >> (64*i)) & 0xFFFFFFFFFFFFFFFF) for i in range(n)]
+
+
+def emit_table(out, name, size, entries, R, p, nwords):
+    out.append('static const uint64_t %s[%s][2][2*NWORDS64_FIELD] = {' % (name, size))
+    for idx, entry in enumerate(entries):
+        rows = []
+        for a in entry:
+            w = words(a[0]*R % p, nwords) + words(a[1]*R % p, nwords)
+            lines = [', '.join(w[i:i + WORDS_PER_LINE]) for i in range(0, len(w), WORDS_PER_LINE)]
+            rows.append('{ ' + ',\n        '.join(lines) + ' }')
+        out.append('    { ' + ',\n      '.join(rows) + ' }' + (',' if idx < len(entries) - 1 else ''))
+    out.append('};')
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    name, alice_bits, bob_bits = read_params(sys.argv[1])
+    source = open(sys.argv[2]).read()
+    pwords = read_array(source, name)
+    nwords = len(pwords)
+    p = value(pwords)
+    R = value(read_array(source, 'Montgomery_one'))
+    Rinv = pow(R, p - 2, p)
+
+    out = ['/********************************************************************************************',
+           '* Supersingular Isogeny Key Encapsulation Library',
+           '*',
+           '* Abstract: fixed-base tables of the Huff key generation for %s, generated by fixedgen.py (do not edit)' % name.upper(),
+           '*********************************************************************************************/',
+           '',
+           '#if (OALICE_BITS != %d) || (OBOB_BITS != %d)' % (alice_bits, bob_bits),
+           '    #error -- "the tables do not match the parameters of the key generation, regenerate them with fixedgen.py"',
+           '#endif']
+    for party, gen, nbits, size in (('A', 'A_gen_Huff', alice_bits, 'OALICE_BITS'), ('B', 'B_gen_Huff', bob_bits - 1, 'OBOB_BITS-1')):
+        g = read_array(source, gen)
+        xQ = (value(g[2*nwords:3*nwords])*Rinv % p, value(g[3*nwords:4*nwords])*Rinv % p)
+        out.append('')
+        out.append('// {x_i+1, x_i-1}, where x_i is the w-coordinate of [2^i]Q%s' % party)
+        emit_table(out, 'fixed_base_%s' % party, size, table(xQ, nbits, p), R, p, nwords)
+
+    with open(sys.argv[3], 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
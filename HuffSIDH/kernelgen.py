@@ -0,0 +1,807 @@
+#!/usr/bin/env python3
+"""
+Formula-to-C generator for the Huff kernels of ec_isogeny.c.
+
+The kernels are described in ec_isogeny.fml as GF(p^2) formulas over the parameters of the C functions
+(see the header of ec_isogeny.fml). For each kernel the generator
+  - builds the expression DAG of the formulas, merging common subexpressions,
+  - schedules the operations so that few values are alive at the same time,
+  - allocates the values to the outputs of the kernel and to as few f2elm_t temporaries as possible,
+    using the outputs as scratch space while their final value is not yet known,
+  - and rewrites the body of the kernel in ec_isogeny.c.
+Additions and subtractions whose results only feed multiplications use mp2_add()/mp2_sub_p2() (no correction),
+the others fp2add()/fp2sub().
+
+Usage, from a SIKEp<N> tree ("make kernels" and "make check_kernels"):
+  python3 ../kernelgen.py ec_isogeny.fml ec_isogeny.c            rewrites the kernels of ec_isogeny.c
+  python3 ../kernelgen.py --check ec_isogeny.fml ec_isogeny.c    checks the kernels of ec_isogeny.c
+
+The check interprets the C bodies over prime fields (no Sage needed). Each kernel must compute exactly its
+formulas, also when its outputs alias its inputs as allowed by the "alias" lines, and the formulas must agree
+with the arithmetic of the Montgomery curve y^2 = x^3 + (C^2+D^2)/(CD)*x^2 + x, on which the Huff w-coordinate
+is 1/x (see SIKEp751/monttohuff.sage): multiplications are compared with the group law, and the isogenies must vanish on
+their kernel and commute with the doubling of the codomain given by their curve constants.
+"""
+
+import random
+import re
+import sys
+
+
+COMMENT_COLUMN = 52            # Column of the comments in the generated code
+SEARCH_ROUNDS = 200            # Randomized schedules tried per kernel on top of the greedy one
+
+
+# Formula descriptions
+
+class Kernel:
+    def __init__(self, name, lineno):
+        self.name = name
+        self.lineno = lineno
+        self.aliases = []                  # (output point, [input points it can be the same as])
+        self.lines = []                    # (lhs, rhs, lineno)
+
+
+def parse_fml(path):
+    kernels = []
+    for lineno, raw in enumerate(open(path), 1):
+        line = raw.split('#', 1)[0].strip()
+        if not line:
+            continue
+        words = line.split()
+        if words[0] == 'kernel':
+            kernels.append(Kernel(words[1], lineno))
+        elif not kernels:
+            raise SyntaxError('%s:%d: formula outside of a kernel' % (path, lineno))
+        elif words[0] == 'alias':
+            kernels[-1].aliases.append((words[1], words[2:]))
+        elif '=' in line:
+            lhs, rhs = line.split('=', 1)
+            kernels[-1].lines.append((lhs.strip(), rhs.strip(), lineno))
+        else:
+            raise SyntaxError('%s:%d: cannot parse "%s"' % (path, lineno, line))
+    return kernels
+
+
+# C functions
+
+def find_function(src, name):
+    """Returns (start of the signature, start of the body, end of the body) of function name in src."""
+    m = re.search(r'^void %s\(([^)]*)\)[ \t]*\n\{' % re.escape(name), src, re.M)
+    if m is None:
+        raise KeyError('function %s not found' % name)
+    depth, i = 0, m.end() - 1
+    while True:
+        if src[i] == '{':
+            depth += 1
+        elif src[i] == '}':
+            depth -= 1
+            if depth == 0:
+                return m.start(), m.end() - 1, i + 1
+        i += 1
+
+
+def parse_signature(src, name):
+    """Returns {parameter: kind}, with kind 'point', 'elm' or 'array'."""
+    start, body, _ = find_function(src, name)
+    args = src[start:body]
+    args = args[args.index('(') + 1:args.rindex(')')]
+    params = {}
+    for arg in args.split(','):
+        words = arg.replace('*', ' * ').split()
+        pname = words[-1]
+        if 'point_proj_t' in words:
+            params[pname] = 'point'
+        elif 'f2elm_t' in words:
+            params[pname] = 'array' if '*' in words else 'elm'
+        else:
+            raise TypeError('%s: unsupported parameter "%s"' % (name, arg.strip()))
+    return params
+
+
+def is_location(params, name):
+    m = re.match(r'^(\w+)(?:->([XZ])|\[(\d+)\])?$', name)
+    if m is None or m.group(1) not in params:
+        return False
+    kind = params[m.group(1)]
+    return (kind == 'point' and m.group(2) is not None) or (kind == 'array' and m.group(3) is not None) or \
+           (kind == 'elm' and m.group(2) is None and m.group(3) is None)
+
+
+def split_statements(body):
+    """Statements of a kernel body (without the braces), comments removed."""
+    body = re.sub(r'//[^\n]*', '', body)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    return [s.strip() for s in body.split(';') if s.strip()]
+
+
+# Expression DAG
+
+class Node:
+    def __init__(self, op, args, loc=None):
+        self.op = op                       # 'in', 'add', 'sub', 'mul' or 'sqr'
+        self.args = args                   # Operand node ids
+        self.loc = loc                     # Input location, for op == 'in'
+        self.label = None                  # Name of the binding, if any
+
+
+class Dag:
+    def __init__(self):
+        self.nodes = []
+        self.table = {}
+
+    def make(self, op, args, loc=None):
+        if op == 'mul' and args[0] == args[1]:
+            op, args = 'sqr', (args[0],)
+        if op in ('add', 'mul'):
+            args = tuple(sorted(args))
+        key = (op, args, loc)
+        if key not in self.table:
+            self.table[key] = len(self.nodes)
+            self.nodes.append(Node(op, args, loc))
+        return self.table[key]
+
+
+TOKEN = re.compile(r'\s*(?:(\d+)|(\w+(?:->\w+|\[\d+\])?)|(\^2)|(.))')
+
+
+def parse_expr(text, dag, env, params, where):
+    tokens = []
+    for m in TOKEN.finditer(text):
+        if m.group(0).strip():
+            tokens.append(m.group(1) or m.group(2) or m.group(3) or m.group(4))
+    pos = [0]
+
+    def peek():
+        return tokens[pos[0]] if pos[0] < len(tokens) else None
+
+    def take(expected=None):
+        tok = peek()
+        if tok is None or (expected is not None and tok != expected):
+            raise SyntaxError('%s: expected %s in "%s"' % (where, expected or 'an operand', text))
+        pos[0] += 1
+        return tok
+
+    def scale(k, node):
+        if k == 1:
+            return node
+        if k % 2 != 0:
+            raise SyntaxError('%s: only the constant multipliers 2 and 4 are supported' % where)
+        half = scale(k // 2, node)
+        return dag.make('add', (half, half))
+
+    def atom():
+        tok = take()
+        if tok == '(':
+            node = expr()
+            take(')')
+        elif tok.isdigit():
+            take('*')
+            return scale(int(tok), factor())
+        elif tok in env:
+            node = env[tok]
+        elif is_location(params, tok):
+            node = dag.make('in', (), tok)
+        else:
+            raise NameError('%s: unknown name "%s"' % (where, tok))
+        return node
+
+    def factor():
+        node = atom()
+        while peek() == '^2':
+            take()
+            node = dag.make('sqr', (node,))
+        return node
+
+    def term():
+        node = factor()
+        while peek() == '*':
+            take()
+            node = dag.make('mul', (node, factor()))
+        return node
+
+    def expr():
+        node = term()
+        while peek() in ('+', '-'):
+            op = 'add' if take() == '+' else 'sub'
+            node = dag.make(op, (node, term()))
+        return node
+
+    node = expr()
+    if peek() is not None:
+        raise SyntaxError('%s: unexpected "%s" in "%s"' % (where, peek(), text))
+    return node
+
+
+class Compiled:
+    """A kernel description turned into a DAG, with its outputs and aliasing constraints."""
+    def __init__(self, kernel, params, path):
+        self.kernel = kernel
+        self.params = params
+        self.dag = Dag()
+        self.outputs = []                  # (location, node id), in the order of the description
+        env = {}
+        for lhs, rhs, lineno in kernel.lines:
+            where = '%s:%d' % (path, lineno)
+            node = parse_expr(rhs, self.dag, env, params, where)
+            if is_location(params, lhs):
+                if any(loc == lhs for loc, _ in self.outputs):
+                    raise SyntaxError('%s: output %s set twice' % (where, lhs))
+                self.outputs.append((lhs, node))
+            elif re.match(r'^[A-Za-z_]\w*$', lhs) and lhs not in params and lhs not in env:
+                env[lhs] = node
+                if self.dag.nodes[node].label is None and self.dag.nodes[node].op != 'in':
+                    self.dag.nodes[node].label = lhs
+            else:
+                raise SyntaxError('%s: cannot assign to "%s"' % (where, lhs))
+        # An output location conflicts with the input locations it can share storage with
+        self.conflicts = {}
+        inputs = set(n.loc for n in self.dag.nodes if n.op == 'in')
+        for loc, _ in self.outputs:
+            self.conflicts[loc] = set([loc]) & inputs
+        for out, ins in kernel.aliases:
+            if params.get(out) != 'point' or any(params.get(p) != 'point' for p in ins):
+                raise SyntaxError('%s: alias %s %s: only points can alias' % (kernel.name, out, ' '.join(ins)))
+            for field in ('X', 'Z'):
+                if out + '->' + field in self.conflicts:
+                    self.conflicts[out + '->' + field] |= set(p + '->' + field for p in ins) & inputs
+        self.needed = sorted(self.reachable())
+        self.consumers = dict((n, []) for n in range(len(self.dag.nodes)))
+        for n in self.needed:
+            for a in self.dag.nodes[n].args:
+                if n not in self.consumers[a]:
+                    self.consumers[a].append(n)
+
+    def reachable(self):
+        seen, stack = set(), [node for _, node in self.outputs]
+        while stack:
+            n = stack.pop()
+            if n in seen or self.dag.nodes[n].op == 'in':
+                continue
+            seen.add(n)
+            stack.extend(self.dag.nodes[n].args)
+        return seen
+
+    def is_lazy(self, n):
+        # Results feeding only multiplications are left uncorrected
+        node = self.dag.nodes[n]
+        return node.op in ('add', 'sub') and all(self.dag.nodes[c].op in ('mul', 'sqr') for c in self.consumers[n]) and \
+               all(node_ != n for _, node_ in self.outputs)
+
+
+# Scheduling and allocation
+
+def schedule(comp, rng):
+    """Greedy list scheduling: prefers the operations that end the life of most values. rng breaks the ties
+    (None: order of the description)."""
+    outputs = set(node for _, node in comp.outputs)
+    remaining = dict((n, len(comp.consumers[n])) for n in range(len(comp.dag.nodes)))
+    done, order = set(), []
+    while len(order) < len(comp.needed):
+        best, best_key = None, None
+        for n in comp.needed:
+            if n in done or any(comp.dag.nodes[a].op != 'in' and a not in done for a in comp.dag.nodes[n].args):
+                continue
+            freed = sum(1 for a in set(comp.dag.nodes[n].args)
+                        if comp.dag.nodes[a].op != 'in' and remaining[a] == 1 and a not in outputs)
+            key = (-freed, rng.random() if rng is not None else 0, n)
+            if best_key is None or key < best_key:
+                best, best_key = n, key
+        done.add(best)
+        order.append(best)
+        for a in set(comp.dag.nodes[best].args):
+            remaining[a] -= 1
+    return order
+
+
+def allocate(comp, order):
+    """Assigns a location to each value. Returns (instructions, copies, temporaries), where an instruction is
+    (node id, destination) in execution order and a copy (source, destination) is done at the end."""
+    step = dict((n, i) for i, n in enumerate(order))
+    end = len(order)
+    finals = {}                            # node id -> its output locations
+    for loc, n in comp.outputs:
+        finals.setdefault(n, []).append(loc)
+    lastuse = {}
+    for n in range(len(comp.dag.nodes)):
+        uses = [step[c] for c in comp.consumers[n] if c in step]
+        lastuse[n] = end if n in finals else max(uses + [-1])
+    input_lastuse = dict((comp.dag.nodes[n].loc, lastuse[n]) for n in range(len(comp.dag.nodes))
+                         if comp.dag.nodes[n].op == 'in')
+    final_step = dict((loc, step.get(n, -1)) for loc, n in comp.outputs)
+    holder, placed, final_done, temps, instrs = {}, {}, set(), [], []
+
+    def free(loc, s):
+        return loc not in final_done and (loc not in holder or lastuse[holder[loc]] <= s) and \
+               all(input_lastuse[i] <= s for i in comp.conflicts.get(loc, ()))
+
+    for s, n in enumerate(order):
+        dest = None
+        for loc in finals.get(n, []):
+            if free(loc, s):
+                dest = loc
+                final_done.add(loc)
+                break
+        if dest is None:
+            for loc, _ in comp.outputs:
+                if free(loc, s) and lastuse[n] <= final_step[loc]:
+                    dest = loc
+                    break
+        if dest is None:
+            for t in temps:
+                if free(t, s):
+                    dest = t
+                    break
+            else:
+                dest = 't%d' % len(temps)
+                temps.append(dest)
+        holder[dest] = n
+        placed[n] = dest
+        instrs.append((n, dest))
+
+    copies = []
+    for loc, n in comp.outputs:
+        src = comp.dag.nodes[n].loc if comp.dag.nodes[n].op == 'in' else placed[n]
+        if src != loc:
+            copies.append((src, loc))
+    for src, loc in copies:
+        if src in comp.conflicts or not src.startswith('t') and src in [l for _, l in copies]:
+            raise ValueError('%s: cannot order the copy of %s to %s' % (comp.kernel.name, src, loc))
+    return instrs, copies, temps
+
+
+def best_allocation(comp):
+    rng = random.Random(comp.kernel.name)
+    best = None
+    for round_ in range(SEARCH_ROUNDS + 1):
+        order = schedule(comp, rng if round_ > 0 else None)
+        instrs, copies, temps = allocate(comp, order)
+        cost = (len(copies), len(temps))
+        if best is None or cost < best[0]:
+            best = (cost, instrs, copies, temps)
+    return best[1:]
+
+
+# Code emission
+
+def display(comp, n, placed, depth=0):
+    node = comp.dag.nodes[n]
+    if node.op == 'in':
+        return node.loc
+    if node.label is not None and depth > 0:
+        return node.label
+    text = expression(comp, n, placed, depth)
+    if depth > 0 and len(text) > 24:
+        return placed[n]
+    return text
+
+
+def is_sum(text):
+    depth = 0
+    for i, c in enumerate(text):
+        depth += (c == '(') - (c == ')')
+        if depth == 0 and (c == '+' or (c == '-' and text[i + 1:i + 2] != '>')):
+            return True
+    return False
+
+
+def expression(comp, n, placed, depth=0):
+    node = comp.dag.nodes[n]
+    ops = [display(comp, a, placed, depth + 1) for a in node.args]
+    if node.op == 'sqr' and not re.match(r'^\w+(->\w+|\[\d+\])?$', ops[0]):
+        return '(%s)^2' % ops[0]
+    if node.op == 'mul' or node.op == 'add' and node.args[0] == node.args[1]:
+        ops = ['(%s)' % o if is_sum(o) else o for o in ops]
+    if node.op == 'add' and node.args[0] == node.args[1]:
+        return '4*%s' % ops[0][2:] if ops[0].startswith('2*') else '2*%s' % ops[0]
+    if node.op == 'add':
+        return '%s+%s' % tuple(ops) if depth > 0 else '%s + %s' % tuple(ops)
+    if node.op == 'sub':
+        return '%s-%s' % tuple(ops) if depth > 0 else '%s - %s' % tuple(ops)
+    if node.op == 'mul':
+        return '%s*%s' % tuple(ops)
+    return '%s^2' % ops[0]
+
+
+def emit_body(comp):
+    instrs, copies, temps = best_allocation(comp)
+    placed = {}
+    lines = []
+
+    def statement(call, comment):
+        lines.append(('    ' + call).ljust(COMMENT_COLUMN) + '// ' + comment)
+
+    for n, dest in instrs:
+        node = comp.dag.nodes[n]
+        args = [comp.dag.nodes[a].loc if comp.dag.nodes[a].op == 'in' else placed[a] for a in node.args]
+        if node.op == 'add':
+            func = 'mp2_add' if comp.is_lazy(n) else 'fp2add'
+        elif node.op == 'sub':
+            func = 'mp2_sub_p2' if comp.is_lazy(n) else 'fp2sub'
+        elif node.op == 'mul':
+            func = 'fp2mul_mont'
+        else:
+            func = 'fp2sqr_mont'
+        name = node.label if node.label is not None else dest
+        placed[n] = dest
+        statement('%s(%s);' % (func, ', '.join(args + [dest])), '%s = %s' % (name, expression(comp, n, placed)))
+    for src, loc in copies:
+        statement('fp2copy(%s, %s);' % (src, loc), '%s = %s' % (loc, src))
+    decl = ['    f2elm_t %s;' % ', '.join(temps), ''] if temps else []
+    return decl + lines, len(temps), len(instrs) + len(copies)
+
+
+GENERATED = '    // Generated by kernelgen.py from ec_isogeny.fml, edit the formulas there'
+
+
+def rewrite(src, comp):
+    start, body, end = find_function(src, comp.kernel.name)
+    lines, ntemps, nops = emit_body(comp)
+    return src[:body] + '\n'.join(['{', GENERATED] + lines) + '\n}' + src[end:], ntemps, nops
+
+
+# Checks
+
+CHECK_PRIME = 2**127 - 1                   # Formulas are checked as identities over GF(CHECK_PRIME)
+CURVE_PRIME = 10007                        # Curves with small kernels are searched over GF(CURVE_PRIME), p = 3 mod 4
+CHECK_SAMPLES = 20
+
+
+def interpret(statements, values, alias, p):
+    """Runs the statements of a kernel body on values {location: element}. alias maps output locations to the
+    input locations they share storage with."""
+    store = dict(values)
+    canon = lambda loc: alias.get(loc, loc)
+    for st in statements:
+        if st.startswith('f2elm_t '):
+            continue
+        m = re.match(r'^(\w+)\((.*)\)$', st, re.S)
+        if m is None:
+            raise ValueError('cannot interpret "%s"' % st)
+        func, args = m.group(1), [canon(a.strip()) for a in m.group(2).split(',')]
+        get = lambda loc: store[loc] if loc in store else (_ for _ in ()).throw(ValueError('%s read before set' % loc))
+        if func in ('fp2add', 'mp2_add'):
+            store[args[2]] = (get(args[0]) + get(args[1])) % p
+        elif func in ('fp2sub', 'mp2_sub_p2', 'mp2_sub_p4'):
+            store[args[2]] = (get(args[0]) - get(args[1])) % p
+        elif func == 'fp2mul_mont':
+            store[args[2]] = get(args[0]) * get(args[1]) % p
+        elif func == 'fp2sqr_mont':
+            store[args[1]] = get(args[0]) * get(args[0]) % p
+        elif func == 'fp2copy':
+            store[args[1]] = get(args[0])
+        elif func == 'fp2div2':
+            store[args[1]] = get(args[0]) * pow(2, p - 2, p) % p
+        elif func == 'fp2neg':
+            store[args[0]] = -get(args[0]) % p
+        else:
+            raise ValueError('cannot interpret call to %s' % func)
+    return store
+
+
+def evaluate(comp, values, p):
+    val = {}
+    for n in range(len(comp.dag.nodes)):
+        node = comp.dag.nodes[n]
+        args = [val[a] for a in node.args]
+        if node.op == 'in':
+            val[n] = values[node.loc]
+        elif node.op == 'add':
+            val[n] = (args[0] + args[1]) % p
+        elif node.op == 'sub':
+            val[n] = (args[0] - args[1]) % p
+        elif node.op == 'mul':
+            val[n] = args[0] * args[1] % p
+        else:
+            val[n] = args[0] * args[0] % p
+    return dict((loc, val[n]) for loc, n in comp.outputs)
+
+
+def check_formulas(comp, statements):
+    """The C body must compute the formulas, for every aliasing allowed by the description."""
+    rng = random.Random(1)
+    inputs = sorted(set(n.loc for n in comp.dag.nodes if n.op == 'in'))
+    scenarios = [{}]
+    for out, ins in comp.kernel.aliases:
+        for p in ins:
+            scenarios.append(dict((out + '->' + f, p + '->' + f) for f in ('X', 'Z')))
+    for alias in scenarios:
+        for _ in range(CHECK_SAMPLES):
+            values = dict((loc, rng.randrange(CHECK_PRIME)) for loc in inputs)
+            for out, src in alias.items():             # Aliased points hold the same input
+                if out in values:
+                    values[out] = values[src]
+            expected = evaluate(comp, values, CHECK_PRIME)
+            store = interpret(statements, values, alias, CHECK_PRIME)
+            for loc, v in expected.items():
+                if store.get(alias.get(loc, loc)) != v:
+                    return 'output %s differs from its formula%s' % (loc, ' with ' + ', '.join(
+                        '%s = %s' % a for a in sorted(alias.items())) if alias else '')
+    return None
+
+
+class Curve:
+    """Montgomery curve y^2 = x^3 + A*x^2 + x over GF(p), affine points or None for the point at infinity."""
+    def __init__(self, p, A):
+        self.p, self.A = p, A
+
+    def add(self, P, Q):
+        p = self.p
+        if P is None:
+            return Q
+        if Q is None:
+            return P
+        if P[0] == Q[0]:
+            if (P[1] + Q[1]) % p == 0:
+                return None
+            lam = (3 * P[0] * P[0] + 2 * self.A * P[0] + 1) * pow(2 * P[1], p - 2, p) % p
+        else:
+            lam = (Q[1] - P[1]) * pow(Q[0] - P[0], p - 2, p) % p
+        x = (lam * lam - self.A - P[0] - Q[0]) % p
+        return (x, (lam * (P[0] - x) - P[1]) % p)
+
+    def neg(self, P):
+        return None if P is None else (P[0], -P[1] % self.p)
+
+    def mul(self, k, P):
+        R = None
+        while k > 0:
+            if k & 1:
+                R = self.add(R, P)
+            P = self.add(P, P)
+            k >>= 1
+        return R
+
+    def order(self):
+        p = self.p
+        return 1 + sum(1 + (0 if f == 0 else (1 if pow(f, (p - 1) // 2, p) == 1 else -1))
+                       for f in ((x * x * x + self.A * x * x + x) % p for x in range(p)))
+
+    def random_point(self, rng):
+        p = self.p
+        while True:
+            x = rng.randrange(1, p)
+            f = (x * x * x + self.A * x * x + x) % p
+            if f != 0 and pow(f, (p - 1) // 2, p) == 1:
+                return (x, pow(f, (p + 1) // 4, p))
+
+
+def huff_curve(rng, l):
+    """Random C, D with a point K of order l on the Montgomery curve with A = (C^2+D^2)/(CD) (no K if l = 1)."""
+    p = CURVE_PRIME
+    while True:
+        C, D = rng.randrange(1, p), rng.randrange(1, p)
+        if (C - D) % p == 0 or (C + D) % p == 0:
+            continue
+        E = Curve(p, (C * C + D * D) * pow(C * D, p - 2, p) % p)
+        if l == 1:
+            return C, D, E, None
+        N = E.order()
+        if N % l != 0:
+            continue
+        q = 2 if l == 4 else l                             # Points of order a power of q, then of order l
+        m = N
+        while m % q == 0:
+            m //= q
+        for _ in range(20):
+            K = E.mul(m, E.random_point(rng))
+            if K is None:
+                continue
+            while E.mul(l, K) is not None:
+                K = E.mul(q, K)
+            if E.mul(l // q, K) is not None and (l != 4 or E.mul(2, K) != (0, 0)) and K[0] != 0:
+                return C, D, E, K
+
+
+def w(P):
+    """Projective Huff w-coordinate (1:x) of an affine Montgomery point."""
+    return (1, P[0])
+
+
+def same(P, Q, p):
+    return (P[0] * Q[1] - P[1] * Q[0]) % p == 0 and (P[0] % p != 0 or P[1] % p != 0)
+
+
+def xdbl_mont(A, P, p):
+    """x-only doubling of a projective Montgomery point (X:Z)."""
+    X, Z = P
+    return ((X * X - Z * Z) ** 2 % p, 4 * X * Z * (X * X + A * X * Z + Z * Z) % p)
+
+
+REFERENCES = {}
+
+
+def reference(name):
+    def register(f):
+        REFERENCES[name] = f
+        return f
+    return register
+
+
+def call(funcs, name, args):
+    """Runs kernel name of ec_isogeny.c with args {parameter: value, (x, z) for points, list for arrays}."""
+    statements, params = funcs[name]
+    values = {}
+    for pname, kind in params.items():
+        arg = args.get(pname)
+        if kind == 'point' and arg is not None:
+            values[pname + '->X'], values[pname + '->Z'] = arg
+        elif kind == 'array' and arg is not None:
+            for i, v in enumerate(arg):
+                values['%s[%d]' % (pname, i)] = v
+        elif kind == 'elm' and arg is not None:
+            values[pname] = arg
+    store = interpret(statements, values, {}, CURVE_PRIME)
+    result = {}
+    for pname, kind in params.items():
+        if kind == 'point':
+            result[pname] = (store.get(pname + '->X'), store.get(pname + '->Z'))
+        elif kind == 'array':
+            result[pname] = [store.get('%s[%d]' % (pname, i)) for i in range(8) if '%s[%d]' % (pname, i) in store]
+        else:
+            result[pname] = store.get(pname)
+    return result
+
+
+def mult_check(funcs, name, l, consts, rng):
+    p = CURVE_PRIME
+    C, D, E, _ = huff_curve(rng, 1)
+    for _ in range(CHECK_SAMPLES):
+        P = E.random_point(rng)
+        lP = E.mul(l, P)
+        if lP is None or lP[0] == 0:
+            continue
+        out = call(funcs, name, dict([('P', w(P))] + consts(C, D)))
+        if not same(out['Q'], w(lP), p):
+            return '%s(P) differs from [%d]P' % (name, l)
+    return None
+
+
+@reference('xDBL_Huff')
+def ref_xdbl(funcs, rng):
+    p = CURVE_PRIME
+    return mult_check(funcs, 'xDBL_Huff', 2, lambda C, D: [('CmDsq', (C - D) ** 2 % p), ('CD4', 4 * C * D % p)], rng)
+
+
+@reference('xTPL_Huff')
+def ref_xtpl(funcs, rng):
+    p = CURVE_PRIME
+    return mult_check(funcs, 'xTPL_Huff', 3, lambda C, D: [('A24minus', (C - D) ** 2 % p), ('A24plus', (C + D) ** 2 % p)], rng)
+
+
+@reference('xADD_Huff')
+def ref_xadd(funcs, rng):
+    p = CURVE_PRIME
+    _, _, E, _ = huff_curve(rng, 1)
+    for _ in range(CHECK_SAMPLES):
+        P, Q = E.random_point(rng), E.random_point(rng)
+        S, PQ = E.add(P, Q), E.add(P, E.neg(Q))
+        if S is None or PQ is None or S[0] == 0 or PQ[0] == 0:
+            continue
+        out = call(funcs, 'xADD_Huff', {'P': w(P), 'Q': w(Q), 'PQ': w(PQ)})
+        if not same(out['S'], w(S), p):
+            return 'xADD_Huff(P, Q, P-Q) differs from P+Q'
+    return None
+
+
+def isogeny_check(funcs, l, get, evaluate_at, codomain_A):
+    """get(C, D, K) -> state, evaluate_at(state, point) -> image, codomain_A(state) -> A of the codomain."""
+    p = CURVE_PRIME
+    rng = random.Random(l)
+    for _ in range(4):
+        C, D, E, K = huff_curve(rng, l)
+        state = get(C, D, K, E)
+        A = codomain_A(state)
+        if A is None:
+            return '%d-isogeny: degenerate codomain' % l
+        for _ in range(CHECK_SAMPLES):
+            R = E.random_point(rng)
+            RK, R2 = E.add(R, K), E.add(R, R)
+            if RK is None or R2 is None or 0 in (RK[0], R2[0]):
+                continue
+            img = evaluate_at(state, w(R))
+            if img[0] % p == 0 or img[1] % p == 0:
+                continue
+            if not same(evaluate_at(state, w(RK)), img, p):
+                return '%d-isogeny does not vanish on its kernel' % l
+            # Doubling on the codomain, in Montgomery x = 1/w
+            dbl = xdbl_mont(A, (img[1], img[0]), p)
+            if not same(evaluate_at(state, w(R2)), (dbl[1], dbl[0]), p):
+                return '%d-isogeny does not commute with the doubling of its codomain' % l
+    return None
+
+
+def ratio(num, den):
+    p = CURVE_PRIME
+    return None if den % p == 0 else num * pow(den, p - 2, p) % p
+
+
+@reference('get_3_isog_Huff')
+def ref_isog3(funcs, rng):
+    p = CURVE_PRIME
+    def get(C, D, K, E):
+        return call(funcs, 'get_3_isog_Huff', {'P': w(K)})
+    def at(state, P):
+        return call(funcs, 'eval_3_isog_Huff', {'Q': P, 'coeff': state['coeff']})['Q']
+    def A(state):
+        am, ap = state['A24minus'], state['A24plus']          # (C-D)^2 and (C+D)^2, A = 2((C+D)^2+(C-D)^2)/((C+D)^2-(C-D)^2)
+        r = ratio(2 * (ap + am), ap - am)
+        return r
+    return isogeny_check(funcs, 3, get, at, A)
+
+
+@reference('get_4_isog_Huff')
+def ref_isog4(funcs, rng):
+    def get(C, D, K, E):
+        return call(funcs, 'get_4_isog_Huff', {'P': w(K)})
+    def at(state, P):
+        return call(funcs, 'eval_4_isog_Huff', {'P': P, 'coeff': state['coeff']})['P']
+    def A(state):                                           # A+2 = (C+D)^2/(CD) = 4(CmDsq+CD4)/CD4
+        r = ratio(4 * (state['CmDsq'] + state['CD4']), state['CD4'])
+        return None if r is None else (r - 2) % CURVE_PRIME
+    return isogeny_check(funcs, 4, get, at, A)
+
+
+@reference('get_5_isog_huff')
+def ref_isog5(funcs, rng):
+    p = CURVE_PRIME
+    def get(C, D, K, E):
+        return call(funcs, 'get_5_isog_huff', {'P': w(K), 'P2': w(E.add(K, K)),
+                                               'CmDsq': (C - D) ** 2 % p, 'CD4': 4 * C * D % p})
+    def at(state, P):
+        return call(funcs, 'eval_5_isog_Huff', {'Q': P, 'coeff': state['coeff']})['Q']
+    def A(state):                                           # A = (C^2+D^2)/(CD) = 4*CmDsq/CD4 + 2
+        r = ratio(4 * state['CmDsq'], state['CD4'])
+        return None if r is None else (r + 2) % p
+    return isogeny_check(funcs, 5, get, at, A)
+
+
+REFERENCES['eval_3_isog_Huff'] = REFERENCES['get_3_isog_Huff']
+REFERENCES['eval_4_isog_Huff'] = REFERENCES['get_4_isog_Huff']
+REFERENCES['eval_5_isog_Huff'] = REFERENCES['get_5_isog_huff']
+
+
+def check(kernels, src, path):
+    funcs, failures = {}, 0
+    for k in kernels:
+        start, body, end = find_function(src, k.name)
+        funcs[k.name] = (split_statements(src[body + 1:end - 1]), parse_signature(src, k.name))
+    done = {}                              # get/eval pairs share their reference check
+    for k in kernels:
+        comp = Compiled(k, funcs[k.name][1], path)
+        try:
+            err = check_formulas(comp, funcs[k.name][0])
+            ref = REFERENCES.get(k.name)
+            if err is None and ref is None:
+                err = 'no reference check'
+            elif err is None:
+                if ref not in done:
+                    done[ref] = ref(funcs, random.Random(k.name))
+                err = done[ref]
+        except (ValueError, KeyError) as e:
+            err = str(e)
+        print('  %-24s %s' % (k.name, 'OK' if err is None else 'FAILED: ' + err))
+        failures += err is not None
+    return failures
+
+
+def main(argv):
+    checking = '--check' in argv
+    args = [a for a in argv if a != '--check']
+    if len(args) != 2:
+        sys.exit(__doc__)
+    fml, csrc = args
+    kernels = parse_fml(fml)
+    src = open(csrc).read()
+    if checking:
+        print('Checking the kernels of %s against %s' % (csrc, fml))
+        sys.exit(1 if check(kernels, src, fml) else 0)
+    for k in kernels:
+        comp = Compiled(k, parse_signature(src, k.name), fml)
+        src, ntemps, nops = rewrite(src, comp)
+        print('  %-24s %2d operations, %d temporaries' % (k.name, nops, ntemps))
+    open(csrc, 'w').write(src)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
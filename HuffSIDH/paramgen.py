@@ -0,0 +1,684 @@
+#!/usr/bin/env python3
+"""
+Parameter-set generator: emits a complete SIKEp<N> tree for a prime p = 2^eA*3^eB - 1.
+
+    python3 paramgen.py [--template DIR] [--out DIR] [--build] eA eB
+    python3 paramgen.py --check [--template DIR]
+
+The tree is a copy of the template tree (SIKEp751 by default, the parameter set whose kernels compute 4- and
+3-isogenies) with the prime-specific files emitted for p: P<N>/P<N>.c, P<N>/P<N>_internal.h and P<N>/api.h, the
+field backend P<N>/generic/fp_generic.c, the makefile and the tests, renamed after the prime. P<N>.c holds every
+constant of the parameter set, all computed here in Python 3 (no Sage needed):
+  - p, 2p, 4p, p+1 and 16p^2, the subgroup orders, the Montgomery constants R^2 mod p and R mod p, R = 2^(64*NWORDS64_FIELD),
+    and those of the arithmetic modulo Bob's order (compression),
+  - the public bases on the starting curve y^2 = x^3 + 6x^2 + x, by the rules of the SIKE specification: PA and QA are the
+    first [3^eB](c + i), c = 0, 1, ..., with [2^(eA-1)]PA not in {O, (0,0)} and [2^(eA-1)]QA = (0,0); PB and QB are the
+    first [2^(eA-1)](c), c = 1, 2, ..., of order 3^eB with y in GF(p) and in i*GF(p), resp.; RA = PA - QA and RB = PB - QB,
+  - the Huff curve c of the starting curve, A = c + 1/c, and the Huff bases, w = 1/x,
+  - the Elligator 2 table of the torsion bases (basis_table),
+  - the optimal strategies: the Montgomery ones with the SIKE cost ratio, and the Huff and twisted Edwards ones from the
+    template's measured kernel costs, scaled to the new field size. "make strategies" in the new tree measures the kernels
+    on the build host and rewrites the Huff and Edwards tables; --build does it, builds the tree and writes its Huff KAT file.
+Limb counts, key sizes and masks in P<N>_internal.h and api.h follow from eA and eB.
+
+--check regenerates the constants of the template tree itself and compares them with its parameter file, and compares
+the bases PA and QA computed for p434 with those of the SIKE specification.
+
+Only primes 2^eA*3^eB - 1 are supported, with a template tree whose kernels compute 4- and 3-isogenies: the isogeny,
+pairing and discrete logarithm code of the trees is written for the degrees of its own parameter set (the 3- and
+5-isogenies of SIKEp610 have their own kernels, strategies and pairings), and the cofactor multiplications, pairings
+and square roots assume p + 1 = 2^eA*3^eB, without a cofactor f. The generated makefile finds the generators shared by
+the trees (dloggen.py, fixedgen.py, kernelgen.py) next to paramgen.py.
+GF(p) inversion (fpinv_chain_mont in fpx.c) has an addition chain for 434-, 503-, 610- and 751-bit primes, and
+falls back to a fixed-window exponentiation for other sizes.
+"""
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+
+# Arithmetic in GF(p^2) = GF(p)[i]/(i^2 + 1), on pairs (a, b) = a + b*i
+
+def f2add(p, a, b): return ((a[0] + b[0]) % p, (a[1] + b[1]) % p)
+def f2sub(p, a, b): return ((a[0] - b[0]) % p, (a[1] - b[1]) % p)
+def f2mul(p, a, b): return ((a[0]*b[0] - a[1]*b[1]) % p, (a[0]*b[1] + a[1]*b[0]) % p)
+
+
+def f2inv(p, a):
+    n = pow((a[0]*a[0] + a[1]*a[1]) % p, -1, p)
+    return (a[0]*n % p, -a[1]*n % p)
+
+
+def is_square_fp(p, a):
+    return a % p == 0 or pow(a, (p - 1)//2, p) == 1
+
+
+def f2sqrt(p, a):
+    # Square root in GF(p^2) for p = 3 mod 4. The root of an element of GF(p) is in GF(p) or in i*GF(p)
+    a0, a1 = a
+    if a1 == 0:
+        if is_square_fp(p, a0):
+            return (pow(a0, (p + 1)//4, p), 0)
+        return (0, pow(-a0 % p, (p + 1)//4, p))
+    n = pow((a0*a0 + a1*a1) % p, (p + 1)//4, p)
+    for r in (n, p - n):
+        t = (a0 + r)*pow(2, -1, p) % p
+        if is_square_fp(p, t):
+            x = pow(t, (p + 1)//4, p)
+            if x != 0:
+                y = a1*pow(2*x, -1, p) % p
+                if f2mul(p, (x, y), (x, y)) == (a0 % p, a1 % p):
+                    return (x, y)
+    raise ValueError("not a square")
+
+
+# Affine points of y^2 = x^3 + A*x^2 + x, None is the point at infinity
+
+def curve_rhs(p, A, x):
+    x2 = f2mul(p, x, x)
+    return f2add(p, f2add(p, f2mul(p, x2, x), f2mul(p, A, x2)), x)
+
+
+def point_add(p, A, P, Q):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    (x1, y1), (x2, y2) = P, Q
+    if x1 == x2:
+        if f2add(p, y1, y2) == (0, 0):
+            return None
+        x1s = f2mul(p, x1, x1)
+        num = f2add(p, f2add(p, f2mul(p, (3, 0), x1s), f2mul(p, f2mul(p, (2, 0), A), x1)), (1, 0))
+        l = f2mul(p, num, f2inv(p, f2mul(p, (2, 0), y1)))
+    else:
+        l = f2mul(p, f2sub(p, y2, y1), f2inv(p, f2sub(p, x2, x1)))
+    x3 = f2sub(p, f2sub(p, f2sub(p, f2mul(p, l, l), A), x1), x2)
+    return (x3, f2sub(p, f2mul(p, l, f2sub(p, x1, x3)), y1))
+
+
+def point_mul(p, A, k, P):
+    R = None
+    for bit in bin(k)[2:]:
+        R = point_add(p, A, R, R)
+        if bit == '1':
+            R = point_add(p, A, R, P)
+    return R
+
+
+def point_neg(p, P):
+    return (P[0], ((-P[1][0]) % p, (-P[1][1]) % p))
+
+
+def lift(p, A, x):
+    y2 = curve_rhs(p, A, x)
+    return (x, f2sqrt(p, y2))
+
+
+def public_bases(prm):
+    # Bases of E[2^eA] and E[3^eB] on y^2 = x^3 + 6x^2 + x, by the rules of the SIKE specification
+    p, eA, eB = prm['p'], prm['eA'], prm['eB']
+    A = (6, 0)
+    P = Q = None
+    c = 0
+    while P is None or Q is None:
+        x = (c, 1)
+        c += 1
+        y2 = curve_rhs(p, A, x)
+        if not is_square_fp(p, (y2[0]*y2[0] + y2[1]*y2[1]) % p):
+            continue
+        R = point_mul(p, A, 3**eB, lift(p, A, x))
+        if R is None:
+            continue
+        H = point_mul(p, A, 2**(eA - 1), R)
+        if H is None:
+            continue
+        if P is None and H[0] != (0, 0):
+            P = R
+        elif Q is None and H[0] == (0, 0):
+            Q = R
+    PA, QA = P, Q
+    P = Q = None
+    c = 1
+    while P is None or Q is None:
+        x = (c, 0)
+        c += 1
+        on_fp = is_square_fp(p, curve_rhs(p, A, x)[0])
+        if (P is not None and on_fp) or (Q is not None and not on_fp):
+            continue
+        R = point_mul(p, A, 2**(eA - 1), lift(p, A, x))
+        if R is None or point_mul(p, A, 3**(eB - 1), R) is None or point_mul(p, A, 3**eB, R) is not None:
+            continue
+        if on_fp:
+            P = R
+        else:
+            Q = R
+    PB, QB = P, Q
+    RA = point_add(p, A, PA, point_neg(p, QA))
+    RB = point_add(p, A, PB, point_neg(p, QB))
+    return [PA[0], QA[0], RA[0]], [PB[0], QB[0], RB[0]]
+
+
+# Strategies
+
+def optimal_strategy(nleaves, maxpts, p, q):
+    # Port of optimal_strategy() in tests/strategy.c
+    w = maxpts + 1
+    INF = None
+    C = [[INF]*w for _ in range(nleaves + 1)]
+    split = [[0]*w for _ in range(nleaves + 1)]
+    for k in range(w):
+        C[1][k] = 0
+    for L in range(2, nleaves + 1):
+        for k in range(1, w):
+            for m in range(1, L):
+                a, b = C[L - m][k - 1], C[m][k]
+                if a is None or b is None:
+                    continue
+                c = a + b + m*p + (L - m)*q
+                if C[L][k] is None or c < C[L][k]:
+                    C[L][k] = c
+                    split[L][k] = m
+    return split
+
+
+def strategy_preorder(split, nleaves, maxpts):
+    out, stack = [], [(nleaves, maxpts)]
+    while stack:
+        L, k = stack.pop()
+        if L < 2:
+            continue
+        m = split[L][k]
+        out.append(m)
+        stack.append((m, k))
+        stack.append((L - m, k - 1))
+    return out
+
+
+def strategy_table(name, size, values, per_line):
+    s = "const unsigned int %s[%s] = { \n" % (name, size)
+    for i, v in enumerate(values):
+        s += str(v) + (" };" if i == len(values) - 1 else (",\n" if i % per_line == per_line - 1 else ", "))
+    return s
+
+
+# Emission of the parameter file
+
+def words(v, n):
+    return ["0x%016X" % ((v >> (64*j)) & (2**64 - 1)) for j in range(n)]
+
+
+def array_body(values, per_line, indent, comments=None):
+    # values: list of elements, each a list of words. An element starts a new line and spans lines of per_line words
+    lines = []
+    for e, ws in enumerate(values):
+        for j in range(0, len(ws), per_line):
+            lines.append(", ".join(ws[j:j + per_line]))
+            if comments and j + per_line >= len(ws):
+                lines[-1] = (lines[-1], comments[e])
+    out = ""
+    for i, l in enumerate(lines):
+        text, comment = l if isinstance(l, tuple) else (l, None)
+        last = (i == len(lines) - 1)
+        out += (indent if i > 0 else "") + text + (" };" if last else ",")
+        if comment:
+            out += (" " if last else "   ") + "// " + comment
+        out += "\n" if not last or comment is None else ""
+    return out.rstrip("\n")
+
+
+def replace_array(src, name, body):
+    m = re.search(r'(const uint64_t %s\[[^\]]*\](?:\[[^\]]*\])?\s*=\s*\{ ?)(.*?\};[^\n]*)' % re.escape(name), src, re.S)
+    if m is None:
+        raise KeyError(name)
+    return src[:m.start(2)] + body + src[m.end(2):]
+
+
+def replace_table(src, name, table):
+    m = re.search(r'const unsigned int %s(?:\[[^\]]*\])+ = \{.*?\};' % re.escape(name), src, re.S)
+    if m is None:
+        raise KeyError(name)
+    return src[:m.start()] + table + src[m.end():]
+
+
+def template_tables(src, names):
+    out = {}
+    for name in names:
+        m = re.search(r'const unsigned int %s\[[^\]]*\] = \{(.*?)\};' % re.escape(name), src, re.S)
+        out[name] = [int(v) for v in re.findall(r'\d+', m.group(1))]
+    return out
+
+
+def parameters(eA, eB):
+    p = 2**eA*3**eB - 1
+    prm = {'eA': eA, 'eB': eB, 'p': p}
+    nbits = p.bit_length()
+    nw64 = (nbits + 63)//64
+    prm.update(nbits=nbits, nw64=nw64, maxbits=64*nw64, nw32=2*nw64)
+    prm['zero64'] = eA//64                                  # zero digits of p + 1 = 2^eA*...
+    prm['zero32'] = eA//32
+    obob_bits = (3**eB).bit_length()
+    nbits_order = 64*((max(eA + 1, obob_bits) + 63)//64)
+    prm.update(obob_bits=obob_bits, nbits_order=nbits_order, nw64_order=nbits_order//64)
+    prm['mask_alice'] = (1 << (eA % 8 or 8)) - 1
+    prm['mask_bob'] = (1 << ((obob_bits - 1) % 8 or 8)) - 1
+    prm['max_alice'], prm['max_bob'] = eA//2, eB
+    # Message sizes of the SIKE parameter sets: 16 bytes for NIST level 1 (p434), 24 bytes for levels 2 and 3 (p503, p610)
+    # and 32 bytes for level 5 (p751)
+    prm['msg_bytes'] = 16 if nbits < 480 else (24 if nbits < 700 else 32)
+    prm['nist_level'] = 1 if nbits < 480 else (2 if nbits < 560 else (3 if nbits < 700 else 5))
+    prm['max_pts_alice'] = 7 if nbits < 700 else 8
+    prm['max_pts_bob'] = 8 if nbits < 700 else 10
+    fp_bytes = (nbits + 7)//8
+    fp2_bytes = 2*fp_bytes
+    sk_a, sk_b = (eA + 7)//8, (obob_bits - 1 + 7)//8
+    order_bytes = (max(eA, obob_bits) + 7)//8                # Compressed keys pad both orders to the larger one
+    pk = 3*fp2_bytes
+    cpk = fp2_bytes + 3*order_bytes + 1
+    prm.update(fp_bytes=fp_bytes, fp2_bytes=fp2_bytes, sk_a=sk_a, sk_b=sk_b, order_bytes=order_bytes, pk=pk,
+               sk=prm['msg_bytes'] + sk_b + pk, ct=pk + prm['msg_bytes'], cpk=cpk,
+               csk=prm['msg_bytes'] + sk_b + cpk, cct=cpk + prm['msg_bytes'], precomp=8*nw64)
+    return prm
+
+
+def dlog_windows(e, w, ell):
+    dlen = (e + w - 1)//w
+    return ell**(e - w*(dlen - 1))
+
+
+def constants(prm, template_costs, template_nw64):
+    p, nw = prm['p'], prm['nw64']
+    R = 2**(64*nw)
+    mont = lambda v: v*R % p
+    A_gen, B_gen = public_bases(prm)
+    c = (3 - pow(8, (p + 1)//4, p)) % p                    # Huff curve of A = 6: c + 1/c = 6
+    assert (c + pow(c, -1, p)) % p == 6
+    oA, oB = 2**prm['eA'], 3**prm['eB']
+    o = 2**prm['nbits_order']
+    k = 1
+    while is_square_fp(p, k*k + 1):
+        k += 1
+    table = []
+    for r in range(1, 18):
+        v = f2inv(p, ((1 + k*r*r) % p, r*r % p))
+        table.append(words(mont(v[0]), nw) + words(mont(v[1]), nw))
+    A_vals, B_vals, AH_vals, BH_vals = [], [], [], []
+    for x in A_gen:
+        A_vals += [words(mont(x[0]), nw), words(mont(x[1]), nw)]
+        w = f2inv(p, x)
+        AH_vals += [words(mont(w[0]), nw), words(mont(w[1]), nw)]
+    for x in B_gen:
+        B_vals += [words(mont(x[0]), nw), words(mont(x[1]), nw)]
+        w = f2inv(p, x)
+        BH_vals += [words(mont(w[0]), nw), words(mont(w[1]), nw)]
+    scale = (nw/template_nw64)**2
+    costs = [[int(round(v*scale)) for v in row] for row in template_costs]
+    return dict(A_gen=A_vals, B_gen=B_vals, A_gen_Huff=AH_vals, B_gen_Huff=BH_vals, u=k, basis_table=table,
+                Huff_c=[words(mont(c), nw)], Montgomery_R2=[words(R*R % p, nw)], Montgomery_one=[words(R % p, nw)],
+                px2=[words(2*p, nw)], px4=[words(4*p, nw)], pp1=[words(p + 1, nw)], p=[words(p, nw)],
+                px16p=[words(16*p*p, 2*nw)], Alice_order=[words(oA, prm['nw64_order'])], Bob_order=[words(oB, prm['nw64_order'])],
+                Montgomery_rprime_B=[words((-pow(oB, -1, o)) % o, prm['nw64_order'])],
+                Montgomery_Rprime_B=[words(o*o % oB, prm['nw64_order'])], hybrid_costs=costs)
+
+
+def substitute(text, prm, tprm, numbers=None):
+    # Rewrites the prime-specific tokens of a template file: the bit length in names (p751, fpadd751, SIKEp751, ...), the
+    # powers 2^eA, 3^eB, 2^NBITS_ORDER and 2^MAXBITS_FIELD, and optionally a map of sizes (api.h, README)
+    N, tN = str(prm['nbits']), str(tprm['nbits'])
+    powers = {'2^%d' % tprm['eA']: '2^%d' % prm['eA'], '3^%d' % tprm['eB']: '3^%d' % prm['eB'],
+              '2^%d' % tprm['nbits_order']: '2^%d' % prm['nbits_order'], '2^%d' % tprm['maxbits']: '2^%d' % prm['maxbits'],
+              '%d-bit max' % tprm['maxbits']: '%d-bit max' % prm['maxbits'],
+              '%d-bit element' % tprm['nbits_order']: '%d-bit element' % prm['nbits_order']}
+    pattern = '0x[0-9a-fA-F]+|' + '|'.join(re.escape(k) for k in sorted(powers, key=len, reverse=True))
+    if tprm['nbits'] is not None:
+        pattern += '|' + tN
+    if numbers:
+        pattern += '|' + '|'.join(r'\b%d\b' % k for k in sorted(numbers, reverse=True))
+
+    def repl(m):
+        s = m.group(0)
+        if s.startswith('0x') or s.startswith('0X'):
+            return s
+        if s in powers:
+            return powers[s]
+        if s == tN:
+            return N
+        return str(numbers[int(s)])
+    return re.sub(pattern, repl, text)
+
+
+def size_map(prm, tprm):
+    keys = ['sk', 'pk', 'ct', 'csk', 'cpk', 'cct', 'fp_bytes', 'fp2_bytes', 'sk_a', 'sk_b', 'msg_bytes', 'precomp']
+    out = {}
+    for k in keys:
+        if tprm[k] in out and out[tprm[k]] != prm[k]:
+            raise ValueError("ambiguous size %d in the template" % tprm[k])
+        out[tprm[k]] = prm[k]
+    return out
+
+
+def emit_internal_h(src, prm, tprm):
+    src = substitute(src, prm, tprm)
+    defs = {'NBITS_FIELD': prm['nbits'], 'MAXBITS_FIELD': prm['maxbits'], 'NBITS_ORDER': prm['nbits_order'],
+            'OALICE_BITS': prm['eA'], 'OBOB_BITS': prm['obob_bits'], 'OBOB_EXPON': prm['eB'],
+            'MASK_ALICE': '0x%02X' % prm['mask_alice'], 'MASK_BOB': '0x%02X' % prm['mask_bob'],
+            'MAX_INT_POINTS_ALICE': prm['max_pts_alice'], 'MAX_INT_POINTS_BOB': prm['max_pts_bob'],
+            'MAX_Alice': prm['max_alice'], 'MAX_Bob': prm['max_bob'], 'MSG_BYTES': prm['msg_bytes'],
+            'EXPON_2': prm['eA'], 'EXPON_3': prm['eB']}
+    w2 = int(re.search(r'#define W_2 (\d+)', src).group(1))
+    w3 = int(re.search(r'#define W_3 (\d+)', src).group(1))
+    defs.update(ELL3_W=3**w3, ELL2_EMODW=dlog_windows(prm['eA'], w2, 2), ELL3_EMODW=dlog_windows(prm['eB'], w3, 3))
+    def define(m, value):
+        # Keeps the column of a trailing comment
+        value = str(value)
+        pad = len(m.group(2)) + len(m.group(3)) - len(value)
+        return m.group(1) + value + (" "*max(pad, 1) if m.group(3) else "")
+    for name, value in defs.items():
+        src, n = re.subn(r'(#define %s\s+)(\S+)([ \t]*)' % name, lambda m: define(m, value), src)
+        assert n == 1, name
+    for name, values in (('NWORDS_FIELD', (prm['nw64'], prm['nw32'])), ('p%d_ZERO_WORDS' % prm['nbits'], (prm['zero64'], prm['zero32']))):
+        it = iter(values)
+        src, n = re.subn(r'(#define %s\s+)(\d+)([ \t]*)' % name, lambda m: define(m, next(it)), src)
+        assert n == 2, name
+    if prm['eA'] > prm['obob_bits']:
+        # Alice's order is the larger one: the scalars of compressed keys are padded to its size
+        src, n = re.subn(r'(#define ORDER_A_ENCODED_BYTES   )\(\(OBOB_BITS \+ 7\) / 8\)(\s*// Bytes of an element of Z_\(2\^\d+\)), padded to the size of Z_\(3\^\d+\)',
+                         lambda m: m.group(1) + '((OALICE_BITS + 7) / 8)' + m.group(2)[2:], src)
+        assert n == 1
+        src, n = re.subn(r'(#define ORDER_B_ENCODED_BYTES   )\(\(OBOB_BITS \+ 7\) / 8\)(\s*// Bytes of an element of Z_\(3\^\d+\))',
+                         lambda m: m.group(1) + '((OALICE_BITS + 7) / 8)' + m.group(2)[2:] + ', padded to the size of Z_(2^%d)' % prm['eA'], src)
+        assert n == 1
+    return src
+
+
+def emit_param_file(src, prm, tprm, consts):
+    N, nw = prm['nbits'], prm['nw64']
+    src = substitute(src, prm, tprm)
+    src = re.sub(r'Ceil\(%d / 64\) = \d+ 64-bit digits or Ceil\(%d / 32\) = \d+' % (N, N),
+                 'Ceil(%d / 64) = %d 64-bit digits or Ceil(%d / 32) = %d' % (N, nw, N, prm['nw32']), src)
+    indent = " "*53
+    per = nw if nw <= 8 else (nw + 1)//2
+    single = {'p%d' % N: 'p', 'p%dx2' % N: 'px2', 'p%dx4' % N: 'px4', 'p%dp1' % N: 'pp1', 'p%dx16p' % N: 'px16p',
+              'Alice_order': 'Alice_order', 'Bob_order': 'Bob_order', 'Montgomery_rprime_B': 'Montgomery_rprime_B',
+              'Montgomery_Rprime_B': 'Montgomery_Rprime_B', 'Huff_c': 'Huff_c', 'Montgomery_R2': 'Montgomery_R2',
+              'Montgomery_one': 'Montgomery_one'}
+    for name, key in single.items():
+        ws = consts[key][0]
+        body = array_body([ws[j:j + per] for j in range(0, len(ws), per)], per, indent)
+        src = replace_array(src, name, body)
+    gen_comments = {'A_gen': ['XPA0', 'XPA1', 'XQA0', 'XQA1', 'XRA0', 'XRA1'], 'B_gen': ['XPB0', 'XPB1', 'XQB0', 'XQB1', 'XRB0', 'XRB1']}
+    for name in ('A_gen', 'B_gen', 'A_gen_Huff', 'B_gen_Huff'):
+        src = replace_array(src, name, array_body(consts[name], per, indent, gen_comments[name[:5]]))
+    # Elligator 2 table, one { } entry per candidate
+    rows = []
+    for r, ws in enumerate(consts['basis_table']):
+        chunks = [", ".join(ws[j:j + 5]) for j in range(0, len(ws), 5)]
+        rows.append("{ " + (",\n" + indent).join(chunks) + " }" + ("," if r < len(consts['basis_table']) - 1 else "") + "   // r = %d" % (r + 1))
+    body = "\n" + "\n".join(" "*51 + row for row in rows) + "\n" + " "*51 + "};"
+    m = re.search(r'(const uint64_t basis_table\[[^\]]*\]\[[^\]]*\] = \{)(.*?\n\s*\};)', src, re.S)
+    src = src[:m.start(2)] + body + src[m.end(2):]
+    src = re.sub(r'the non-square u = \d+ \+ i', 'the non-square u = %d + i' % consts['u'], src)
+    # Strategies
+    src = replace_table(src, 'strat_Alice', strategy_table('strat_Alice', 'MAX_Alice-1', consts['strat_Alice'], 26))
+    src = replace_table(src, 'strat_Bob', strategy_table('strat_Bob', 'MAX_Bob-1', consts['strat_Bob'], 26))
+    for name, size, values in consts['huff_tables']:
+        src = replace_table(src, name, strategy_table(name, size, values, 21))
+    costs = consts['hybrid_costs']
+    src = replace_table(src, 'hybrid_costs', "const unsigned int hybrid_costs[HYBRID_NKERNELS][2] = { \n" +
+                        ", ".join("{ %d, %d }" % tuple(row) for row in costs) + " };")
+    return src
+
+
+HUFF_TABLES = [  # name, size, party, stored points (None: MAX_INT_POINTS), threads
+    ('strat_Alice_Huff', 'MAX_Alice-1', 0, None, 1), ('strat_Alice_par_Huff', 'MAX_Alice-1', 0, None, 2),
+    ('strat_Alice_ws4_Huff', 'MAX_Alice-1', 0, 4, 1), ('strat_Alice_ws6_Huff', 'MAX_Alice-1', 0, 6, 1),
+    ('strat_Alice_ws8_Huff', 'MAX_Alice-1', 0, 8, 1), ('strat_Bob_Huff', 'MAX_Bob-1', 1, None, 1),
+    ('strat_Bob_par_Huff', 'MAX_Bob-1', 1, None, 2), ('strat_Bob_ws4_Huff', 'MAX_Bob-1', 1, 4, 1),
+    ('strat_Bob_ws6_Huff', 'MAX_Bob-1', 1, 6, 1), ('strat_Bob_ws8_Huff', 'MAX_Bob-1', 1, 8, 1),
+    ('strat_Alice_Edwards', 'MAX_Alice-1', 0, None, 1), ('strat_Bob_Edwards', 'MAX_Bob-1', 1, None, 1)]
+
+# Costs of a multiplication step and of an isogeny evaluation for the Montgomery strategies, as in the SIKE reference
+MONT_COSTS = (8, 7)
+
+
+def strategies(prm, costs):
+    out = {}
+    mp = (prm['max_pts_alice'], prm['max_pts_bob'])
+    nleaves = (prm['max_alice'], prm['max_bob'])
+    for party, name in ((0, 'strat_Alice'), (1, 'strat_Bob')):
+        split = optimal_strategy(nleaves[party], mp[party], MONT_COSTS[0], MONT_COSTS[1])
+        out[name] = strategy_preorder(split, nleaves[party], mp[party])
+    tables = []
+    for name, size, party, maxpts, threads in HUFF_TABLES:
+        maxpts = maxpts or mp[party]
+        # Huff column of hybrid_costs (multiplication, evaluation). The Edwards kernels have the costs of the Montgomery ones,
+        # whose column includes the model switches: the Edwards tables are approximate until "make strategies" measures them
+        model = 1 if name.endswith('_Edwards') else 0
+        pc, qc = costs[2*party][model], costs[2*party + 1][model]
+        split = optimal_strategy(nleaves[party], maxpts, pc, qc//threads)
+        tables.append((name, size, strategy_preorder(split, nleaves[party], maxpts)))
+    out['huff_tables'] = tables
+    return out
+
+
+# Tree emission
+
+HERE = os.path.dirname(os.path.abspath(__file__))   # Directory of the generators shared by the trees
+SKIP_DIRS = ('objs', 'lib', 'sidh', 'sike')
+TEMPLATE_ONLY = ('monttohuff.sage',)              # Hand-made worksheets of the template parameters
+
+
+def template_parameters(tdir):
+    pdir = os.path.basename(os.path.normpath(tdir)).replace('SIKEp', 'P')
+    s = open(os.path.join(tdir, pdir, pdir + '_internal.h')).read()
+    if not re.search(r'#define ELL2_W', s):
+        raise SystemExit("%s: the template must compute 4- and 3-isogenies (p = 2^eA*3^eB - 1)" % tdir)
+    eA = int(re.search(r'#define OALICE_BITS\s+(\d+)', s).group(1))
+    eB = int(re.search(r'#define OBOB_EXPON\s+(\d+)', s).group(1))
+    return parameters(eA, eB)
+
+
+def read_template(tdir, tprm):
+    tN = str(tprm['nbits'])
+    pdir = 'P' + tN
+    src = open(os.path.join(tdir, pdir, pdir + '.c')).read()
+    m = re.search(r'const unsigned int hybrid_costs\[HYBRID_NKERNELS\]\[2\] = \{(.*?)\};', src, re.S)
+    costs = [[int(a), int(b)] for a, b in re.findall(r'\{ *(\d+), *(\d+) *\}', m.group(1))]
+    return src, costs
+
+
+def emit_tree(tdir, odir, prm):
+    tprm = template_parameters(tdir)
+    N, tN = str(prm['nbits']), str(tprm['nbits'])
+    if os.path.exists(odir):
+        raise SystemExit("%s already exists" % odir)
+    src, tcosts = read_template(tdir, tprm)
+    consts = constants(prm, tcosts, tprm['nw64'])
+    consts.update(strategies(prm, consts['hybrid_costs']))
+    sizes = size_map(prm, tprm)
+    for root, dirs, files in os.walk(tdir):
+        rel = os.path.relpath(root, tdir)
+        dirs[:] = sorted(d for d in dirs if not (rel == '.' and d.startswith(SKIP_DIRS)))
+        for fname in sorted(files):
+            if fname in TEMPLATE_ONLY or fname.endswith(('_dlog_tables.h', '_fixed_base_tables.h', '.o', '.a')):
+                continue
+            src_path = os.path.join(root, fname)
+            dst_rel = os.path.join(rel, fname).replace(tN, N)
+            dst_path = os.path.normpath(os.path.join(odir, dst_rel))
+            os.makedirs(os.path.dirname(dst_path), exist_ok=True)
+            text = open(src_path, newline='').read()
+            base = os.path.basename(dst_rel)
+            if base == 'P%s.c' % N:
+                text = emit_param_file(text, prm, tprm, consts)
+            elif base == 'P%s_internal.h' % N:
+                text = emit_internal_h(text, prm, tprm)
+            elif base in ('api.h', 'README'):
+                text = substitute(text, prm, tprm, sizes)
+                # The scalars of compressed keys, whose size can coincide with that of Bob's secret keys in the template
+                text = re.sub(r'each in \d+ bytes', 'each in %d bytes' % prm['order_bytes'], text)
+                text = re.sub(r'NIST security level \d', 'NIST security level %d' % prm['nist_level'], text)
+            elif tN in fname or base in ('makefile',) or dst_rel.startswith('P' + N):
+                text = substitute(text, prm, tprm)
+                if base == 'makefile' and os.path.dirname(os.path.abspath(odir)) != HERE:
+                    text = re.sub(r'^TOOLS=.*$', 'TOOLS=' + HERE, text, flags=re.M)
+            elif base in ('test_extras.c', 'test_extras.h'):
+                text = emit_test_extras(text, prm, tprm, base.endswith('.h'))
+            elif base != 'fpx.c':
+                # Shared sources: only the powers in comments
+                text = substitute(text, prm, dict(tprm, nbits=None))
+            open(dst_path, 'w', newline='').write(text)
+            shutil.copymode(src_path, dst_path)
+
+
+def emit_test_extras(text, prm, tprm, header):
+    # Adds the random field elements of the tests (fprandom<N>_test, fp2random<N>_test) for a prime without them
+    N, tN = str(prm['nbits']), str(tprm['nbits'])
+    if ('fprandom%s_test' % N) in text:
+        return text
+    nl = '\r\n' if '\r\n' in text else '\n'
+    if header:
+        m = re.search(r'// Generating a pseudo-random field element in \[0, p%s-1\].*?fp2random%s_test\(digit_t\* a\);' % (tN, tN), text, re.S)
+        return text[:m.end()] + nl + nl + m.group(0).replace(tN, N) + text[m.end():]
+    m = re.search(r'static uint64_t p%s\[\d+\] = \{.*?\};' % tN, text, re.S)
+    indent = ' '*len('static uint64_t p%s[%d] = { ' % (N, prm['nw64']))
+    body = array_body([words(prm['p'], prm['nw64'])], 6, indent).replace('\n', nl)
+    text = text[:m.end()] + nl + 'static uint64_t p%s[%d] = { %s' % (N, prm['nw64'], body) + text[m.end():]
+    m = re.search(r'void fprandom%s_test\(digit_t\* a\).*?void fp2random%s_test\(digit_t\* a\).*?\n\}' % (tN, tN), text, re.S)
+    f = m.group(0).replace('%d-%s' % (tprm['maxbits'], tN), '%d-%s' % (prm['maxbits'], N)).replace(
+        'Obtain %d-bit' % tprm['maxbits'], 'Obtain %d-bit' % prm['maxbits']).replace(tN, N)
+    return text[:m.end()] + nl + nl + nl + f + text[m.end():]
+
+
+# x-coordinates of PA and QA of SIKEp434 in the SIKE specification, (re, im)
+PUBLISHED_P434 = {
+    'xPA': (0x3CCFC5E1F050030363E6920A0F7A4C6C71E63DE63A0E6475AF621995705F7C84500CB2BB61E950E19EAB8661D25C4A50ED279646CB48,
+            0x1AD1C1CAE7840EDDA6D8A924520F60E573D3B9DFAC6D189941CB22326D284A8816CC4249410FE80D68047D823C97D705246F869E3EA50),
+    'xQA': (0xC7461738340EFCF09CE388F666EB38F7F3AFD42DC0B664D9F461F31AA2EDC6B4AB71BD42F4D7C058E13F64B237EF7DDD2ABC0DEB0C6C,
+            0x25DE37157F50D75D320DD0682AB4A67E471586FBC2D31AA32E6957FA2B2614C4CD40A1E27283EAAF4272AE517847197432E2D61C85F5),
+}
+
+
+def check_published(tree):
+    # Computes the bases of p434 = 2^216*3^137 - 1 and compares PA and QA with the published ones, and with A_gen and
+    # A_gen_Huff (w = 1/x) in the parameter file of the SIKEp434 tree if there is one
+    prm = parameters(216, 137)
+    p, nw = prm['p'], prm['nw64']
+    A_gen, _ = public_bases(prm)
+    ok = True
+    for name, x in zip(('xPA', 'xQA'), A_gen):
+        same = (x == PUBLISHED_P434[name])
+        print("  %-24s %s" % ('p434 ' + name, "OK" if same else "DIFFERS"))
+        ok &= same
+    path = os.path.join(tree, 'P434', 'P434.c')
+    if not os.path.exists(path):
+        return ok
+    src = re.sub(r'//[^\n]*', '', open(path).read())
+    Rinv = pow(2**(64*nw), -1, p)
+    for name, inv in (('A_gen', False), ('A_gen_Huff', True)):
+        v = [int(w, 16) for w in re.findall(r'0x[0-9a-fA-F]+', re.search(r'const uint64_t %s\[[^\]]*\]\s*=\s*\{(.*?)\};' % name, src, re.S).group(1))]
+        elt = lambda k: sum(w << (64*j) for j, w in enumerate(v[k*nw:(k + 1)*nw]))*Rinv % p
+        for k, xname in ((0, 'xPA'), (1, 'xQA')):
+            x = PUBLISHED_P434[xname]
+            same = ((elt(2*k), elt(2*k + 1)) == (f2inv(p, x) if inv else x))
+            print("  %-24s %s" % ('%s %s' % (name, xname), "OK" if same else "DIFFERS"))
+            ok &= same
+    return ok
+
+
+def check_template(tdir):
+    # Regenerates the constants of the template and compares them with its parameter file
+    tprm = template_parameters(tdir)
+    src, tcosts = read_template(tdir, tprm)
+    consts = constants(tprm, tcosts, tprm['nw64'])
+    consts.update(strategies(tprm, tcosts))
+    out = emit_param_file(src, tprm, tprm, consts)
+    ok = True
+    for m in re.finditer(r'const uint64_t (\w+)\[', src):
+        name = m.group(1)
+        pat = r'const uint64_t %s\[[^\]]*\](?:\[[^\]]*\])?\s*=\s*\{(.*?)\};' % name
+        a = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', re.sub(r'//[^\n]*', '', re.search(pat, src, re.S).group(1)))]
+        b = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', re.sub(r'//[^\n]*', '', re.search(pat, out, re.S).group(1)))]
+        print("  %-24s %s" % (name, "OK" if a == b else "DIFFERS"))
+        ok &= (a == b)
+    for name in ('strat_Alice', 'strat_Bob'):
+        pat = r'const unsigned int %s\[[^\]]*\] = \{(.*?)\};' % name
+        a, b = (re.findall(r'\d+', re.search(pat, s, re.S).group(1)) for s in (src, out))
+        print("  %-24s %s" % (name, "OK" if a == b else "DIFFERS"))
+        ok &= (a == b)
+    return ok
+
+
+def main(argv):
+    tdir, odir, build, args = os.path.join(HERE, 'SIKEp751'), None, False, []
+    it = iter(argv)
+    for a in it:
+        if a == '--template':
+            tdir = next(it)
+        elif a == '--out':
+            odir = next(it)
+        elif a == '--build':
+            build = True
+        elif a == '--check':
+            args.append(a)
+        else:
+            args.append(a)
+    if args == ['--check']:
+        ok = check_template(tdir)
+        print("Constants of %s: %s" % (tdir, "PASSED" if ok else "FAILED"))
+        published = check_published(os.path.join(HERE, 'SIKEp434'))
+        print("Published p434 basis: %s" % ("PASSED" if published else "FAILED"))
+        return 0 if ok and published else 1
+    if len(args) != 2:
+        print(__doc__)
+        return 1
+    eA, eB = int(args[0]), int(args[1])
+    prm = parameters(eA, eB)
+    if not is_probable_prime(prm['p']):
+        raise SystemExit("2^%d*3^%d - 1 is not prime" % (eA, eB))
+    if eA % 2 or eA < 4:
+        raise SystemExit("eA must be even: Alice's isogenies have degree 4")
+    if prm['maxbits'] - prm['nbits'] < 2:
+        raise SystemExit("%d-bit prime: the lazy reductions need 4p < 2^%d" % (prm['nbits'], prm['maxbits']))
+    odir = odir or os.path.join(HERE, 'SIKEp%d' % prm['nbits'])
+    emit_tree(tdir, odir, prm)
+    print("Wrote %s (p = 2^%d*3^%d - 1, %d bits, %d 64-bit words)" % (odir, eA, eB, prm['nbits'], prm['nw64']))
+    if build:
+        cmds = ['make clean', 'make strategies', 'make clean', 'make']
+        # The KAT files are in KAT/ at the root of the repository, next to HuffSIDH/
+        if os.path.isdir(os.path.join(odir, os.pardir, os.pardir, 'KAT')):
+            cmds.append('cd sike && ./PQCgenKAT_kem_Huff')
+        else:
+            print("No KAT directory next to the parent of %s: the Huff KAT file is not generated" % odir)
+        for cmd in cmds:
+            subprocess.run(cmd, shell=True, cwd=odir, check=True)
+    return 0
+
+
+def is_probable_prime(n):
+    if n < 2:
+        return False
+    for q in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29):
+        if n % q == 0:
+            return n == q
+    d, s = n - 1, 0
+    while d % 2 == 0:
+        d //= 2
+        s += 1
+    for a in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37):
+        x = pow(a, d, n)
+        if x in (1, n - 1):
+            continue
+        for _ in range(s - 1):
+            x = x*x % n
+            if x == n - 1:
+                break
+        else:
+            return False
+    return True
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))